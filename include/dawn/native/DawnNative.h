@@ -308,6 +308,57 @@ DAWN_NATIVE_EXPORT uint64_t ComputeEstimatedMemoryUsage(WGPUDevice device);
 // Free any unused GPU memory like staging buffers, cached resources, etc.
 DAWN_NATIVE_EXPORT void ReduceMemoryUsage(WGPUDevice device);
 
+// Counters for monitoring a device in production. Counts, byte totals and durations accumulate
+// from the creation of the device, while the queue depths and ring buffer counts are the current
+// values along with their peaks. Durations are measured with the dawn::platform::Platform clock
+// and stay 0 if the platform doesn't provide one. The same samples are also reported through the
+// platform's histogram functions.
+struct DAWN_NATIVE_EXPORT DeviceMetrics {
+    // Pipelines that were found in the device's pipeline cache, and pipelines that were compiled.
+    uint64_t pipelineCacheHits = 0;
+    uint64_t pipelineCompilations = 0;
+    uint64_t pipelineCompilationMicroseconds = 0;
+
+    // Loads from and stores to the BlobCache.
+    uint64_t blobCacheHits = 0;
+    uint64_t blobCacheMisses = 0;
+    uint64_t blobCacheBytesLoaded = 0;
+    uint64_t blobCacheBytesStored = 0;
+
+    // Staging memory handed out by the upload ring buffers used for writeBuffer/writeTexture.
+    uint64_t uploaderBytesAllocated = 0;
+    uint64_t uploaderRingBufferCount = 0;
+    uint64_t uploaderPeakRingBufferCount = 0;
+
+    // Time spent in CommandEncoder::Finish and Queue::Submit.
+    uint64_t commandBuffersFinished = 0;
+    uint64_t commandEncoderFinishMicroseconds = 0;
+    uint64_t submits = 0;
+    uint64_t commandBuffersSubmitted = 0;
+    uint64_t submitMicroseconds = 0;
+
+    // Backend-specific. Currently only reported by the Vulkan backend.
+    uint64_t descriptorPoolsCreated = 0;
+    uint64_t deferredDeletionQueueDepth = 0;
+    uint64_t peakDeferredDeletionQueueDepth = 0;
+
+    // Objects whose GPU work has completed and that wait for, or were destroyed by, the
+    // background deletion task. Currently only reported by the Vulkan backend.
+    uint64_t backgroundDeletionQueueDepth = 0;
+    uint64_t peakBackgroundDeletionQueueDepth = 0;
+    uint64_t backgroundDeletions = 0;
+
+    // Memory of the heaps that resources are suballocated from, the part of it split into slabs
+    // for small allocations, and the part of the slabs used by allocations. Currently only
+    // reported by the Vulkan backend.
+    uint64_t suballocationHeapBytes = 0;
+    uint64_t slabBytes = 0;
+    uint64_t slabBytesInUse = 0;
+};
+
+// Returns a snapshot of the device's metrics. This doesn't lock the device.
+DAWN_NATIVE_EXPORT DeviceMetrics GetDeviceMetrics(WGPUDevice device);
+
 }  // namespace dawn::native
 
 #endif  // INCLUDE_DAWN_NATIVE_DAWNNATIVE_H_
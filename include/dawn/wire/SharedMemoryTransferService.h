@@ -0,0 +1,67 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSFERSERVICE_H_
+#define INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSFERSERVICE_H_
+
+#include <cstddef>
+#include <memory>
+
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+#include "dawn/wire/dawn_wire_export.h"
+
+namespace dawn::wire {
+
+// A pair of MemoryTransferServices that transfer buffer mapping and queue write data through
+// shared memory regions instead of copying it through the command stream. The client and server
+// services must be used with the same WireClient / WireServer pair and must outlive them.
+struct DAWN_WIRE_EXPORT SharedMemoryTransferServices {
+    SharedMemoryTransferServices();
+    SharedMemoryTransferServices(SharedMemoryTransferServices&&);
+    SharedMemoryTransferServices& operator=(SharedMemoryTransferServices&&);
+    ~SharedMemoryTransferServices();
+
+    std::unique_ptr<client::MemoryTransferService> client;
+    std::unique_ptr<server::MemoryTransferService> server;
+};
+
+// Queue::WriteBuffer and Queue::WriteTexture calls with at least |minQueueWriteSize| bytes of data
+// go through a shared memory WriteHandle, smaller ones are still inlined in the command stream.
+inline constexpr size_t kDefaultSharedMemoryMinQueueWriteSize = 256 * 1024;
+// The queue write data is sub-allocated from a single shared memory region of
+// |queueWriteRingSize| bytes that is reused once the server has read the data. Writes that don't
+// fit in it get their own region.
+inline constexpr size_t kDefaultSharedMemoryQueueWriteRingSize = 16 * 1024 * 1024;
+
+DAWN_WIRE_EXPORT SharedMemoryTransferServices CreateSharedMemoryTransferServices(
+    size_t minQueueWriteSize = kDefaultSharedMemoryMinQueueWriteSize,
+    size_t queueWriteRingSize = kDefaultSharedMemoryQueueWriteRingSize);
+
+}  // namespace dawn::wire
+
+#endif  // INCLUDE_DAWN_WIRE_SHAREDMEMORYTRANSFERSERVICE_H_
@@ -115,6 +115,23 @@ class DAWN_WIRE_EXPORT MemoryTransferService {
     // This may fail and return nullptr.
     virtual WriteHandle* CreateWriteHandle(size_t) = 0;
 
+    // Whether Queue::WriteBuffer and Queue::WriteTexture with |size| bytes of data should send
+    // the data through a WriteHandle instead of inlining it in the command stream. This is only
+    // beneficial when the WriteHandle avoids copying the data through the wire, for example when
+    // it is backed by shared memory. Defaults to false.
+    virtual bool ShouldUseWriteHandleForQueueWrite(size_t size);
+
+    // Create a handle for the data of a Queue::WriteBuffer or Queue::WriteTexture call. These
+    // handles only live until the server has read the data, so services may allocate them from
+    // pooled memory, and their data doesn't need to be zero-initialized since it is overwritten
+    // entirely. Defaults to CreateWriteHandle.
+    // This may fail and return nullptr.
+    virtual WriteHandle* CreateQueueWriteHandle(size_t size);
+
+    // Called when the client is disconnected. Handles that were serialized but not received by the
+    // server yet never will be, so services can release what they keep alive for them.
+    virtual void OnDisconnect();
+
     class DAWN_WIRE_EXPORT ReadHandle {
       public:
         ReadHandle();
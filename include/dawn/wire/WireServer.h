@@ -95,6 +95,11 @@ class DAWN_WIRE_EXPORT MemoryTransferService {
                                         size_t deserializeSize,
                                         WriteHandle** writeHandle) = 0;
 
+    // Called when the server is destroyed or fails to handle commands. The handles that the
+    // client serialized in the remaining commands will never be received, so services can release
+    // what they keep alive for them.
+    virtual void OnDisconnect();
+
     class DAWN_WIRE_EXPORT ReadHandle {
       public:
         ReadHandle();
@@ -137,6 +142,12 @@ class DAWN_WIRE_EXPORT MemoryTransferService {
                                            size_t offset,
                                            size_t size) = 0;
 
+        // Returns a pointer to the range (offset, offset + size) of the data written by the
+        // client if the handle can expose it without copying it into a target, for example when
+        // it is backed by shared memory, and nullptr otherwise.
+        // Needs to check potential offset/size OOB and overflow
+        virtual const void* GetSourceData(size_t offset, size_t size);
+
       protected:
         void* mTargetData = nullptr;
         size_t mDataLength = 0;
@@ -36,7 +36,12 @@
 
 #include "src/tint/api/common/binding_point.h"
 #include "src/tint/api/tint.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/pass_profiler.h"
+#include "src/tint/lang/core/ir/transform/rename_symbols.h"
+#include "src/tint/lang/core/ir/transform/single_entry_point.h"
 #include "src/tint/lang/core/type/manager.h"
+#include "src/tint/lang/wgsl/ast/override.h"
 #include "src/tint/lang/wgsl/ast/transform/first_index_offset.h"
 #include "src/tint/lang/wgsl/ast/transform/manager.h"
 #include "src/tint/lang/wgsl/ast/transform/renamer.h"
@@ -0,0 +1,164 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_COMMON_READMOSTLYHASHMAP_H_
+#define SRC_DAWN_COMMON_READMOSTLYHASHMAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/common/NonCopyable.h"
+
+namespace dawn {
+
+// A hash map for caches that are looked up much more often than they grow, where lookups must not
+// wait on each other. Entries are never removed before the map is destroyed.
+//
+//  - Find() can be called from any thread without synchronization. It doesn't take a lock or write
+//    to shared memory.
+//  - Insert() and ForEach() must be externally synchronized with each other, typically by a mutex
+//    that is only taken after Find() missed. They can run concurrently with Find().
+//
+// Entries are allocated individually so the pointers returned by Find() and Insert() stay valid
+// for the lifetime of the map. They are indexed by an open-addressing table of atomic pointers.
+// Insert() publishes an entry by storing its pointer in an empty slot of the table, and when the
+// table gets too full it builds a larger one and publishes it instead. Readers may still be
+// probing the older tables, so they are only freed with the map. Their total size is bounded by
+// twice the size of the current table.
+template <typename Key,
+          typename Value,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class ReadMostlyHashMap : public NonCopyable {
+  public:
+    ReadMostlyHashMap() {
+        mTables.push_back(std::make_unique<Table>(kInitialCapacity));
+        mCurrentTable.store(mTables.back().get(), std::memory_order_relaxed);
+    }
+
+    // Returns the value for `key`, or nullptr if it isn't in the map.
+    const Value* Find(const Key& key) const {
+        size_t hash = Hash()(key);
+        const Table* table = mCurrentTable.load(std::memory_order_acquire);
+        for (size_t i = hash & table->mask;; i = (i + 1) & table->mask) {
+            const Entry* entry = table->slots[i].load(std::memory_order_acquire);
+            if (entry == nullptr) {
+                return nullptr;
+            }
+            if (entry->hash == hash && KeyEqual()(entry->key, key)) {
+                return &entry->value;
+            }
+        }
+    }
+
+    // Adds `value` for `key`, which must not already be in the map, and returns a pointer to the
+    // stored value.
+    const Value* Insert(Key key, Value value) {
+        size_t hash = Hash()(key);
+        DAWN_ASSERT(Find(key) == nullptr);
+        mEntries.push_back(
+            std::unique_ptr<Entry>(new Entry{std::move(key), std::move(value), hash}));
+        const Entry* entry = mEntries.back().get();
+
+        // Keep the table at most half full so that probe sequences stay short and always end on
+        // an empty slot.
+        Table* table = mTables.back().get();
+        if (mEntries.size() * 2 <= table->capacity) {
+            InsertInto(table, entry);
+        } else {
+            auto newTable = std::make_unique<Table>(table->capacity * 2);
+            for (const std::unique_ptr<Entry>& existingEntry : mEntries) {
+                InsertInto(newTable.get(), existingEntry.get());
+            }
+            mTables.push_back(std::move(newTable));
+            mCurrentTable.store(mTables.back().get(), std::memory_order_release);
+        }
+
+        return &entry->value;
+    }
+
+    // Calls `f(key, value)` for each entry, in insertion order.
+    template <typename F>
+    void ForEach(F&& f) const {
+        for (const std::unique_ptr<Entry>& entry : mEntries) {
+            f(entry->key, entry->value);
+        }
+    }
+
+    size_t Size() const { return mEntries.size(); }
+
+  private:
+    static constexpr size_t kInitialCapacity = 16;
+
+    struct Entry {
+        Key key;
+        Value value;
+        size_t hash;
+    };
+
+    struct Table {
+        explicit Table(size_t capacityIn)
+            : capacity(capacityIn),
+              mask(capacityIn - 1),
+              slots(new std::atomic<const Entry*>[capacityIn]) {
+            DAWN_ASSERT(IsPowerOfTwo(capacity));
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        const size_t capacity;
+        const size_t mask;
+        std::unique_ptr<std::atomic<const Entry*>[]> slots;
+    };
+
+    // Stores `entry` in the first empty slot of its probe sequence. Only the writer modifies the
+    // tables so a relaxed load is enough to find the slot, but the store must be a release so that
+    // readers that see the pointer also see the entry.
+    static void InsertInto(Table* table, const Entry* entry) {
+        for (size_t i = entry->hash & table->mask;; i = (i + 1) & table->mask) {
+            if (table->slots[i].load(std::memory_order_relaxed) == nullptr) {
+                table->slots[i].store(entry, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Entry>> mEntries;
+    std::vector<std::unique_ptr<Table>> mTables;
+    std::atomic<const Table*> mCurrentTable;
+};
+
+}  // namespace dawn
+
+#endif  // SRC_DAWN_COMMON_READMOSTLYHASHMAP_H_
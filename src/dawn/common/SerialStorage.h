@@ -28,6 +28,7 @@
 #ifndef SRC_DAWN_COMMON_SERIALSTORAGE_H_
 #define SRC_DAWN_COMMON_SERIALSTORAGE_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
@@ -113,6 +114,9 @@ class SerialStorage {
     }
 
     bool Empty() const;
+    // Returns the number of values stored. This is linear in the number of distinct serials, not
+    // in the number of values.
+    size_t Size() const;
 
     // The UpTo variants of Iterate and Clear affect all values associated to a serial
     // that is smaller OR EQUAL to the given serial. Iterating is done like so:
@@ -142,6 +146,15 @@ bool SerialStorage<Derived>::Empty() const {
     return mStorage.empty();
 }
 
+template <typename Derived>
+size_t SerialStorage<Derived>::Size() const {
+    size_t size = 0;
+    for (const auto& [_, values] : mStorage) {
+        size += values.size();
+    }
+    return size;
+}
+
 template <typename Derived>
 typename SerialStorage<Derived>::ConstBeginEnd SerialStorage<Derived>::IterateAll() const {
     return {mStorage.begin(), mStorage.end()};
@@ -33,14 +33,17 @@
 #include "dawn/common/Version_autogen.h"
 #include "dawn/native/CacheKey.h"
 #include "dawn/native/Instance.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::native {
 
-BlobCache::BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc)
+BlobCache::BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc,
+                     MetricsCollector* metrics)
     : mLoadFunction(desc.loadDataFunction),
       mStoreFunction(desc.storeDataFunction),
-      mFunctionUserdata(desc.functionUserdata) {}
+      mFunctionUserdata(desc.functionUserdata),
+      mMetrics(metrics) {}
 
 Blob BlobCache::Load(const CacheKey& key) {
     std::lock_guard<std::mutex> lock(mMutex);
@@ -69,8 +72,14 @@ Blob BlobCache::LoadInternal(const CacheKey& key) {
         const size_t actualSize =
             mLoadFunction(key.data(), key.size(), result.Data(), expectedSize, mFunctionUserdata);
         DAWN_ASSERT(expectedSize == actualSize);
+        if (mMetrics != nullptr) {
+            mMetrics->RecordBlobCacheLoad(actualSize);
+        }
         return result;
     }
+    if (mMetrics != nullptr) {
+        mMetrics->RecordBlobCacheLoad(0);
+    }
     return Blob();
 }
 
@@ -82,6 +91,9 @@ void BlobCache::StoreInternal(const CacheKey& key, size_t valueSize, const void*
         return;
     }
     mStoreFunction(key.data(), key.size(), value, valueSize, mFunctionUserdata);
+    if (mMetrics != nullptr) {
+        mMetrics->RecordBlobCacheStore(valueSize);
+    }
 }
 
 bool BlobCache::ValidateCacheKey(const CacheKey& key) {
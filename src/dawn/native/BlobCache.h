@@ -33,6 +33,7 @@
 #include "dawn/common/Platform.h"
 #include "dawn/native/Blob.h"
 #include "dawn/native/CacheResult.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 #include "partition_alloc/pointers/raw_ptr_exclusion.h"
 
 namespace dawn::platform {
@@ -43,11 +44,13 @@ namespace dawn::native {
 
 class CacheKey;
 class InstanceBase;
+class MetricsCollector;
 
 // This class should always be thread-safe because it may be called asynchronously.
 class BlobCache {
   public:
-    explicit BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc);
+    // `metrics` may be null, and must outlive the BlobCache otherwise.
+    BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc, MetricsCollector* metrics);
 
     // Returns empty blob if the key is not found in the cache.
     Blob Load(const CacheKey& key);
@@ -81,6 +84,7 @@ class BlobCache {
     RAW_PTR_EXCLUSION WGPUDawnLoadCacheDataFunction mLoadFunction;
     RAW_PTR_EXCLUSION WGPUDawnStoreCacheDataFunction mStoreFunction;
     RAW_PTR_EXCLUSION void* mFunctionUserdata;
+    raw_ptr<MetricsCollector> mMetrics;
 };
 
 }  // namespace dawn::native
@@ -87,6 +87,7 @@ ResultOrError<ResourceMemoryAllocation> BuddyMemoryAllocator::Allocate(uint64_t
         std::unique_ptr<ResourceHeapBase> memory;
         DAWN_TRY_ASSIGN(memory, mHeapAllocator->AllocateResourceHeap(mMemoryBlockSize));
         mTrackedSubAllocations[memoryIndex] = {/*refcount*/ 0, std::move(memory)};
+        mAllocatedHeapCount++;
     }
 
     mTrackedSubAllocations[memoryIndex].refcount++;
@@ -115,6 +116,7 @@ void BuddyMemoryAllocator::Deallocate(const ResourceMemoryAllocation& allocation
     if (mTrackedSubAllocations[memoryIndex].refcount == 0) {
         mHeapAllocator->DeallocateResourceHeap(
             std::move(mTrackedSubAllocations[memoryIndex].mMemoryAllocation));
+        mAllocatedHeapCount--;
     }
 
     mBuddyBlockAllocator.Deallocate(info.mBlockOffset);
@@ -124,6 +126,10 @@ uint64_t BuddyMemoryAllocator::GetMemoryBlockSize() const {
     return mMemoryBlockSize;
 }
 
+uint64_t BuddyMemoryAllocator::GetAllocatedHeapBytes() const {
+    return mAllocatedHeapCount * mMemoryBlockSize;
+}
+
 uint64_t BuddyMemoryAllocator::ComputeTotalNumOfHeapsForTesting() const {
     uint64_t count = 0;
     for (const TrackedSubAllocations& allocation : mTrackedSubAllocations) {
@@ -63,6 +63,9 @@ class BuddyMemoryAllocator {
 
     uint64_t GetMemoryBlockSize() const;
 
+    // The total size of the resource heaps currently backing suballocations.
+    uint64_t GetAllocatedHeapBytes() const;
+
     // For testing purposes.
     uint64_t ComputeTotalNumOfHeapsForTesting() const;
 
@@ -80,6 +83,7 @@ class BuddyMemoryAllocator {
     };
 
     std::vector<TrackedSubAllocations> mTrackedSubAllocations;
+    uint64_t mAllocatedHeapCount = 0;
 };
 
 }  // namespace dawn::native
@@ -37,6 +37,70 @@
 
 namespace dawn::native {
 
+namespace {
+
+std::unique_ptr<char[]> AcquireBlock(CommandBlockPool* pool, size_t size) {
+    if (pool != nullptr) {
+        return pool->Acquire(size);
+    }
+    return std::unique_ptr<char[]>(new (std::nothrow) char[size]);
+}
+
+void ReleaseBlocks(CommandBlockPool* pool, CommandBlocks* blocks) {
+    if (pool != nullptr) {
+        pool->Release(blocks);
+    } else {
+        blocks->clear();
+    }
+}
+
+}  // anonymous namespace
+
+CommandBlockPool::CommandBlockPool() = default;
+
+CommandBlockPool::~CommandBlockPool() = default;
+
+std::unique_ptr<char[]> CommandBlockPool::Acquire(size_t size) {
+    if (IsPooledSize(size)) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::vector<std::unique_ptr<char[]>>& freeBlocks = mFreeBlocks[GetSizeClass(size)];
+        if (!freeBlocks.empty()) {
+            std::unique_ptr<char[]> block = std::move(freeBlocks.back());
+            freeBlocks.pop_back();
+            return block;
+        }
+    }
+    return std::unique_ptr<char[]>(new (std::nothrow) char[size]);
+}
+
+void CommandBlockPool::Release(CommandBlocks* blocks) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (BlockDef& block : *blocks) {
+            if (!IsPooledSize(block.size)) {
+                continue;
+            }
+            std::vector<std::unique_ptr<char[]>>& freeBlocks =
+                mFreeBlocks[GetSizeClass(block.size)];
+            if (freeBlocks.size() < kMaxPooledBlocksPerSize) {
+                freeBlocks.push_back(std::move(block.block));
+            }
+        }
+    }
+    // The blocks that weren't pooled are freed outside of the lock.
+    blocks->clear();
+}
+
+// static
+bool CommandBlockPool::IsPooledSize(size_t size) {
+    return size >= kMinPooledBlockSize && size <= kMaxPooledBlockSize && IsPowerOfTwo(size);
+}
+
+// static
+size_t CommandBlockPool::GetSizeClass(size_t size) {
+    return Log2(uint64_t(size)) - ConstexprLog2(kMinPooledBlockSize);
+}
+
 // TODO(cwallez@chromium.org): figure out a way to have more type safety for the iterator
 
 CommandIterator::CommandIterator() {
@@ -47,7 +111,7 @@ CommandIterator::~CommandIterator() {
     DAWN_ASSERT(IsEmpty());
 }
 
-CommandIterator::CommandIterator(CommandIterator&& other) {
+CommandIterator::CommandIterator(CommandIterator&& other) : mPool(other.mPool) {
     if (!other.IsEmpty()) {
         mBlocks = std::move(other.mBlocks);
         other.Reset();
@@ -57,6 +121,7 @@ CommandIterator::CommandIterator(CommandIterator&& other) {
 
 CommandIterator& CommandIterator::operator=(CommandIterator&& other) {
     DAWN_ASSERT(IsEmpty());
+    mPool = other.mPool;
     if (!other.IsEmpty()) {
         mBlocks = std::move(other.mBlocks);
         other.Reset();
@@ -65,7 +130,8 @@ CommandIterator& CommandIterator::operator=(CommandIterator&& other) {
     return *this;
 }
 
-CommandIterator::CommandIterator(CommandAllocator allocator) : mBlocks(allocator.AcquireBlocks()) {
+CommandIterator::CommandIterator(CommandAllocator allocator)
+    : mBlocks(allocator.AcquireBlocks()), mPool(allocator.mPool) {
     Reset();
 }
 
@@ -80,6 +146,9 @@ void CommandIterator::AcquireCommandBlocks(std::vector<CommandAllocator> allocat
 
     mBlocks.reserve(totalBlocksCount);
     for (CommandAllocator& allocator : allocators) {
+        // All the allocators of a command list come from the same device and share its pool.
+        DAWN_ASSERT(mPool == nullptr || mPool == allocator.mPool);
+        mPool = allocator.mPool;
         CommandBlocks blocks = allocator.AcquireBlocks();
         if (!blocks.empty()) {
             for (BlockDef& block : blocks) {
@@ -119,7 +188,7 @@ void CommandIterator::MakeEmptyAsDataWasDestroyed() {
     }
 
     mCurrentPtr = reinterpret_cast<char*>(&mEndOfBlock);
-    mBlocks.clear();
+    ReleaseBlocks(mPool, &mBlocks);
     Reset();
     DAWN_ASSERT(IsEmpty());
 }
@@ -138,7 +207,7 @@ bool CommandIterator::IsEmpty() const {
 //  - Better block allocation, maybe have Dawn API to say command buffer is going to have size
 //    close to another
 
-CommandAllocator::CommandAllocator() {
+CommandAllocator::CommandAllocator(CommandBlockPool* pool) : mPool(pool) {
     ResetPointers();
 }
 
@@ -147,7 +216,9 @@ CommandAllocator::~CommandAllocator() {
 }
 
 CommandAllocator::CommandAllocator(CommandAllocator&& other)
-    : mBlocks(std::move(other.mBlocks)), mLastAllocationSize(other.mLastAllocationSize) {
+    : mBlocks(std::move(other.mBlocks)),
+      mLastAllocationSize(other.mLastAllocationSize),
+      mPool(other.mPool) {
     other.mBlocks.clear();
     if (!other.IsEmpty()) {
         mCurrentPtr = other.mCurrentPtr;
@@ -160,6 +231,7 @@ CommandAllocator::CommandAllocator(CommandAllocator&& other)
 
 CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
     Reset();
+    mPool = other.mPool;
     if (!other.IsEmpty()) {
         std::swap(mBlocks, other.mBlocks);
         mLastAllocationSize = other.mLastAllocationSize;
@@ -172,7 +244,7 @@ CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
 
 void CommandAllocator::Reset() {
     ResetPointers();
-    mBlocks.clear();
+    ReleaseBlocks(mPool, &mBlocks);
     mLastAllocationSize = kDefaultBaseAllocationSize;
 }
 
@@ -222,7 +294,7 @@ bool CommandAllocator::GetNewBlock(size_t minimumSize) {
     // Allocate blocks doubling sizes each time, to a maximum of 16k (or at least minimumSize).
     mLastAllocationSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
 
-    auto block = std::unique_ptr<char[]>(new (std::nothrow) char[mLastAllocationSize]);
+    auto block = AcquireBlock(mPool, mLastAllocationSize);
     if (DAWN_UNLIKELY(block == nullptr)) {
         return false;
     }
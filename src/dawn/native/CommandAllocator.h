@@ -28,16 +28,19 @@
 #ifndef SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 #define SRC_DAWN_NATIVE_COMMANDALLOCATOR_H_
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <vector>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Math.h"
 #include "dawn/common/NonCopyable.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 #include "partition_alloc/pointers/raw_ptr_exclusion.h"
 
 namespace dawn::native {
@@ -84,6 +87,37 @@ constexpr uint32_t kAdditionalData = std::numeric_limits<uint32_t>::max() - 1;
 
 class CommandAllocator;
 
+// Command blocks are allocated with a few power-of-two sizes (see
+// CommandAllocator::GetNewBlock). Encoders are created and their command buffers destroyed at a
+// high rate so each device owns a CommandBlockPool that keeps a small number of freed blocks per
+// size for its CommandAllocators to reuse instead of going back to the system allocator. Blocks of
+// other sizes, for example for very large commands, are not pooled. CommandBlockPool is
+// thread-safe and must outlive the CommandAllocators and CommandIterators that use it.
+class CommandBlockPool : public NonCopyable {
+  public:
+    static constexpr size_t kMinPooledBlockSize = 4096;
+    static constexpr size_t kMaxPooledBlockSize = 16384;
+    static constexpr size_t kMaxPooledBlocksPerSize = 16;
+
+    CommandBlockPool();
+    ~CommandBlockPool();
+
+    // Returns a block of `size` bytes, or nullptr if the allocation failed.
+    std::unique_ptr<char[]> Acquire(size_t size);
+    // Keeps the blocks of the pooled sizes, frees the others and clears `blocks`.
+    void Release(CommandBlocks* blocks);
+
+  private:
+    static constexpr size_t kSizeClassCount =
+        ConstexprLog2(kMaxPooledBlockSize) - ConstexprLog2(kMinPooledBlockSize) + 1;
+
+    static bool IsPooledSize(size_t size);
+    static size_t GetSizeClass(size_t size);
+
+    std::mutex mMutex;
+    std::array<std::vector<std::unique_ptr<char[]>>, kSizeClassCount> mFreeBlocks;
+};
+
 class CommandIterator : public NonCopyable {
   public:
     CommandIterator();
@@ -158,6 +192,8 @@ class CommandIterator : public NonCopyable {
     }
 
     CommandBlocks mBlocks;
+    // The pool of the allocators the blocks were acquired from, if any.
+    raw_ptr<CommandBlockPool> mPool = nullptr;
     // RAW_PTR_EXCLUSION: This is an extremely hot pointer during command iteration, but always
     // points to at least a valid uint32_t, either inside a block, or at mEndOfBlock.
     RAW_PTR_EXCLUSION char* mCurrentPtr = nullptr;
@@ -168,10 +204,12 @@ class CommandIterator : public NonCopyable {
 
 class CommandAllocator : public NonCopyable {
   public:
-    CommandAllocator();
+    // Blocks are allocated from and released to `pool` when it is not null, and to the system
+    // allocator otherwise.
+    explicit CommandAllocator(CommandBlockPool* pool = nullptr);
     ~CommandAllocator();
 
-    // NOTE: A moved-from CommandAllocator is reset to its initial empty state.
+    // NOTE: A moved-from CommandAllocator is reset to its initial empty state, but keeps its pool.
     CommandAllocator(CommandAllocator&&);
     CommandAllocator& operator=(CommandAllocator&&);
 
@@ -275,6 +313,7 @@ class CommandAllocator : public NonCopyable {
 
     CommandBlocks mBlocks;
     size_t mLastAllocationSize = kDefaultBaseAllocationSize;
+    raw_ptr<CommandBlockPool> mPool = nullptr;
 
     // Data used for the block range at initialization so that the first call to Allocate sees
     // there is not enough space and calls GetNewBlock. This avoids having to special case the
@@ -521,7 +521,10 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
     if (aspects[VALIDATION_ASPECT_BIND_GROUPS]) {
         bool matches = true;
 
-        for (BindGroupIndex i : IterateBitSet(mLastPipelineLayout->GetBindGroupLayoutsMask())) {
+        // Only the groups that changed since they were last checked against this pipeline need to
+        // be looked at again.
+        const BindGroupMask& requiredGroups = mLastPipelineLayout->GetBindGroupLayoutsMask();
+        for (BindGroupIndex i : IterateBitSet(requiredGroups & ~mCompatibleBindGroups)) {
             if (mBindgroups[i] == nullptr ||
                 !mLastPipelineLayout->GetFrontendBindGroupLayout(i)->IsLayoutEqual(
                     mBindgroups[i]->GetFrontendLayout()) ||
@@ -531,10 +534,12 @@ void CommandBufferStateTracker::RecomputeLazyAspects(ValidationAspects aspects)
                 matches = false;
                 break;
             }
+            mCompatibleBindGroups.set(i);
         }
 
-        if (matches) {
-            // Continue checking if there is writable storage buffer binding aliasing or not
+        // Continue checking if there is writable storage buffer binding aliasing or not. This can
+        // only happen if the layout has writable storage bindings.
+        if (matches && mLastPipelineLayout->GetWritableStorageBindGroupsMask().any()) {
             if (FindStorageBufferBindingAliasing<bool>(mLastPipelineLayout, mBindgroups,
                                                        mDynamicOffsets)) {
                 matches = false;
@@ -743,14 +748,27 @@ void CommandBufferStateTracker::SetRenderPipeline(RenderPipelineBase* pipeline)
 
 void CommandBufferStateTracker::UnsetBindGroup(BindGroupIndex index) {
     mBindgroups[index] = nullptr;
+    mCompatibleBindGroups.reset(index);
     mAspects.reset(VALIDATION_ASPECT_BIND_GROUPS);
 }
 void CommandBufferStateTracker::SetBindGroup(BindGroupIndex index,
                                              BindGroupBase* bindgroup,
                                              uint32_t dynamicOffsetCount,
                                              const uint32_t* dynamicOffsets) {
-    mBindgroups[index] = bindgroup;
     mDynamicOffsets[index].assign(dynamicOffsets, dynamicOffsets + dynamicOffsetCount);
+
+    if (bindgroup == mBindgroups[index]) {
+        // Rebinding the same bind group, typically with new dynamic offsets, keeps it compatible
+        // with the current pipeline. Dynamic offsets only matter for the writable binding
+        // aliasing validation, so the aspect stays valid if the group cannot alias.
+        if (mCompatibleBindGroups[index] &&
+            !mLastPipelineLayout->GetWritableStorageBindGroupsMask()[index]) {
+            return;
+        }
+    } else {
+        mBindgroups[index] = bindgroup;
+        mCompatibleBindGroups.reset(index);
+    }
     mAspects.reset(VALIDATION_ASPECT_BIND_GROUPS);
 }
 
@@ -776,6 +794,25 @@ void CommandBufferStateTracker::SetVertexBuffer(VertexBufferSlot slot, uint64_t
 }
 
 void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
+    if (pipeline != mLastPipeline) {
+        // Bind groups checked against the previous pipeline stay compatible if the new layout
+        // uses the same bind group layout at their index, unless their buffer sizes need to be
+        // checked against the new pipeline's minimum buffer sizes.
+        BindGroupMask stillCompatible;
+        if (pipeline != nullptr && mLastPipelineLayout != nullptr) {
+            PipelineLayoutBase* layout = pipeline->GetLayout();
+            for (BindGroupIndex i : IterateBitSet(mCompatibleBindGroups &
+                                                  layout->GetBindGroupLayoutsMask())) {
+                if (layout->GetFrontendBindGroupLayout(i) ==
+                        mLastPipelineLayout->GetFrontendBindGroupLayout(i) &&
+                    mBindgroups[i]->GetUnverifiedBufferSizes().size() == 0u) {
+                    stillCompatible.set(i);
+                }
+            }
+        }
+        mCompatibleBindGroups = stillCompatible;
+    }
+
     mLastPipeline = pipeline;
     mLastPipelineLayout = pipeline != nullptr ? pipeline->GetLayout() : nullptr;
     mMinBufferSizes = pipeline != nullptr ? &pipeline->GetMinBufferSizes() : nullptr;
@@ -838,6 +875,7 @@ void CommandBufferStateTracker::End() {
     mLastPipeline = nullptr;
     mMinBufferSizes = nullptr;
     mBindgroups.fill(nullptr);
+    mCompatibleBindGroups.reset();
 }
 
 }  // namespace dawn::native
@@ -113,6 +113,10 @@ class CommandBufferStateTracker {
     // freed from underneath this class.
     RAW_PTR_EXCLUSION PerBindGroup<BindGroupBase*> mBindgroups = {};
     PerBindGroup<std::vector<uint32_t>> mDynamicOffsets = {};
+    // The bind groups that were validated against the current pipeline (matching layout and
+    // large enough buffers). Kept across draws and redundant SetBindGroup calls so that only the
+    // groups that changed are validated again.
+    BindGroupMask mCompatibleBindGroups;
 
     RAW_PTR_EXCLUSION PipelineLayoutBase* mLastPipelineLayout = nullptr;
     RAW_PTR_EXCLUSION PipelineBase* mLastPipeline = nullptr;
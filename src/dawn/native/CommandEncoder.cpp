@@ -50,6 +50,7 @@
 #include "dawn/native/ComputePassEncoder.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/ErrorData.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/ObjectType_autogen.h"
 #include "dawn/native/QueryHelper.h"
 #include "dawn/native/QuerySet.h"
@@ -2077,6 +2078,7 @@ ResultOrError<Ref<CommandBufferBase>> CommandEncoder::Finish(
     DeviceBase* device = GetDevice();
 
     TRACE_EVENT0(device->GetPlatform(), Recording, "CommandEncoder::Finish");
+    double startTime = device->GetMetrics()->Now();
 
     // Even if mEncodingContext.Finish() validation fails, calling it will mutate the internal
     // state of the encoding context. The internal state is set to finished, and subsequent
@@ -2093,7 +2095,10 @@ ResultOrError<Ref<CommandBufferBase>> CommandEncoder::Finish(
         descriptor = &defaultDescriptor;
     }
 
-    return device->CreateCommandBuffer(this, descriptor);
+    Ref<CommandBufferBase> commandBuffer;
+    DAWN_TRY_ASSIGN(commandBuffer, device->CreateCommandBuffer(this, descriptor));
+    device->GetMetrics()->RecordCommandEncoderFinish(startTime);
+    return std::move(commandBuffer);
 }
 
 // Implementation of the command buffer validation that can be precomputed before submit
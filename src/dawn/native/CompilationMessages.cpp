@@ -27,6 +27,9 @@
 
 #include "dawn/native/CompilationMessages.h"
 
+#include <string_view>
+#include <vector>
+
 #include "dawn/common/Assert.h"
 #include "dawn/common/StringViewUtils.h"
 #include "dawn/native/dawn_platform.h"
@@ -133,13 +136,14 @@ MaybeError OwnedCompilationMessages::AddMessage(const tint::diag::Diagnostic& di
 
     if (lineNum && linePosInBytes && diagnostic.source.file) {
         const tint::Source::FileContent& content = diagnostic.source.file->content;
+        const std::vector<std::string_view>& lines = content.Lines();
 
-        // Tint stores line as std::string_view in a complete source std::string that's in the
-        // source file. So to get the offset in bytes of a line we just need to substract its start
+        // Tint stores line as std::string_view into the complete source that's in the source
+        // file. So to get the offset in bytes of a line we just need to substract its start
         // pointer with the start of the file's content. Note that line numbering in Tint source
         // range starts at 1 while the array of lines start at 0 (hence the -1).
         const char* fileStart = content.data.data();
-        const char* lineStart = content.lines[lineNum - 1].data();
+        const char* lineStart = lines[lineNum - 1].data();
         offsetInBytes = static_cast<uint64_t>(lineStart - fileStart) + linePosInBytes - 1;
 
         // The linePosInBytes is 1-based.
@@ -163,7 +167,7 @@ MaybeError OwnedCompilationMessages::AddMessage(const tint::diag::Diagnostic& di
             endLineCol = linePosInBytes;
         }
 
-        const char* endLineStart = content.lines[endLineNum - 1].data();
+        const char* endLineStart = lines[endLineNum - 1].data();
         uint64_t endOffsetInBytes =
             static_cast<uint64_t>(endLineStart - fileStart) + endLineCol - 1;
         // The length of the message is the difference between the starting offset and the
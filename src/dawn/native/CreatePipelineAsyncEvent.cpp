@@ -40,6 +40,7 @@
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/EventManager.h"
 #include "dawn/native/Instance.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/RenderPipeline.h"
 #include "dawn/native/SystemEvent.h"
 #include "dawn/native/dawn_platform_autogen.h"
@@ -150,7 +151,9 @@ void CreatePipelineAsyncEvent<PipelineType, CreatePipelineAsyncCallbackInfo>::In
     MaybeError maybeError;
     {
         SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(device->GetPlatform(), kDawnHistogramMetricsUS);
+        double startTime = device->GetMetrics()->Now();
         maybeError = mPipeline->Initialize(std::move(mScopedUseShaderPrograms));
+        device->GetMetrics()->RecordPipelineCompilation(startTime);
     }
     DAWN_HISTOGRAM_BOOLEAN(device->GetPlatform(), kDawnHistogramMetricsSuccess,
                            maybeError.IsSuccess());
@@ -34,6 +34,7 @@
 #include "dawn/native/Buffer.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/Instance.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/Texture.h"
 #include "dawn/platform/DawnPlatform.h"
 #include "tint/tint.h"
@@ -312,4 +313,8 @@ void ReduceMemoryUsage(WGPUDevice device) {
     FromAPI(device)->ReduceMemoryUsage();
 }
 
+DeviceMetrics GetDeviceMetrics(WGPUDevice device) {
+    return FromAPI(device)->GetMetrics()->GetMetrics();
+}
+
 }  // namespace dawn::native
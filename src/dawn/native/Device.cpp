@@ -48,6 +48,7 @@
 #include "dawn/native/BlobCache.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/ChainUtils.h"
+#include "dawn/native/CommandAllocator.h"
 #include "dawn/native/CommandBuffer.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CompilationMessages.h"
@@ -61,6 +62,7 @@
 #include "dawn/native/ExternalTexture.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/InternalPipelineStore.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/ObjectType_autogen.h"
 #include "dawn/native/PhysicalDevice.h"
 #include "dawn/native/PipelineCache.h"
@@ -419,7 +421,8 @@ DeviceBase::DeviceBase(AdapterBase* adapter,
         cacheDesc.storeDataFunction = nullptr;
         cacheDesc.functionUserdata = nullptr;
     }
-    mBlobCache = std::make_unique<BlobCache>(cacheDesc);
+    mMetrics = std::make_unique<MetricsCollector>(GetPlatform());
+    mBlobCache = std::make_unique<BlobCache>(cacheDesc, mMetrics.get());
 
     if (descriptor->requiredLimits != nullptr) {
         mLimits.v1 =
@@ -476,6 +479,7 @@ MaybeError DeviceBase::Initialize(Ref<QueueBase> defaultQueue) {
     mCaches = std::make_unique<DeviceBase::Caches>();
     mErrorScopeStack = std::make_unique<ErrorScopeStack>();
     mDynamicUploader = std::make_unique<DynamicUploader>(this);
+    mCommandBlockPool = std::make_unique<CommandBlockPool>();
     mCallbackTaskManager = AcquireRef(new CallbackTaskManager());
     mInternalPipelineStore = std::make_unique<InternalPipelineStore>(this);
 
@@ -955,6 +959,10 @@ BlobCache* DeviceBase::GetBlobCache() const {
     return mBlobCache.get();
 }
 
+MetricsCollector* DeviceBase::GetMetrics() const {
+    return mMetrics.get();
+}
+
 Blob DeviceBase::LoadCachedBlob(const CacheKey& key) {
     return GetBlobCache()->Load(key);
 }
@@ -1128,12 +1136,20 @@ PipelineLayoutBase* DeviceBase::GetEmptyPipelineLayout() {
 
 Ref<ComputePipelineBase> DeviceBase::GetCachedComputePipeline(
     ComputePipelineBase* uninitializedComputePipeline) {
-    return mCaches->computePipelines.Find(uninitializedComputePipeline);
+    Ref<ComputePipelineBase> cached = mCaches->computePipelines.Find(uninitializedComputePipeline);
+    if (cached != nullptr) {
+        mMetrics->RecordPipelineCacheHit();
+    }
+    return cached;
 }
 
 Ref<RenderPipelineBase> DeviceBase::GetCachedRenderPipeline(
     RenderPipelineBase* uninitializedRenderPipeline) {
-    return mCaches->renderPipelines.Find(uninitializedRenderPipeline);
+    Ref<RenderPipelineBase> cached = mCaches->renderPipelines.Find(uninitializedRenderPipeline);
+    if (cached != nullptr) {
+        mMetrics->RecordPipelineCacheHit();
+    }
+    return cached;
 }
 
 Ref<ComputePipelineBase> DeviceBase::AddOrGetCachedComputePipeline(
@@ -2110,7 +2126,9 @@ ResultOrError<Ref<ComputePipelineBase>> DeviceBase::CreateComputePipeline(
     MaybeError maybeError;
     {
         SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(GetPlatform(), "CreateComputePipelineUS");
+        double startTime = mMetrics->Now();
         maybeError = uninitializedComputePipeline->Initialize();
+        mMetrics->RecordPipelineCompilation(startTime);
     }
     DAWN_HISTOGRAM_BOOLEAN(GetPlatform(), "CreateComputePipelineSuccess", maybeError.IsSuccess());
 
@@ -2241,7 +2259,9 @@ ResultOrError<Ref<RenderPipelineBase>> DeviceBase::CreateRenderPipeline(
     MaybeError maybeError;
     {
         SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(GetPlatform(), "CreateRenderPipelineUS");
+        double startTime = mMetrics->Now();
         maybeError = uninitializedRenderPipeline->Initialize();
+        mMetrics->RecordPipelineCompilation(startTime);
     }
     DAWN_HISTOGRAM_BOOLEAN(GetPlatform(), "CreateRenderPipelineSuccess", maybeError.IsSuccess());
 
@@ -2418,6 +2438,10 @@ AsyncTaskManager* DeviceBase::GetAsyncTaskManager() const {
     return mAsyncTaskManager.get();
 }
 
+CommandBlockPool* DeviceBase::GetCommandBlockPool() const {
+    return mCommandBlockPool.get();
+}
+
 CallbackTaskManager* DeviceBase::GetCallbackTaskManager() const {
     return mCallbackTaskManager.Get();
 }
@@ -2467,6 +2491,10 @@ bool DeviceBase::ShouldApplyIndexBufferOffsetToFirstIndex() const {
     return false;
 }
 
+bool DeviceBase::ShouldEmulateIndirectDrawCount() const {
+    return false;
+}
+
 bool DeviceBase::CanTextureLoadResolveTargetInTheSameRenderpass() const {
     return false;
 }
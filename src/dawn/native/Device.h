@@ -72,8 +72,10 @@ class AttachmentStateBlueprint;
 class Blob;
 class BlobCache;
 class CallbackTaskManager;
+class CommandBlockPool;
 class DynamicUploader;
 class ErrorScopeStack;
+class MetricsCollector;
 class SharedTextureMemory;
 class OwnedCompilationMessages;
 struct CallbackTask;
@@ -304,6 +306,7 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount<RefCount
     MaybeError ValidateIsAlive() const;
 
     BlobCache* GetBlobCache() const;
+    MetricsCollector* GetMetrics() const;
     Blob LoadCachedBlob(const CacheKey& key);
     void StoreCachedBlob(const CacheKey& key, const Blob& blob);
 
@@ -390,6 +393,11 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount<RefCount
     // See https://crbug.com/dawn/161
     virtual bool ShouldApplyIndexBufferOffsetToFirstIndex() const;
 
+    // Backends without a native draw count for multi-draw indirect always issue maxDrawCount
+    // draws. The indirect draw validation then zeroes the draws past the count in the
+    // drawCountBuffer.
+    virtual bool ShouldEmulateIndirectDrawCount() const;
+
     // Whether the backend can use textureLoad() on a resolve target in the same render pass that it
     // will be resolved into.
     virtual bool CanTextureLoadResolveTargetInTheSameRenderpass() const;
@@ -403,6 +411,7 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount<RefCount
 
     AsyncTaskManager* GetAsyncTaskManager() const;
     CallbackTaskManager* GetCallbackTaskManager() const;
+    CommandBlockPool* GetCommandBlockPool() const;
     dawn::platform::WorkerTaskPool* GetWorkerTaskPool() const;
 
     PipelineCompatibilityToken GetNextPipelineCompatibilityToken();
@@ -563,6 +572,7 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount<RefCount
     Ref<TextureViewBase> mExternalTexturePlaceholderView;
 
     std::unique_ptr<DynamicUploader> mDynamicUploader;
+    std::unique_ptr<CommandBlockPool> mCommandBlockPool;
     Ref<QueueBase> mQueue;
 
     std::atomic<uint32_t> mEmittedCompilationLogCount = 0;
@@ -595,6 +605,8 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount<RefCount
     std::string mLabel;
 
     CacheKey mDeviceCacheKey;
+    // Declared before mBlobCache, which records into it.
+    std::unique_ptr<MetricsCollector> mMetrics;
     std::unique_ptr<BlobCache> mBlobCache;
 
     // We cache this toggle so that we can check it without locking the device.
@@ -32,6 +32,7 @@
 #include "dawn/common/Math.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/Device.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/Queue.h"
 
 namespace dawn::native {
@@ -141,13 +142,20 @@ void DynamicUploader::Deallocate(ExecutionSerial lastCompletedSerial, bool freeA
         }
     }
     mReleasedStagingBuffers.ClearUpTo(lastCompletedSerial);
+    mDevice->GetMetrics()->RecordUploaderRingBufferCount(mRingBuffers.size());
 }
 
 ResultOrError<UploadHandle> DynamicUploader::Allocate(uint64_t allocationSize,
                                                       ExecutionSerial serial,
                                                       uint64_t offsetAlignment) {
     DAWN_ASSERT(offsetAlignment > 0);
-    return AllocateInternal(allocationSize, serial, offsetAlignment);
+    UploadHandle uploadHandle;
+    DAWN_TRY_ASSIGN(uploadHandle, AllocateInternal(allocationSize, serial, offsetAlignment));
+
+    MetricsCollector* metrics = mDevice->GetMetrics();
+    metrics->RecordUploaderAllocation(allocationSize);
+    metrics->RecordUploaderRingBufferCount(mRingBuffers.size());
+    return uploadHandle;
 }
 
 bool DynamicUploader::ShouldFlush() {
@@ -41,6 +41,7 @@ EncodingContext::EncodingContext(DeviceBase* device, const ApiObjectBase* initia
     : mDevice(device),
       mTopLevelEncoder(initialEncoder),
       mCurrentEncoder(initialEncoder),
+      mPendingCommands(device->GetCommandBlockPool()),
       mStatus(Status::Open) {
     DAWN_ASSERT(!initialEncoder->IsError());
 }
@@ -49,6 +50,7 @@ EncodingContext::EncodingContext(DeviceBase* device, ErrorMonad::ErrorTag tag)
     : mDevice(device),
       mTopLevelEncoder(nullptr),
       mCurrentEncoder(nullptr),
+      mPendingCommands(device->GetCommandBlockPool()),
       mStatus(Status::Error) {}
 
 EncodingContext::~EncodingContext() {
@@ -32,9 +32,11 @@
 #include <cstdlib>
 #include <limits>
 #include <memory>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "dawn/common/Constants.h"
 #include "dawn/common/Math.h"
 #include "dawn/native/BindGroup.h"
@@ -62,6 +64,7 @@ constexpr uint32_t kValidationEnabled = 4;
 constexpr uint32_t kIndirectFirstInstanceEnabled = 8;
 constexpr uint32_t kUseFirstIndexToEmulateIndexBufferOffset = 16;
 constexpr uint32_t kIndirectDrawCountBuffer = 32;
+constexpr uint32_t kEmulateIndirectDrawCount = 64;
 
 // Equivalent to the IndirectDraw struct defined in the shader below.
 struct IndirectDraw {
@@ -86,6 +89,7 @@ struct MultiDrawConstants {
     uint32_t drawCountOffsetInElements;
     uint32_t numIndexBufferElementsLow;
     uint32_t numIndexBufferElementsHigh;
+    uint32_t indexOffsetAsNumElements;
     uint32_t flags;
 };
 
@@ -111,6 +115,7 @@ static const char sRenderValidationShaderSource[] = R"(
             const kIndirectFirstInstanceEnabled = 8u;
             const kUseFirstIndexToEmulateIndexBufferOffset = 16u;
             const kIndirectDrawCountBuffer = 32u; // if set, drawCount is read from a buffer
+            const kEmulateIndirectDrawCount = 64u; // if set, draws past drawCount are zeroed
 
             struct MultiDrawConstants {
                 maxDrawCount: u32,
@@ -118,6 +123,7 @@ static const char sRenderValidationShaderSource[] = R"(
                 drawCountOffsetInElements: u32,
                 numIndexBufferElementsLow: u32,
                 numIndexBufferElementsHigh: u32,
+                indexOffsetAsNumElements: u32,
                 flags : u32,
             }
 
@@ -216,6 +222,10 @@ static const char sRenderValidationShaderSource[] = R"(
                 for(var i = 0u; i < numInputParams; i = i + 1u) {
                     outputParams.data[outIndex + i] = inputParams.data[inputOffset + inIndex + i];
                 }
+
+                if (bool(drawConstants.flags & kUseFirstIndexToEmulateIndexBufferOffset)) {
+                    outputParams.data[outIndex + kFirstIndexEntry] += drawConstants.indexOffsetAsNumElements;
+                }
             }
 
             @compute @workgroup_size(kWorkgroupSize, 1, 1)
@@ -283,7 +293,16 @@ static const char sRenderValidationShaderSource[] = R"(
                     drawCount = min(drawCountInBuffer, drawCount);
                 }
 
+                if (id.x >= drawConstants.maxDrawCount) {
+                    return;
+                }
+
                 if (id.x >= drawCount) {
+                    // Backends without a native draw count always issue maxDrawCount draws, so
+                    // the ones past the count in the buffer are turned into empty draws.
+                    if (bool(drawConstants.flags & kEmulateIndirectDrawCount)) {
+                        fail(id.x, drawConstants.flags);
+                    }
                     return;
                 }
 
@@ -456,30 +475,40 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
 
     struct Batch {
         raw_ptr<const IndirectDrawMetadata::IndirectValidationBatch> metadata;
+        raw_ptr<BufferBase> inputIndirectBuffer;
+        uint32_t flags;
         uint64_t dataBufferOffset;
         uint64_t dataSize;
         uint64_t inputIndirectOffset;
         uint64_t inputIndirectSize;
         uint64_t outputParamsOffset;
         uint64_t outputParamsSize;
-        raw_ptr<BatchInfo, AllowPtrArithmetic> batchInfo;
+        uint32_t outputIndirectSize;
+        // Draws with the same parameters in a batch (for example the same draw recorded in
+        // several render bundles) are validated only once. drawSlots[i] is the index of the
+        // validated parameters for metadata->draws[i].
+        uint32_t numUniqueDraws;
+        std::vector<uint32_t> drawSlots;
+    };
+
+    struct MultiDraw {
+        raw_ptr<const IndirectDrawMetadata::IndirectMultiDraw> metadata;
+        uint64_t dataBufferOffset;
+        uint64_t outputParamsOffset;
+        uint64_t outputParamsSize;
     };
 
     struct Pass {
-        uint32_t flags;
-        raw_ptr<BufferBase> inputIndirectBuffer;
-        IndirectDrawMetadata::DrawType drawType;
-        uint64_t outputParamsSize = 0;
         uint64_t batchDataSize = 0;
         std::unique_ptr<void, void (*)(void*)> batchData{nullptr, std::free};
         std::vector<Batch> batches;
+        std::vector<MultiDraw> multiDraws;
     };
 
-    // First stage is grouping all batches into passes. We try to pack as many batches into a
-    // single pass as possible. Batches can be grouped together as long as they're validating
-    // data from the same indirect buffer and draw type, but they may still be split into
-    // multiple passes if the number of draw calls in a pass would exceed some (very high)
-    // upper bound.
+    // First stage is grouping all the validation work into passes. All of the batches, regardless
+    // of their indirect buffer and draw type, as well as the multi draws are packed into a single
+    // compute pass with a single upload of their data. They are only split into multiple passes if
+    // the uploaded data would exceed some (very high) upper bound.
     uint64_t outputParamsSize = 0;
     std::vector<Pass> passes;
     IndirectDrawMetadata::IndexedIndirectBufferValidationInfoMap& bufferInfoMap =
@@ -499,14 +528,48 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
 
     const bool applyIndexBufferOffsetToFirstIndex =
         device->ShouldApplyIndexBufferOffsetToFirstIndex();
+    const bool emulateIndirectDrawCount = device->ShouldEmulateIndirectDrawCount();
+
+    // Returns the pass the data of `dataSize` bytes should be uploaded with, as well as its offset
+    // in the pass' data.
+    auto AllocatePassData = [&](uint64_t dataSize) -> std::pair<Pass*, uint64_t> {
+        if (!passes.empty()) {
+            Pass& currentPass = passes.back();
+            uint64_t nextDataOffset =
+                Align(currentPass.batchDataSize, minStorageBufferOffsetAlignment);
+            if (nextDataOffset + dataSize <= maxStorageBufferBindingSize) {
+                currentPass.batchDataSize = nextDataOffset + dataSize;
+                return {&currentPass, nextDataOffset};
+            }
+        }
+
+        Pass& newPass = passes.emplace_back();
+        newPass.batchDataSize = dataSize;
+        return {&newPass, 0};
+    };
 
     for (auto& [config, validationInfo] : bufferInfoMap) {
         const uint64_t indirectDrawCommandSize =
             config.drawType == IndirectDrawMetadata::DrawType::Indexed ? kDrawIndexedIndirectSize
                                                                        : kDrawIndirectSize;
 
-        uint64_t outputIndirectSize =
-            GetOutputIndirectDrawSize(config.drawType, config.duplicateBaseVertexInstance);
+        uint32_t flags = 0;
+        if (config.duplicateBaseVertexInstance) {
+            flags |= kDuplicateBaseVertexInstance;
+        }
+        if (config.drawType == IndirectDrawMetadata::DrawType::Indexed) {
+            flags |= kIndexedDraw;
+
+            if (applyIndexBufferOffsetToFirstIndex) {
+                flags |= kUseFirstIndexToEmulateIndexBufferOffset;
+            }
+        }
+        if (device->IsValidationEnabled()) {
+            flags |= kValidationEnabled;
+        }
+        if (device->HasFeature(Feature::IndirectFirstInstance)) {
+            flags |= kIndirectFirstInstanceEnabled;
+        }
 
         for (const IndirectDrawMetadata::IndirectValidationBatch& batch :
              validationInfo.GetBatches()) {
@@ -516,61 +579,38 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
 
             Batch newBatch;
             newBatch.metadata = &batch;
-            newBatch.dataSize = GetBatchDataSize(batch.draws.size());
+            newBatch.inputIndirectBuffer = validationInfo.GetIndirectBuffer();
+            newBatch.flags = flags;
             newBatch.inputIndirectOffset = minOffsetAlignedDown;
             newBatch.inputIndirectSize =
                 batch.maxOffset + indirectDrawCommandSize - minOffsetAlignedDown;
+            newBatch.outputIndirectSize =
+                GetOutputIndirectDrawSize(config.drawType, config.duplicateBaseVertexInstance);
+
+            absl::flat_hash_map<std::tuple<uint64_t, uint64_t, uint64_t>, uint32_t> uniqueDraws;
+            newBatch.drawSlots.reserve(batch.draws.size());
+            for (const IndirectDrawMetadata::IndirectDraw& draw : batch.draws) {
+                const uint32_t nextSlot = static_cast<uint32_t>(uniqueDraws.size());
+                auto [it, _] = uniqueDraws.try_emplace(
+                    std::make_tuple(draw.inputBufferOffset, draw.numIndexBufferElements,
+                                    draw.indexBufferOffsetInElements),
+                    nextSlot);
+                newBatch.drawSlots.push_back(it->second);
+            }
+            newBatch.numUniqueDraws = static_cast<uint32_t>(uniqueDraws.size());
+            newBatch.dataSize = GetBatchDataSize(newBatch.numUniqueDraws);
 
-            newBatch.outputParamsSize = batch.draws.size() * outputIndirectSize;
+            newBatch.outputParamsSize =
+                uint64_t(newBatch.numUniqueDraws) * newBatch.outputIndirectSize;
             newBatch.outputParamsOffset = Align(outputParamsSize, minStorageBufferOffsetAlignment);
             outputParamsSize = newBatch.outputParamsOffset + newBatch.outputParamsSize;
             if (outputParamsSize > maxStorageBufferBindingSize) {
                 return DAWN_INTERNAL_ERROR("Too many drawIndexedIndirect calls to validate");
             }
 
-            Pass* currentPass = passes.empty() ? nullptr : &passes.back();
-            if (currentPass &&
-                reinterpret_cast<uintptr_t>(currentPass->inputIndirectBuffer.get()) ==
-                    config.inputIndirectBufferPtr &&
-                currentPass->drawType == config.drawType) {
-                uint64_t nextBatchDataOffset =
-                    Align(currentPass->batchDataSize, minStorageBufferOffsetAlignment);
-                uint64_t newPassBatchDataSize = nextBatchDataOffset + newBatch.dataSize;
-                if (newPassBatchDataSize <= maxStorageBufferBindingSize) {
-                    // We can fit this batch in the current pass.
-                    newBatch.dataBufferOffset = nextBatchDataOffset;
-                    currentPass->batchDataSize = newPassBatchDataSize;
-                    currentPass->batches.push_back(newBatch);
-                    continue;
-                }
-            }
-
-            // We need to start a new pass for this batch.
-            newBatch.dataBufferOffset = 0;
-
-            Pass newPass{};
-            newPass.inputIndirectBuffer = validationInfo.GetIndirectBuffer();
-            newPass.drawType = config.drawType;
-            newPass.batchDataSize = newBatch.dataSize;
-            newPass.batches.push_back(newBatch);
-            newPass.flags = 0;
-            if (config.duplicateBaseVertexInstance) {
-                newPass.flags |= kDuplicateBaseVertexInstance;
-            }
-            if (config.drawType == IndirectDrawMetadata::DrawType::Indexed) {
-                newPass.flags |= kIndexedDraw;
-
-                if (applyIndexBufferOffsetToFirstIndex) {
-                    newPass.flags |= kUseFirstIndexToEmulateIndexBufferOffset;
-                }
-            }
-            if (device->IsValidationEnabled()) {
-                newPass.flags |= kValidationEnabled;
-            }
-            if (device->HasFeature(Feature::IndirectFirstInstance)) {
-                newPass.flags |= kIndirectFirstInstanceEnabled;
-            }
-            passes.push_back(std::move(newPass));
+            auto [pass, dataBufferOffset] = AllocatePassData(newBatch.dataSize);
+            newBatch.dataBufferOffset = dataBufferOffset;
+            pass->batches.push_back(std::move(newBatch));
         }
     }
 
@@ -579,31 +619,44 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
     outputParamsSize = Align(outputParamsSize, minStorageBufferOffsetAlignment);
     const uint64_t multiDrawOutputParamsOffset = outputParamsSize;
 
-    uint64_t outputParamsSizeForMultiDraw = 0;
     if (!skipMultiDrawValidation) {
-        // Calculate size of output params for multi draws
         for (auto& draw : multiDraws) {
             // Multi draw metadatas are added even if validation is disabled, because the Metal
             // backend needs to convert all multi draws into an ICB. If validation is disabled,
             // and the draw doesn't need duplication of base vertex and instance, we can skip
             // the compute pass. In general, non-indexed multi draws don't need validation.
+            // The pass is still needed when the backend has to fold the index buffer offset
+            // into firstIndex, or has to emulate the draw count buffer.
+            const bool needsIndexBufferOffsetApplied =
+                draw.type == IndirectDrawMetadata::DrawType::Indexed &&
+                applyIndexBufferOffsetToFirstIndex;
+            const bool needsDrawCountEmulated =
+                draw.cmd->drawCountBuffer != nullptr && emulateIndirectDrawCount;
             if ((draw.type == IndirectDrawMetadata::DrawType::NonIndexed ||
                  !device->IsValidationEnabled()) &&
-                !draw.duplicateBaseVertexInstance) {
+                !draw.duplicateBaseVertexInstance && !needsIndexBufferOffsetApplied &&
+                !needsDrawCountEmulated) {
                 // We will use the original indirect buffer directly as the indirect buffer.
                 usageTracker->BufferUsedAs(draw.cmd->indirectBuffer.Get(),
                                            kIndirectBufferForBackendResourceTracking);
                 continue;
             }
-            outputParamsSizeForMultiDraw +=
+
+            MultiDraw newMultiDraw;
+            newMultiDraw.metadata = &draw;
+            newMultiDraw.outputParamsOffset = outputParamsSize;
+            newMultiDraw.outputParamsSize =
                 draw.cmd->maxDrawCount *
                 GetOutputIndirectDrawSize(draw.type, draw.duplicateBaseVertexInstance);
-            outputParamsSizeForMultiDraw =
-                Align(outputParamsSizeForMultiDraw, minStorageBufferOffsetAlignment);
-
-            if (outputParamsSizeForMultiDraw > maxStorageBufferBindingSize) {
+            outputParamsSize = Align(newMultiDraw.outputParamsOffset + newMultiDraw.outputParamsSize,
+                                     minStorageBufferOffsetAlignment);
+            if (outputParamsSize - multiDrawOutputParamsOffset > maxStorageBufferBindingSize) {
                 return DAWN_INTERNAL_ERROR("Too many multiDrawIndexedIndirect calls to validate");
             }
+
+            auto [pass, dataBufferOffset] = AllocatePassData(sizeof(MultiDrawConstants));
+            newMultiDraw.dataBufferOffset = dataBufferOffset;
+            pass->multiDraws.push_back(newMultiDraw);
         }
     } else {
         // If we're skipping multi draw validation, we still need to track the indirect buffer
@@ -614,12 +667,10 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
         }
     }
 
-    outputParamsSize += outputParamsSizeForMultiDraw;
-
     // If there are no output params to validate, we can skip the rest of the encoding.
     // The above .empty() checks are not sufficient because there might exist non-indexed multi
     // draws, which don't need validation.
-    if (outputParamsSize == 0) {
+    if (passes.empty()) {
         return {};
     }
 
@@ -631,10 +682,6 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
     for (const Pass& pass : passes) {
         requiredBatchDataBufferSize = std::max(requiredBatchDataBufferSize, pass.batchDataSize);
     }
-    // Needs to at least be able to store a MultiDrawConstants struct for the multi draw
-    // validation.
-    requiredBatchDataBufferSize =
-        std::max(requiredBatchDataBufferSize, static_cast<uint64_t>(sizeof(MultiDrawConstants)));
 
     DAWN_TRY(outputParamsBuffer.EnsureCapacity(outputParamsSize));
     DAWN_TRY(batchDataBuffer.EnsureCapacity(requiredBatchDataBufferSize));
@@ -652,14 +699,18 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
         memset(pass.batchData.get(), 0, pass.batchDataSize);
         uint8_t* batchData = static_cast<uint8_t*>(pass.batchData.get());
         for (Batch& batch : pass.batches) {
-            batch.batchInfo = new (&batchData[batch.dataBufferOffset]) BatchInfo();
-            batch.batchInfo->numDraws = static_cast<uint32_t>(batch.metadata->draws.size());
-            batch.batchInfo->flags = pass.flags;
+            BatchInfo* batchInfo = new (&batchData[batch.dataBufferOffset]) BatchInfo();
+            batchInfo->numDraws = batch.numUniqueDraws;
+            batchInfo->flags = batch.flags;
+
+            IndirectDraw* indirectDraws = reinterpret_cast<IndirectDraw*>(batchInfo + 1);
+            const auto& draws = batch.metadata->draws;
+            for (size_t i = 0; i < draws.size(); ++i) {
+                const IndirectDrawMetadata::IndirectDraw& draw = draws[i];
+                const uint32_t slot = batch.drawSlots[i];
 
-            IndirectDraw* indirectDraw = reinterpret_cast<IndirectDraw*>(batch.batchInfo.get() + 1);
-            uint64_t outputParamsOffset = batch.outputParamsOffset;
-            for (auto& draw : batch.metadata->draws) {
                 // The shader uses this to index an array of u32, hence the division by 4 bytes.
+                IndirectDraw* indirectDraw = &indirectDraws[slot];
                 indirectDraw->indirectOffset =
                     static_cast<uint32_t>((draw.inputBufferOffset - batch.inputIndirectOffset) / 4);
                 // The index buffer elements are 64 bit values, and so need to be set as a
@@ -671,63 +722,111 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
 
                 // This is only used in the GL backend.
                 indirectDraw->indexOffsetAsNumElements = draw.indexBufferOffsetInElements;
-                indirectDraw++;
 
                 draw.cmd->indirectBuffer = outputParamsBuffer.GetBuffer();
-                draw.cmd->indirectOffset = outputParamsOffset;
-                if (pass.flags & kIndexedDraw) {
-                    outputParamsOffset += kDrawIndexedIndirectSize;
-                } else {
-                    outputParamsOffset += kDrawIndirectSize;
+                draw.cmd->indirectOffset =
+                    batch.outputParamsOffset + uint64_t(slot) * batch.outputIndirectSize;
+            }
+        }
+
+        for (const MultiDraw& multiDraw : pass.multiDraws) {
+            const IndirectDrawMetadata::IndirectMultiDraw& draw = *multiDraw.metadata;
+            // Same struct for both indexed and non-indexed draws.
+            const MultiDrawIndirectCmd* cmd = draw.cmd;
+
+            uint64_t numIndexBufferElements = 0;
+            uint64_t indexBufferOffsetInElements = 0;
+            if (draw.type == IndirectDrawMetadata::DrawType::Indexed) {
+                const size_t formatSize = IndexFormatSize(draw.indexFormat);
+                numIndexBufferElements = draw.indexBufferSize / formatSize;
+                indexBufferOffsetInElements = draw.indexBufferOffsetInBytes / formatSize;
+            }
+
+            MultiDrawConstants* drawConstants =
+                new (&batchData[multiDraw.dataBufferOffset]) MultiDrawConstants();
+            drawConstants->maxDrawCount = cmd->maxDrawCount;
+            // We need to pass the remaining offset in elements after aligning to the
+            // minStorageBufferOffsetAlignment. See comment below.
+            drawConstants->indirectOffsetInElements = static_cast<uint32_t>(
+                (cmd->indirectOffset % minStorageBufferOffsetAlignment) / sizeof(uint32_t));
+            drawConstants->drawCountOffsetInElements = static_cast<uint32_t>(
+                (cmd->drawCountOffset % minStorageBufferOffsetAlignment) / sizeof(uint32_t));
+            drawConstants->numIndexBufferElementsLow =
+                static_cast<uint32_t>(numIndexBufferElements & 0xFFFFFFFF);
+            drawConstants->numIndexBufferElementsHigh =
+                static_cast<uint32_t>((numIndexBufferElements >> 32) & 0xFFFFFFFF);
+            // This is only used in the GL backend.
+            drawConstants->indexOffsetAsNumElements =
+                static_cast<uint32_t>(indexBufferOffsetInElements);
+
+            drawConstants->flags = 0;
+            if (device->IsValidationEnabled()) {
+                drawConstants->flags |= kValidationEnabled;
+            }
+            if (draw.type == IndirectDrawMetadata::DrawType::Indexed) {
+                drawConstants->flags |= kIndexedDraw;
+
+                if (applyIndexBufferOffsetToFirstIndex) {
+                    drawConstants->flags |= kUseFirstIndexToEmulateIndexBufferOffset;
                 }
-                if (pass.flags & kDuplicateBaseVertexInstance) {
-                    // Add the extra offset for the duplicated base vertex and instance.
-                    outputParamsOffset += 2 * sizeof(uint32_t);
+            }
+            if (cmd->drawCountBuffer != nullptr) {
+                drawConstants->flags |= kIndirectDrawCountBuffer;
+
+                if (emulateIndirectDrawCount) {
+                    drawConstants->flags |= kEmulateIndirectDrawCount;
                 }
             }
+            if (draw.duplicateBaseVertexInstance) {
+                drawConstants->flags |= kDuplicateBaseVertexInstance;
+            }
         }
     }
-    if (!passes.empty()) {
-        ComputePipelineBase* pipeline;
-        DAWN_TRY_ASSIGN(pipeline, GetOrCreateIndirectDrawValidationPipeline(device));
 
-        Ref<BindGroupLayoutBase> layout;
-        DAWN_TRY_ASSIGN(layout, pipeline->GetBindGroupLayout(0));
+    ComputePipelineBase* batchPipeline = nullptr;
+    Ref<BindGroupLayoutBase> batchLayout;
+    ComputePipelineBase* multiDrawPipeline = nullptr;
+    Ref<BindGroupLayoutBase> multiDrawLayout;
 
-        BindGroupEntry bindings[3];
-        BindGroupEntry& bufferDataBinding = bindings[0];
-        bufferDataBinding.binding = 0;
-        bufferDataBinding.buffer = batchDataBuffer.GetBuffer();
+    // Finally, we can now encode our validation and duplication passes. Each pass first does a
+    // WriteBuffer to get all of its data over to the GPU, followed by a single compute pass. The
+    // compute pass sets each validation pipeline once and encodes a separate SetBindGroup and
+    // Dispatch command for each batch or multi draw.
+    for (const Pass& pass : passes) {
+        commandEncoder->APIWriteBuffer(batchDataBuffer.GetBuffer(), 0,
+                                       static_cast<const uint8_t*>(pass.batchData.get()),
+                                       pass.batchDataSize);
 
-        BindGroupEntry& inputIndirectBinding = bindings[1];
-        inputIndirectBinding.binding = 1;
+        Ref<ComputePassEncoder> passEncoder = commandEncoder->BeginComputePass();
 
-        BindGroupEntry& outputParamsBinding = bindings[2];
-        outputParamsBinding.binding = 2;
-        outputParamsBinding.buffer = outputParamsBuffer.GetBuffer();
+        if (!pass.batches.empty()) {
+            if (batchPipeline == nullptr) {
+                DAWN_TRY_ASSIGN(batchPipeline, GetOrCreateIndirectDrawValidationPipeline(device));
+                DAWN_TRY_ASSIGN(batchLayout, batchPipeline->GetBindGroupLayout(0));
+            }
+            passEncoder->APISetPipeline(batchPipeline);
 
-        BindGroupDescriptor bindGroupDescriptor = {};
-        bindGroupDescriptor.layout = layout.Get();
-        bindGroupDescriptor.entryCount = 3;
-        bindGroupDescriptor.entries = bindings;
+            BindGroupEntry bindings[3];
+            BindGroupEntry& bufferDataBinding = bindings[0];
+            bufferDataBinding.binding = 0;
+            bufferDataBinding.buffer = batchDataBuffer.GetBuffer();
 
-        // Finally, we can now encode our validation and duplication passes. Each pass first
-        // does a WriteBuffer to get batch and pass data over to the GPU, followed by a single
-        // compute pass. The compute pass encodes a separate SetBindGroup and Dispatch command
-        // for each batch.
-        for (const Pass& pass : passes) {
-            commandEncoder->APIWriteBuffer(batchDataBuffer.GetBuffer(), 0,
-                                           static_cast<const uint8_t*>(pass.batchData.get()),
-                                           pass.batchDataSize);
+            BindGroupEntry& inputIndirectBinding = bindings[1];
+            inputIndirectBinding.binding = 1;
 
-            Ref<ComputePassEncoder> passEncoder = commandEncoder->BeginComputePass();
-            passEncoder->APISetPipeline(pipeline);
+            BindGroupEntry& outputParamsBinding = bindings[2];
+            outputParamsBinding.binding = 2;
+            outputParamsBinding.buffer = outputParamsBuffer.GetBuffer();
 
-            inputIndirectBinding.buffer = pass.inputIndirectBuffer;
+            BindGroupDescriptor bindGroupDescriptor = {};
+            bindGroupDescriptor.layout = batchLayout.Get();
+            bindGroupDescriptor.entryCount = 3;
+            bindGroupDescriptor.entries = bindings;
 
             for (const Batch& batch : pass.batches) {
                 bufferDataBinding.offset = batch.dataBufferOffset;
                 bufferDataBinding.size = batch.dataSize;
+                inputIndirectBinding.buffer = batch.inputIndirectBuffer;
                 inputIndirectBinding.offset = batch.inputIndirectOffset;
                 inputIndirectBinding.size = batch.inputIndirectSize;
                 outputParamsBinding.offset = batch.outputParamsOffset;
@@ -737,154 +836,93 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
                 DAWN_TRY_ASSIGN(bindGroup, device->CreateBindGroup(&bindGroupDescriptor));
 
                 const uint32_t numDrawsRoundedUp =
-                    (batch.batchInfo->numDraws + kWorkgroupSize - 1) / kWorkgroupSize;
+                    (batch.numUniqueDraws + kWorkgroupSize - 1) / kWorkgroupSize;
                 passEncoder->APISetBindGroup(0, bindGroup.Get());
                 passEncoder->APIDispatchWorkgroups(numDrawsRoundedUp);
             }
-
-            passEncoder->APIEnd();
         }
-    }
-    if (!multiDraws.empty() && !skipMultiDrawValidation) {
-        ScratchBuffer& drawConstantsBuffer = store->scratchStorage;
 
-        ComputePipelineBase* pipeline;
-        DAWN_TRY_ASSIGN(pipeline, GetOrCreateMultiDrawValidationPipeline(device));
-
-        Ref<BindGroupLayoutBase> layout;
-        DAWN_TRY_ASSIGN(layout, pipeline->GetBindGroupLayout(0));
-
-        BindGroupEntry bindings[4];
-
-        BindGroupEntry& drawConstantsBinding = bindings[0];
-        drawConstantsBinding.binding = 0;
-        drawConstantsBinding.buffer = drawConstantsBuffer.GetBuffer();
-
-        BindGroupEntry& inputIndirectBinding = bindings[1];
-        inputIndirectBinding.binding = 1;
-
-        BindGroupEntry& outputParamsBinding = bindings[2];
-        outputParamsBinding.binding = 2;
-        outputParamsBinding.buffer = outputParamsBuffer.GetBuffer();
-
-        BindGroupEntry& drawCountBinding = bindings[3];
-        drawCountBinding.binding = 3;
-
-        BindGroupDescriptor bindGroupDescriptor = {};
-        bindGroupDescriptor.layout = layout.Get();
-        bindGroupDescriptor.entryCount = 4;
-        bindGroupDescriptor.entries = bindings;
-
-        // Start of the region for multi draw output params.
-        uint64_t outputOffset = multiDrawOutputParamsOffset;
-
-        for (auto& draw : multiDraws) {
-            // If the draw meets these conditions, there is no need to run the compute pass,
-            // and there is no space allocated for the output params
-            if ((draw.type == IndirectDrawMetadata::DrawType::NonIndexed ||
-                 !device->IsValidationEnabled()) &&
-                !draw.duplicateBaseVertexInstance) {
-                continue;
+        if (!pass.multiDraws.empty()) {
+            if (multiDrawPipeline == nullptr) {
+                DAWN_TRY_ASSIGN(multiDrawPipeline, GetOrCreateMultiDrawValidationPipeline(device));
+                DAWN_TRY_ASSIGN(multiDrawLayout, multiDrawPipeline->GetBindGroupLayout(0));
             }
+            passEncoder->APISetPipeline(multiDrawPipeline);
 
-            uint64_t numIndexBufferElements = 0;
-            if (draw.type == IndirectDrawMetadata::DrawType::Indexed) {
-                const size_t formatSize = IndexFormatSize(draw.indexFormat);
-                numIndexBufferElements = draw.indexBufferSize / formatSize;
-            }
+            BindGroupEntry bindings[4];
 
-            // Same struct for both indexed and non-indexed draws.
-            MultiDrawIndirectCmd* cmd = draw.cmd;
+            BindGroupEntry& drawConstantsBinding = bindings[0];
+            drawConstantsBinding.binding = 0;
+            drawConstantsBinding.buffer = batchDataBuffer.GetBuffer();
+            drawConstantsBinding.size = sizeof(MultiDrawConstants);
 
-            // Align the output offset to the minStorageBufferOffsetAlignment.
+            BindGroupEntry& inputIndirectBinding = bindings[1];
+            inputIndirectBinding.binding = 1;
 
-            MultiDrawConstants drawConstants;
-            drawConstants.maxDrawCount = draw.cmd->maxDrawCount;
-            // We need to pass the remaining offset in elements after aligning to the
-            // minStorageBufferOffsetAlignment. See comment below.
-            drawConstants.indirectOffsetInElements = static_cast<uint32_t>(
-                (cmd->indirectOffset % minStorageBufferOffsetAlignment) / sizeof(uint32_t));
-            drawConstants.drawCountOffsetInElements = static_cast<uint32_t>(
-                (cmd->drawCountOffset % minStorageBufferOffsetAlignment) / sizeof(uint32_t));
-            drawConstants.numIndexBufferElementsLow =
-                static_cast<uint32_t>(numIndexBufferElements & 0xFFFFFFFF);
-            drawConstants.numIndexBufferElementsHigh =
-                static_cast<uint32_t>((numIndexBufferElements >> 32) & 0xFFFFFFFF);
+            BindGroupEntry& outputParamsBinding = bindings[2];
+            outputParamsBinding.binding = 2;
+            outputParamsBinding.buffer = outputParamsBuffer.GetBuffer();
 
-            drawConstants.flags = 0;
-            if (device->IsValidationEnabled()) {
-                drawConstants.flags |= kValidationEnabled;
-            }
-            if (draw.type == IndirectDrawMetadata::DrawType::Indexed) {
-                drawConstants.flags |= kIndexedDraw;
-            }
-            if (cmd->drawCountBuffer != nullptr) {
-                drawConstants.flags |= kIndirectDrawCountBuffer;
-            }
-            if (draw.duplicateBaseVertexInstance) {
-                drawConstants.flags |= kDuplicateBaseVertexInstance;
-            }
+            BindGroupEntry& drawCountBinding = bindings[3];
+            drawCountBinding.binding = 3;
+
+            BindGroupDescriptor bindGroupDescriptor = {};
+            bindGroupDescriptor.layout = multiDrawLayout.Get();
+            bindGroupDescriptor.entryCount = 4;
+            bindGroupDescriptor.entries = bindings;
+
+            for (const MultiDraw& multiDraw : pass.multiDraws) {
+                MultiDrawIndirectCmd* cmd = multiDraw.metadata->cmd;
+
+                drawConstantsBinding.offset = multiDraw.dataBufferOffset;
+
+                inputIndirectBinding.buffer = cmd->indirectBuffer.Get();
+                // We can't use the offset directly because the indirect offset is guaranteed to
+                // be aligned to 4 bytes, but when binding the buffer alignment requirement is
+                // minStorageBufferOffsetAlignment. Instead we align the offset to the
+                // minStorageBufferOffsetAlignment. Then pass the remaining offset in elements.
+                inputIndirectBinding.offset =
+                    AlignDown(cmd->indirectOffset, minStorageBufferOffsetAlignment);
+
+                outputParamsBinding.offset = multiDraw.outputParamsOffset;
+                outputParamsBinding.size = multiDraw.outputParamsSize;
+
+                if (cmd->drawCountBuffer != nullptr) {
+                    // If the drawCountBuffer is set, we need to bind it to the bind group.
+                    // The drawCountBuffer is used to read the drawCount for the multi draw call.
+                    // If the drawCount exceeds the maxDrawCount, it will be clamped to
+                    // maxDrawCount.
+                    drawCountBinding.buffer = cmd->drawCountBuffer.Get();
+                    drawCountBinding.offset =
+                        AlignDown(cmd->drawCountOffset, minStorageBufferOffsetAlignment);
+                } else {
+                    // This is an unused binding.
+                    // Bind group entry for the drawCountBuffer is not needed however we need to
+                    // bind something else than nullptr to the bind group entry to avoid
+                    // validation errors. This buffer is never used in the shader, since there is
+                    // a flag (kIndirectDrawCountBuffer) to check if the drawCountBuffer is set.
+                    drawCountBinding.buffer = cmd->indirectBuffer.Get();
+                    drawCountBinding.offset = 0;
+                }
 
-            inputIndirectBinding.buffer = cmd->indirectBuffer.Get();
-            // We can't use the offset directly because the indirect offset is guaranteed to
-            // be aligned to 4 bytes, but when binding the buffer alignment requirement is
-            // minStorageBufferOffsetAlignment. Instead we align the offset to the
-            // minStorageBufferOffsetAlignment. Then pass the remaining offset in elements.
-            inputIndirectBinding.offset =
-                AlignDown(cmd->indirectOffset, minStorageBufferOffsetAlignment);
+                Ref<BindGroupBase> bindGroup;
+                DAWN_TRY_ASSIGN(bindGroup, device->CreateBindGroup(&bindGroupDescriptor));
+                passEncoder->APISetBindGroup(0, bindGroup.Get());
 
-            outputParamsBinding.buffer = outputParamsBuffer.GetBuffer();
-            outputParamsBinding.offset = outputOffset;
-            outputParamsBinding.size =
-                draw.cmd->maxDrawCount *
-                GetOutputIndirectDrawSize(draw.type, draw.duplicateBaseVertexInstance);
+                uint32_t workgroupCount = cmd->maxDrawCount / kWorkgroupSize;
+                // Integer division rounds down so adding 1 if there is a remainder.
+                workgroupCount += cmd->maxDrawCount % kWorkgroupSize == 0 ? 0 : 1;
+                passEncoder->APIDispatchWorkgroups(workgroupCount);
 
-            if (cmd->drawCountBuffer != nullptr) {
-                // If the drawCountBuffer is set, we need to bind it to the bind group.
-                // The drawCountBuffer is used to read the drawCount for the multi draw call.
-                // If the drawCount exceeds the maxDrawCount, it will be clamped to
-                // maxDrawCount.
-                drawCountBinding.buffer = cmd->drawCountBuffer.Get();
-                drawCountBinding.offset =
-                    AlignDown(cmd->drawCountOffset, minStorageBufferOffsetAlignment);
-            } else {
-                // This is an unused binding.
-                // Bind group entry for the drawCountBuffer is not needed however we need to
-                // bind something else than nullptr to the bind group entry to avoid validation
-                // errors. This buffer is never used in the shader, since there is a flag
-                // (kIndirectDrawCountBuffer) to check if the drawCountBuffer is set.
-                drawCountBinding.buffer = cmd->indirectBuffer.Get();
-                drawCountBinding.offset = 0;
+                // Update the draw command to use the validated indirect buffer.
+                // The drawCountBuffer doesn't need to be updated because if it exceeds the
+                // maxDrawCount it will be clamped to maxDrawCount.
+                cmd->indirectBuffer = outputParamsBuffer.GetBuffer();
+                cmd->indirectOffset = multiDraw.outputParamsOffset;
             }
-
-            Ref<BindGroupBase> bindGroup;
-            DAWN_TRY_ASSIGN(bindGroup, device->CreateBindGroup(&bindGroupDescriptor));
-
-            commandEncoder->APIWriteBuffer(drawConstantsBuffer.GetBuffer(), 0,
-                                           reinterpret_cast<const uint8_t*>(&drawConstants),
-                                           sizeof(MultiDrawConstants));
-
-            Ref<ComputePassEncoder> passEncoder = commandEncoder->BeginComputePass();
-            passEncoder->APISetPipeline(pipeline);
-            passEncoder->APISetBindGroup(0, bindGroup.Get());
-
-            uint32_t workgroupCount = cmd->maxDrawCount / kWorkgroupSize;
-            // Integer division rounds down so adding 1 if there is a remainder.
-            workgroupCount += cmd->maxDrawCount % kWorkgroupSize == 0 ? 0 : 1;
-            passEncoder->APIDispatchWorkgroups(workgroupCount);
-            passEncoder->APIEnd();
-
-            // Update the draw command to use the validated indirect buffer.
-            // The drawCountBuffer doesn't need to be updated because if it exceeds the
-            // maxDrawCount it will be clamped to maxDrawCount.
-            cmd->indirectBuffer = outputParamsBuffer.GetBuffer();
-            cmd->indirectOffset = outputOffset;
-
-            // Proceed to the next output offset.
-            outputOffset += cmd->maxDrawCount *
-                            GetOutputIndirectDrawSize(draw.type, draw.duplicateBaseVertexInstance);
-            outputOffset = Align(outputOffset, minStorageBufferOffsetAlignment);
         }
+
+        passEncoder->APIEnd();
     }
 
     return {};
@@ -0,0 +1,189 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/MetricsCollector.h"
+
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/metrics/HistogramMacros.h"
+
+namespace dawn::native {
+
+namespace {
+
+void AtomicMax(std::atomic<uint64_t>* value, uint64_t sample) {
+    uint64_t current = value->load(std::memory_order_relaxed);
+    while (current < sample &&
+           !value->compare_exchange_weak(current, sample, std::memory_order_relaxed)) {
+    }
+}
+
+void AtomicAdd(std::atomic<uint64_t>* value, uint64_t amount) {
+    value->fetch_add(amount, std::memory_order_relaxed);
+}
+
+uint64_t Load(const std::atomic<uint64_t>& value) {
+    return value.load(std::memory_order_relaxed);
+}
+
+}  // anonymous namespace
+
+MetricsCollector::MetricsCollector(dawn::platform::Platform* platform) : mPlatform(platform) {}
+
+MetricsCollector::~MetricsCollector() = default;
+
+double MetricsCollector::Now() const {
+    return mPlatform->MonotonicallyIncreasingTime();
+}
+
+uint64_t MetricsCollector::ElapsedMicroseconds(double startTime) const {
+    if (startTime == 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>((Now() - startTime) * 1'000'000.0);
+}
+
+void MetricsCollector::RecordPipelineCacheHit() {
+    AtomicAdd(&mPipelineCacheHits, 1);
+    DAWN_HISTOGRAM_BOOLEAN(mPlatform, "PipelineCacheHit", true);
+}
+
+void MetricsCollector::RecordPipelineCompilation(double startTime) {
+    AtomicAdd(&mPipelineCompilations, 1);
+    AtomicAdd(&mPipelineCompilationMicroseconds, ElapsedMicroseconds(startTime));
+    DAWN_HISTOGRAM_BOOLEAN(mPlatform, "PipelineCacheHit", false);
+}
+
+void MetricsCollector::RecordBlobCacheLoad(size_t size) {
+    if (size == 0) {
+        AtomicAdd(&mBlobCacheMisses, 1);
+    } else {
+        AtomicAdd(&mBlobCacheHits, 1);
+        AtomicAdd(&mBlobCacheBytesLoaded, size);
+    }
+    DAWN_HISTOGRAM_BOOLEAN(mPlatform, "BlobCacheHit", size != 0);
+}
+
+void MetricsCollector::RecordBlobCacheStore(size_t size) {
+    AtomicAdd(&mBlobCacheBytesStored, size);
+}
+
+void MetricsCollector::RecordUploaderAllocation(uint64_t size) {
+    AtomicAdd(&mUploaderBytesAllocated, size);
+}
+
+void MetricsCollector::RecordUploaderRingBufferCount(uint64_t count) {
+    if (mUploaderRingBufferCount.exchange(count, std::memory_order_relaxed) == count) {
+        return;
+    }
+    AtomicMax(&mUploaderPeakRingBufferCount, count);
+    DAWN_HISTOGRAM_COUNTS_100(mPlatform, "DynamicUploaderRingBufferCount", static_cast<int>(count));
+}
+
+void MetricsCollector::RecordCommandEncoderFinish(double startTime) {
+    uint64_t elapsedUS = ElapsedMicroseconds(startTime);
+    AtomicAdd(&mCommandBuffersFinished, 1);
+    AtomicAdd(&mCommandEncoderFinishMicroseconds, elapsedUS);
+    if (startTime != 0) {
+        DAWN_HISTOGRAM_CUSTOM_MICROSECOND_TIMES(mPlatform, "CommandEncoderFinishUS",
+                                                static_cast<int>(elapsedUS), 1, 1'000'000, 50);
+    }
+}
+
+void MetricsCollector::RecordSubmit(double startTime, uint32_t commandBufferCount) {
+    uint64_t elapsedUS = ElapsedMicroseconds(startTime);
+    AtomicAdd(&mSubmits, 1);
+    AtomicAdd(&mCommandBuffersSubmitted, commandBufferCount);
+    AtomicAdd(&mSubmitMicroseconds, elapsedUS);
+    if (startTime != 0) {
+        DAWN_HISTOGRAM_CUSTOM_MICROSECOND_TIMES(mPlatform, "QueueSubmitUS",
+                                                static_cast<int>(elapsedUS), 1, 1'000'000, 50);
+    }
+}
+
+void MetricsCollector::RecordDescriptorPoolCreation() {
+    AtomicAdd(&mDescriptorPoolsCreated, 1);
+}
+
+void MetricsCollector::RecordDeferredDeletionQueueDepth(uint64_t depth) {
+    if (mDeferredDeletionQueueDepth.exchange(depth, std::memory_order_relaxed) == depth) {
+        return;
+    }
+    AtomicMax(&mPeakDeferredDeletionQueueDepth, depth);
+    DAWN_HISTOGRAM_COUNTS_10000(mPlatform, "DeferredDeletionQueueDepth", static_cast<int>(depth));
+}
+
+void MetricsCollector::RecordBackgroundDeletionQueueDepth(uint64_t depth) {
+    if (mBackgroundDeletionQueueDepth.exchange(depth, std::memory_order_relaxed) == depth) {
+        return;
+    }
+    AtomicMax(&mPeakBackgroundDeletionQueueDepth, depth);
+    DAWN_HISTOGRAM_COUNTS_10000(mPlatform, "BackgroundDeletionQueueDepth",
+                                static_cast<int>(depth));
+}
+
+void MetricsCollector::RecordBackgroundDeletions(uint64_t count) {
+    AtomicAdd(&mBackgroundDeletions, count);
+}
+
+void MetricsCollector::RecordSuballocationMemory(uint64_t heapBytes,
+                                                 uint64_t slabBytes,
+                                                 uint64_t slabBytesInUse) {
+    mSuballocationHeapBytes.store(heapBytes, std::memory_order_relaxed);
+    mSlabBytes.store(slabBytes, std::memory_order_relaxed);
+    mSlabBytesInUse.store(slabBytesInUse, std::memory_order_relaxed);
+}
+
+DeviceMetrics MetricsCollector::GetMetrics() const {
+    DeviceMetrics metrics;
+    metrics.pipelineCacheHits = Load(mPipelineCacheHits);
+    metrics.pipelineCompilations = Load(mPipelineCompilations);
+    metrics.pipelineCompilationMicroseconds = Load(mPipelineCompilationMicroseconds);
+    metrics.blobCacheHits = Load(mBlobCacheHits);
+    metrics.blobCacheMisses = Load(mBlobCacheMisses);
+    metrics.blobCacheBytesLoaded = Load(mBlobCacheBytesLoaded);
+    metrics.blobCacheBytesStored = Load(mBlobCacheBytesStored);
+    metrics.uploaderBytesAllocated = Load(mUploaderBytesAllocated);
+    metrics.uploaderRingBufferCount = Load(mUploaderRingBufferCount);
+    metrics.uploaderPeakRingBufferCount = Load(mUploaderPeakRingBufferCount);
+    metrics.commandBuffersFinished = Load(mCommandBuffersFinished);
+    metrics.commandEncoderFinishMicroseconds = Load(mCommandEncoderFinishMicroseconds);
+    metrics.submits = Load(mSubmits);
+    metrics.commandBuffersSubmitted = Load(mCommandBuffersSubmitted);
+    metrics.submitMicroseconds = Load(mSubmitMicroseconds);
+    metrics.descriptorPoolsCreated = Load(mDescriptorPoolsCreated);
+    metrics.deferredDeletionQueueDepth = Load(mDeferredDeletionQueueDepth);
+    metrics.peakDeferredDeletionQueueDepth = Load(mPeakDeferredDeletionQueueDepth);
+    metrics.backgroundDeletionQueueDepth = Load(mBackgroundDeletionQueueDepth);
+    metrics.peakBackgroundDeletionQueueDepth = Load(mPeakBackgroundDeletionQueueDepth);
+    metrics.backgroundDeletions = Load(mBackgroundDeletions);
+    metrics.suballocationHeapBytes = Load(mSuballocationHeapBytes);
+    metrics.slabBytes = Load(mSlabBytes);
+    metrics.slabBytesInUse = Load(mSlabBytesInUse);
+    return metrics;
+}
+
+}  // namespace dawn::native
@@ -0,0 +1,111 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_METRICSCOLLECTOR_H_
+#define SRC_DAWN_NATIVE_METRICSCOLLECTOR_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "dawn/native/DawnNative.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::platform {
+class Platform;
+}
+
+namespace dawn::native {
+
+// Collects the per-device counters returned by dawn::native::GetDeviceMetrics() and forwards
+// samples to the platform's histograms. Counters are relaxed atomics so they can be updated from
+// any thread without holding the device lock. Durations are measured with the platform's clock,
+// and are not recorded when the platform doesn't provide one.
+class MetricsCollector {
+  public:
+    explicit MetricsCollector(dawn::platform::Platform* platform);
+    ~MetricsCollector();
+
+    // Returns the start time to pass to the Record* functions that take one, or 0 if the
+    // platform has no clock.
+    double Now() const;
+
+    void RecordPipelineCacheHit();
+    void RecordPipelineCompilation(double startTime);
+
+    // A load of 0 bytes is a cache miss.
+    void RecordBlobCacheLoad(size_t size);
+    void RecordBlobCacheStore(size_t size);
+
+    void RecordUploaderAllocation(uint64_t size);
+    void RecordUploaderRingBufferCount(uint64_t count);
+
+    void RecordCommandEncoderFinish(double startTime);
+    void RecordSubmit(double startTime, uint32_t commandBufferCount);
+
+    void RecordDescriptorPoolCreation();
+    void RecordDeferredDeletionQueueDepth(uint64_t depth);
+    void RecordBackgroundDeletionQueueDepth(uint64_t depth);
+    void RecordBackgroundDeletions(uint64_t count);
+    void RecordSuballocationMemory(uint64_t heapBytes, uint64_t slabBytes, uint64_t slabBytesInUse);
+
+    DeviceMetrics GetMetrics() const;
+
+  private:
+    // Returns the microseconds elapsed since `startTime`, or 0 if there is no clock.
+    uint64_t ElapsedMicroseconds(double startTime) const;
+
+    const raw_ptr<dawn::platform::Platform> mPlatform;
+
+    std::atomic<uint64_t> mPipelineCacheHits{0};
+    std::atomic<uint64_t> mPipelineCompilations{0};
+    std::atomic<uint64_t> mPipelineCompilationMicroseconds{0};
+    std::atomic<uint64_t> mBlobCacheHits{0};
+    std::atomic<uint64_t> mBlobCacheMisses{0};
+    std::atomic<uint64_t> mBlobCacheBytesLoaded{0};
+    std::atomic<uint64_t> mBlobCacheBytesStored{0};
+    std::atomic<uint64_t> mUploaderBytesAllocated{0};
+    std::atomic<uint64_t> mUploaderRingBufferCount{0};
+    std::atomic<uint64_t> mUploaderPeakRingBufferCount{0};
+    std::atomic<uint64_t> mCommandBuffersFinished{0};
+    std::atomic<uint64_t> mCommandEncoderFinishMicroseconds{0};
+    std::atomic<uint64_t> mSubmits{0};
+    std::atomic<uint64_t> mCommandBuffersSubmitted{0};
+    std::atomic<uint64_t> mSubmitMicroseconds{0};
+    std::atomic<uint64_t> mDescriptorPoolsCreated{0};
+    std::atomic<uint64_t> mDeferredDeletionQueueDepth{0};
+    std::atomic<uint64_t> mPeakDeferredDeletionQueueDepth{0};
+    std::atomic<uint64_t> mBackgroundDeletionQueueDepth{0};
+    std::atomic<uint64_t> mPeakBackgroundDeletionQueueDepth{0};
+    std::atomic<uint64_t> mBackgroundDeletions{0};
+    std::atomic<uint64_t> mSuballocationHeapBytes{0};
+    std::atomic<uint64_t> mSlabBytes{0};
+    std::atomic<uint64_t> mSlabBytesInUse{0};
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_METRICSCOLLECTOR_H_
@@ -30,6 +30,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -107,6 +108,13 @@ struct ObjectContentHasher::RecordImpl<std::string> {
     }
 };
 
+template <>
+struct ObjectContentHasher::RecordImpl<std::string_view> {
+    static constexpr void Call(ObjectContentHasher* recorder, const std::string_view& str) {
+        recorder->RecordIterable<std::string_view>(str);
+    }
+};
+
 }  // namespace dawn::native
 
 #endif  // SRC_DAWN_NATIVE_OBJECTCONTENTHASHER_H_
@@ -100,6 +100,10 @@ struct RenderPassResourceUsage : public SyncScopeResourceUsage {
     // Storage to track the occlusion queries used during the pass.
     std::vector<QuerySetBase*> querySets;
     std::vector<std::vector<bool>> queryAvailabilities;
+
+    // The number of render bundles executed in the pass. Backends can use it to decide how to
+    // record the pass before iterating its commands.
+    uint32_t executedRenderBundleCount = 0;
 };
 
 using RenderPassUsages = std::vector<RenderPassResourceUsage>;
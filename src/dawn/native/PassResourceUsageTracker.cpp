@@ -267,6 +267,9 @@ RenderPassResourceUsage RenderPassResourceUsageTracker::AcquireResourceUsage() {
 
     mQueryAvailabilities.clear();
 
+    result.executedRenderBundleCount = mExecutedRenderBundleCount;
+    mExecutedRenderBundleCount = 0;
+
     return result;
 }
 
@@ -286,4 +289,8 @@ const QueryAvailabilityMap& RenderPassResourceUsageTracker::GetQueryAvailability
     return mQueryAvailabilities;
 }
 
+void RenderPassResourceUsageTracker::TrackRenderBundleExecution(uint32_t count) {
+    mExecutedRenderBundleCount += count;
+}
+
 }  // namespace dawn::native
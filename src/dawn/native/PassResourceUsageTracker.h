@@ -108,6 +108,8 @@ class RenderPassResourceUsageTracker : public SyncScopeUsageTracker {
     void TrackQueryAvailability(QuerySetBase* querySet, uint32_t queryIndex);
     const QueryAvailabilityMap& GetQueryAvailabilityMap() const;
 
+    void TrackRenderBundleExecution(uint32_t count);
+
     RenderPassResourceUsage AcquireResourceUsage();
 
   private:
@@ -117,6 +119,8 @@ class RenderPassResourceUsageTracker : public SyncScopeUsageTracker {
 
     // Tracks queries used in the render pass to validate that they aren't written twice.
     QueryAvailabilityMap mQueryAvailabilities;
+
+    uint32_t mExecutedRenderBundleCount = 0;
 };
 
 }  // namespace dawn::native
@@ -125,6 +125,29 @@ StageAndDescriptor::StageAndDescriptor(SingleShaderStage shaderStage,
       constantCount(constantCount),
       constants(constants) {}
 
+namespace {
+
+// Returns whether any binding of the layout is writable storage, in which case it must be
+// considered by the writable binding aliasing validation.
+bool HasWritableStorageBinding(const BindGroupLayoutInternalBase* bgl) {
+    for (BindingIndex bindingIndex{0}; bindingIndex < bgl->GetBindingCount(); ++bindingIndex) {
+        const BindingInfo& bindingInfo = bgl->GetBindingInfo(bindingIndex);
+        if (const auto* layout = std::get_if<BufferBindingInfo>(&bindingInfo.bindingLayout)) {
+            if (layout->type == wgpu::BufferBindingType::Storage) {
+                return true;
+            }
+        } else if (const auto* layout =
+                       std::get_if<StorageTextureBindingInfo>(&bindingInfo.bindingLayout)) {
+            if (layout->access != wgpu::StorageTextureAccess::ReadOnly) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+}  // anonymous namespace
+
 // PipelineLayoutBase
 
 PipelineLayoutBase::PipelineLayoutBase(DeviceBase* device,
@@ -139,6 +162,9 @@ PipelineLayoutBase::PipelineLayoutBase(DeviceBase* device,
     for (auto [group, bgl] : Enumerate(bgls)) {
         mBindGroupLayouts[group] = bgl;
         mMask.set(group);
+        if (HasWritableStorageBinding(bgl->GetInternalBindGroupLayout())) {
+            mWritableStorageMask.set(group);
+        }
     }
 
     // Gather the PLS information.
@@ -447,6 +473,11 @@ const BindGroupMask& PipelineLayoutBase::GetBindGroupLayoutsMask() const {
     return mMask;
 }
 
+const BindGroupMask& PipelineLayoutBase::GetWritableStorageBindGroupsMask() const {
+    DAWN_ASSERT(!IsError());
+    return mWritableStorageMask;
+}
+
 bool PipelineLayoutBase::HasPixelLocalStorage() const {
     return mHasPLS;
 }
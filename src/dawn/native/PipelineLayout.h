@@ -93,6 +93,8 @@ class PipelineLayoutBase : public ApiObjectBase,
     const BindGroupLayoutInternalBase* GetBindGroupLayout(BindGroupIndex group) const;
     BindGroupLayoutInternalBase* GetBindGroupLayout(BindGroupIndex group);
     const BindGroupMask& GetBindGroupLayoutsMask() const;
+    // The groups containing writable storage bindings, the only ones that can alias.
+    const BindGroupMask& GetWritableStorageBindGroupsMask() const;
     bool HasPixelLocalStorage() const;
     const std::vector<wgpu::TextureFormat>& GetStorageAttachmentSlots() const;
     bool HasAnyStorageAttachments() const;
@@ -120,6 +122,7 @@ class PipelineLayoutBase : public ApiObjectBase,
 
     PerBindGroup<Ref<BindGroupLayoutBase>> mBindGroupLayouts;
     BindGroupMask mMask;
+    BindGroupMask mWritableStorageMask;
     bool mHasPLS = false;
     std::vector<wgpu::TextureFormat> mStorageAttachmentSlots;
     uint32_t mImmediateDataRangeByteSize = 0;
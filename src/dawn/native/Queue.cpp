@@ -51,6 +51,7 @@
 #include "dawn/native/EventManager.h"
 #include "dawn/native/ExternalTexture.h"
 #include "dawn/native/Instance.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/ObjectType_autogen.h"
 #include "dawn/native/QuerySet.h"
 #include "dawn/native/RenderPassEncoder.h"
@@ -695,12 +696,14 @@ MaybeError QueueBase::SubmitInternal(uint32_t commandCount, CommandBufferBase* c
     DAWN_TRY(device->ValidateIsAlive());
 
     TRACE_EVENT0(device->GetPlatform(), General, "Queue::Submit");
+    double startTime = device->GetMetrics()->Now();
     if (device->IsValidationEnabled()) {
         DAWN_TRY(ValidateSubmit(commandCount, commands));
     }
     DAWN_ASSERT(!IsError());
 
     DAWN_TRY(SubmitImpl(commandCount, commands));
+    device->GetMetrics()->RecordSubmit(startTime, commandCount);
 
     // Call Tick() to flush pending work.
     DAWN_TRY(device->Tick());
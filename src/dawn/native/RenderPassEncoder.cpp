@@ -347,6 +347,7 @@ void RenderPassEncoder::APIExecuteBundles(uint32_t count, RenderBundleBase* cons
             ExecuteBundlesCmd* cmd =
                 allocator->Allocate<ExecuteBundlesCmd>(Command::ExecuteBundles);
             cmd->count = count;
+            mUsageTracker.TrackRenderBundleExecution(count);
 
             Ref<RenderBundleBase>* bundles = allocator->AllocateData<Ref<RenderBundleBase>>(count);
             for (uint32_t i = 0; i < count; ++i) {
@@ -666,6 +666,14 @@ ResultOrError<std::unique_ptr<EntryPointMetadata>> ReflectEntryPointUsingTint(
 
     if (metadata->stage == SingleShaderStage::Compute) {
         metadata->usesNumWorkgroups = entryPoint.num_workgroups_used;
+
+        // Without overrides the workgroup size and storage are constant, so remember them to
+        // validate pipelines without traversing the program again.
+        if (entryPoint.overrides.empty() && entryPoint.workgroup_size.has_value()) {
+            const tint::inspector::WorkgroupSize& workgroupSize = entryPoint.workgroup_size.value();
+            metadata->workgroupSize = Extent3D{workgroupSize.x, workgroupSize.y, workgroupSize.z};
+            metadata->workgroupStorageSize = entryPoint.workgroup_storage_size;
+        }
     }
 
     metadata->usesTextureLoadWithDepthTexture = entryPoint.has_texture_load_with_depth_texture;
@@ -1064,41 +1072,34 @@ MaybeError ReflectShaderUsingTint(const DeviceBase* device,
     }
     return {};
 }
-}  // anonymous namespace
 
-ResultOrError<Extent3D> ValidateComputeStageWorkgroupSize(
-    const tint::Program& program,
-    const char* entryPointName,
+ResultOrError<Extent3D> ValidateComputeStageWorkgroupSizeImpl(
+    const Extent3D& workgroupSize,
+    size_t workgroupStorageSize,
     const LimitsForCompilationRequest& limits,
     std::optional<uint32_t> maxSubgroupSizeForFullSubgroups) {
-    tint::inspector::Inspector inspector(program);
-    // At this point the entry point must exist and must have workgroup size values.
-    tint::inspector::EntryPoint entryPoint = inspector.GetEntryPoint(entryPointName);
-    DAWN_ASSERT(entryPoint.workgroup_size.has_value());
-    const tint::inspector::WorkgroupSize& workgroup_size = entryPoint.workgroup_size.value();
-
-    DAWN_INVALID_IF(workgroup_size.x < 1 || workgroup_size.y < 1 || workgroup_size.z < 1,
+    DAWN_INVALID_IF(workgroupSize.width < 1 || workgroupSize.height < 1 ||
+                        workgroupSize.depthOrArrayLayers < 1,
                     "Entry-point uses workgroup_size(%u, %u, %u) that are below the "
                     "minimum allowed (1, 1, 1).",
-                    workgroup_size.x, workgroup_size.y, workgroup_size.z);
+                    workgroupSize.width, workgroupSize.height, workgroupSize.depthOrArrayLayers);
 
-    DAWN_INVALID_IF(workgroup_size.x > limits.maxComputeWorkgroupSizeX ||
-                        workgroup_size.y > limits.maxComputeWorkgroupSizeY ||
-                        workgroup_size.z > limits.maxComputeWorkgroupSizeZ,
+    DAWN_INVALID_IF(workgroupSize.width > limits.maxComputeWorkgroupSizeX ||
+                        workgroupSize.height > limits.maxComputeWorkgroupSizeY ||
+                        workgroupSize.depthOrArrayLayers > limits.maxComputeWorkgroupSizeZ,
                     "Entry-point uses workgroup_size(%u, %u, %u) that exceeds the "
                     "maximum allowed (%u, %u, %u).",
-                    workgroup_size.x, workgroup_size.y, workgroup_size.z,
+                    workgroupSize.width, workgroupSize.height, workgroupSize.depthOrArrayLayers,
                     limits.maxComputeWorkgroupSizeX, limits.maxComputeWorkgroupSizeY,
                     limits.maxComputeWorkgroupSizeZ);
 
-    uint64_t numInvocations =
-        static_cast<uint64_t>(workgroup_size.x) * workgroup_size.y * workgroup_size.z;
+    uint64_t numInvocations = static_cast<uint64_t>(workgroupSize.width) * workgroupSize.height *
+                              workgroupSize.depthOrArrayLayers;
     DAWN_INVALID_IF(numInvocations > limits.maxComputeInvocationsPerWorkgroup,
                     "The total number of workgroup invocations (%u) exceeds the "
                     "maximum allowed (%u).",
                     numInvocations, limits.maxComputeInvocationsPerWorkgroup);
 
-    const size_t workgroupStorageSize = entryPoint.workgroup_storage_size;
     DAWN_INVALID_IF(workgroupStorageSize > limits.maxComputeWorkgroupStorageSize,
                     "The total use of workgroup storage (%u bytes) is larger than "
                     "the maximum allowed (%u bytes).",
@@ -1107,12 +1108,40 @@ ResultOrError<Extent3D> ValidateComputeStageWorkgroupSize(
     // Validate workgroup_size.x is a multiple of maxSubgroupSizeForFullSubgroups if
     // it holds a value.
     DAWN_INVALID_IF(maxSubgroupSizeForFullSubgroups &&
-                        (workgroup_size.x % *maxSubgroupSizeForFullSubgroups != 0),
+                        (workgroupSize.width % *maxSubgroupSizeForFullSubgroups != 0),
                     "the X dimension of the workgroup size (%d) must be a multiple of "
                     "maxSubgroupSize (%d) if full subgroups required in compute pipeline",
-                    workgroup_size.x, *maxSubgroupSizeForFullSubgroups);
+                    workgroupSize.width, *maxSubgroupSizeForFullSubgroups);
 
-    return Extent3D{workgroup_size.x, workgroup_size.y, workgroup_size.z};
+    return workgroupSize;
+}
+
+}  // anonymous namespace
+
+ResultOrError<Extent3D> ValidateComputeStageWorkgroupSize(
+    const tint::Program& program,
+    const char* entryPointName,
+    const LimitsForCompilationRequest& limits,
+    std::optional<uint32_t> maxSubgroupSizeForFullSubgroups) {
+    tint::inspector::Inspector inspector(program);
+    // At this point the entry point must exist and must have workgroup size values.
+    tint::inspector::EntryPoint entryPoint = inspector.GetEntryPoint(entryPointName);
+    DAWN_ASSERT(entryPoint.workgroup_size.has_value());
+    const tint::inspector::WorkgroupSize& workgroup_size = entryPoint.workgroup_size.value();
+
+    return ValidateComputeStageWorkgroupSizeImpl(
+        Extent3D{workgroup_size.x, workgroup_size.y, workgroup_size.z},
+        entryPoint.workgroup_storage_size, limits, maxSubgroupSizeForFullSubgroups);
+}
+
+ResultOrError<Extent3D> ValidateComputeStageWorkgroupSize(
+    const EntryPointMetadata& entryPoint,
+    const LimitsForCompilationRequest& limits,
+    std::optional<uint32_t> maxSubgroupSizeForFullSubgroups) {
+    DAWN_ASSERT(entryPoint.workgroupSize.has_value());
+    return ValidateComputeStageWorkgroupSizeImpl(*entryPoint.workgroupSize,
+                                                 entryPoint.workgroupStorageSize, limits,
+                                                 maxSubgroupSizeForFullSubgroups);
 }
 
 ShaderModuleParseResult::ShaderModuleParseResult() = default;
@@ -1239,6 +1268,74 @@ ResultOrError<tint::Program> RunTransforms(tint::ast::transform::Manager* transf
     return std::move(result);
 }
 
+bool TintProgram::DeclaresOverrides() const {
+    for (auto* global : program.AST().GlobalVariables()) {
+        if (global->Is<tint::ast::Override>()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ResultOrError<Ref<SpecializableProgram>> TintProgram::GetOrCreateSpecializableProgram(
+    const std::string& entryPoint,
+    bool disableSymbolRenaming) {
+    SpecializableProgramKey key{entryPoint, disableSymbolRenaming};
+    Ref<SpecializableProgram> cached =
+        mSpecializablePrograms.Use([&](auto programs) -> Ref<SpecializableProgram> {
+            auto it = programs->find(key);
+            if (it == programs->end()) {
+                return nullptr;
+            }
+            return it->second;
+        });
+    if (cached != nullptr) {
+        return cached;
+    }
+
+    // Run the transforms without holding the lock so that other entry points of this program can
+    // be specialized concurrently. If another thread raced us, its result is kept below.
+    tint::ast::transform::Manager transformManager;
+    tint::ast::transform::DataMap transformInputs;
+
+    // Many drivers can't handle multi-entrypoint shader modules. Run before the renamer so that
+    // the entry point name still matches `entryPoint`.
+    transformManager.Add<tint::ast::transform::SingleEntryPoint>();
+    transformInputs.Add<tint::ast::transform::SingleEntryPoint::Config>(entryPoint);
+
+    // Needs to run before all other transforms so that they can use builtin names safely.
+    if (!disableSymbolRenaming) {
+        transformManager.Add<tint::ast::transform::Renamer>();
+    }
+
+    tint::Program transformed;
+    tint::ast::transform::DataMap transformOutputs;
+    DAWN_TRY_ASSIGN(transformed, RunTransforms(&transformManager, &program, transformInputs,
+                                               &transformOutputs, nullptr));
+
+    std::string remappedEntryPoint = entryPoint;
+    if (!disableSymbolRenaming) {
+        auto* data = transformOutputs.Get<tint::ast::transform::Renamer::Data>();
+        DAWN_ASSERT(data != nullptr);
+
+        auto it = data->remappings.find(entryPoint);
+        DAWN_ASSERT(it != data->remappings.end());
+        remappedEntryPoint = it->second;
+    }
+    DAWN_ASSERT(remappedEntryPoint != "");
+
+    Ref<SpecializableProgram> created =
+        AcquireRef(new SpecializableProgram(std::move(transformed), std::move(remappedEntryPoint)));
+    return mSpecializablePrograms.Use([&](auto programs) {
+        auto [it, _] = programs->emplace(std::move(key), std::move(created));
+        return it->second;
+    });
+}
+
+size_t TintProgram::GetSpecializableProgramCountForTesting() const {
+    return mSpecializablePrograms.Use([](auto programs) { return programs->size(); });
+}
+
 MaybeError ValidateCompatibilityWithPipelineLayout(DeviceBase* device,
                                                    const EntryPointMetadata& entryPoint,
                                                    const PipelineLayoutBase* layout) {
@@ -1359,7 +1456,7 @@ ShaderModuleBase::ShaderModuleBase(DeviceBase* device,
         mOriginalSpirv.assign(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
     } else if (auto* wgslDesc = descriptor.Get<ShaderSourceWGSL>()) {
         mType = Type::Wgsl;
-        mWgsl = std::string(wgslDesc->code);
+        mWgsl.emplace(tint::Source::FileContent::Borrow(std::string_view(wgslDesc->code)));
     } else {
         DAWN_ASSERT(false);
     }
@@ -1424,15 +1521,15 @@ size_t ShaderModuleBase::ComputeContentHash() {
     ObjectContentHasher recorder;
     recorder.Record(mType);
     recorder.Record(mOriginalSpirv);
-    recorder.Record(mWgsl);
+    recorder.Record(GetWgsl());
     recorder.Record(mStrictMath);
     return recorder.GetContentHash();
 }
 
 bool ShaderModuleBase::EqualityFunc::operator()(const ShaderModuleBase* a,
                                                 const ShaderModuleBase* b) const {
-    return a->mType == b->mType && a->mOriginalSpirv == b->mOriginalSpirv && a->mWgsl == b->mWgsl &&
-           a->mStrictMath == b->mStrictMath;
+    return a->mType == b->mType && a->mOriginalSpirv == b->mOriginalSpirv &&
+           a->GetWgsl() == b->GetWgsl() && a->mStrictMath == b->mStrictMath;
 }
 
 ShaderModuleBase::ScopedUseTintProgram ShaderModuleBase::UseTintProgram() {
@@ -1459,7 +1556,7 @@ ShaderModuleBase::ScopedUseTintProgram ShaderModuleBase::UseTintProgram() {
                 descriptor.nextInChain = &sprivDescriptor;
                 break;
             case Type::Wgsl:
-                wgslDescriptor.code = mWgsl.c_str();
+                wgslDescriptor.code = GetWgsl();
                 descriptor.nextInChain = &wgslDescriptor;
                 break;
             default:
@@ -1600,6 +1697,14 @@ MaybeError ShaderModuleBase::InitializeBase(ShaderModuleParseResult* parseResult
     DAWN_TRY(mTintData.Use([&](auto tintData) -> MaybeError {
         tintData->tintProgram = std::move(parseResult->tintProgram);
 
+        if (mType == Type::Wgsl) {
+            // The descriptor's code is only borrowed until now. Share the copy owned by the
+            // program's file instead of making another one.
+            const tint::Source::File* file = tintData->tintProgram->file.get();
+            DAWN_ASSERT(file != nullptr && file->content.data == mWgsl->data);
+            mWgsl.emplace(file->content);
+        }
+
         DAWN_TRY(ReflectShaderUsingTint(GetDevice(), &(tintData->tintProgram->program),
                                         compilationMessages, &mEntryPoints));
         return {};
@@ -1619,6 +1724,10 @@ MaybeError ShaderModuleBase::InitializeBase(ShaderModuleParseResult* parseResult
     return {};
 }
 
+std::string_view ShaderModuleBase::GetWgsl() const {
+    return mWgsl.has_value() ? mWgsl->data : std::string_view();
+}
+
 void ShaderModuleBase::WillDropLastExternalRef() {
     mTintData.Use([&](auto tintData) { tintData->tintProgram = nullptr; });
 }
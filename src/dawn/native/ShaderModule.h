@@ -31,7 +31,9 @@
 #include <bitset>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -110,11 +112,38 @@ using PipelineConstantEntries = std::map<std::string, double>;
 using EntryPointMetadataTable =
     absl::flat_hash_map<std::string, std::unique_ptr<EntryPointMetadata>>;
 
+// A tint::Program that has been reduced to a single entry point (and renamed unless symbol renaming
+// is disabled). Only the pipeline-overridable constants remain to be substituted, so every set of
+// constants used with the entry point can be specialized from it without re-running the
+// module-wide transforms.
+struct SpecializableProgram : public RefCounted {
+    SpecializableProgram(tint::Program program, std::string remappedEntryPoint)
+        : program(std::move(program)), remappedEntryPoint(std::move(remappedEntryPoint)) {}
+    const tint::Program program;
+    const std::string remappedEntryPoint;
+};
+
 struct TintProgram : public RefCounted {
     TintProgram(tint::Program program, std::unique_ptr<tint::Source::File> file)
         : program(std::move(program)), file(std::move(file)) {}
+
+    // Returns the SpecializableProgram for `entryPoint`, creating it the first time it is
+    // requested. The result is shared by all pipelines using this program.
+    ResultOrError<Ref<SpecializableProgram>> GetOrCreateSpecializableProgram(
+        const std::string& entryPoint,
+        bool disableSymbolRenaming);
+    size_t GetSpecializableProgramCountForTesting() const;
+
+    // Returns true if the program declares any override, even one no entry point uses.
+    bool DeclaresOverrides() const;
+
     const tint::Program program;
     const std::unique_ptr<tint::Source::File> file;  // Keep the tint::Source::File alive
+
+  private:
+    using SpecializableProgramKey = std::pair<std::string, bool>;
+    MutexProtected<absl::flat_hash_map<SpecializableProgramKey, Ref<SpecializableProgram>>>
+        mSpecializablePrograms;
 };
 
 struct ShaderModuleParseResult {
@@ -151,6 +180,12 @@ ResultOrError<Extent3D> ValidateComputeStageWorkgroupSize(
     const char* entryPointName,
     const LimitsForCompilationRequest& limits,
     std::optional<uint32_t> maxSubgroupSizeForFullSubgroups);
+// Same as above but uses the workgroup size reflected in `entryPoint`, which must be known, instead
+// of traversing the program.
+ResultOrError<Extent3D> ValidateComputeStageWorkgroupSize(
+    const EntryPointMetadata& entryPoint,
+    const LimitsForCompilationRequest& limits,
+    std::optional<uint32_t> maxSubgroupSizeForFullSubgroups);
 
 RequiredBufferSizes ComputeRequiredBufferSizesForLayout(const EntryPointMetadata& entryPoint,
                                                         const PipelineLayoutBase* layout);
@@ -282,6 +317,12 @@ struct EntryPointMetadata {
     bool usesVertexIndex = false;
     bool usesTextureLoadWithDepthTexture = false;
 
+    // The workgroup size and workgroup storage size of a compute entry point. They are only known
+    // at reflection time when the entry point doesn't use overrides, otherwise they must be
+    // computed for each set of override values.
+    std::optional<Extent3D> workgroupSize;
+    size_t workgroupStorageSize = 0;
+
     // Immediate Data block byte size
     uint32_t immediateDataRangeByteSize = 0;
 };
@@ -352,11 +393,15 @@ class ShaderModuleBase : public RefCountedWithExternalCount<ApiObjectBase>,
 
     void WillDropLastExternalRef() override;
 
+    std::string_view GetWgsl() const;
+
     // The original data in the descriptor for caching.
     enum class Type { Undefined, Spirv, Wgsl };
     Type mType;
     std::vector<uint32_t> mOriginalSpirv;
-    std::string mWgsl;
+    // Borrows the descriptor's code until InitializeBase() adopts the content of the parsed
+    // TintProgram's file, so the WGSL source is stored once per module.
+    std::optional<tint::Source::FileContent> mWgsl;
 
     // TODO(dawn:2503): Remove the optional when Dawn can has a consistent default across backends.
     // Right now D3D uses strictness by default, and Vulkan/Metal use fast math by default.
@@ -0,0 +1,241 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "dawn/native/SlabMemoryAllocator.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include "dawn/common/Math.h"
+#include "dawn/native/BuddyMemoryAllocator.h"
+
+namespace dawn::native {
+
+namespace {
+
+// Size classes are spaced by a quarter of their power of two, so at most a fifth of a slot is
+// wasted by rounding up.
+constexpr uint64_t kSizeClassesPerPowerOfTwo = 4;
+
+// Slabs hold at least this many slots, and are at least this large so that size classes that are
+// only used by a few allocations don't each need a tiny buddy block.
+constexpr uint32_t kMinSlotsPerSlab = 16;
+constexpr uint64_t kMinSlabSize = 64 * 1024;
+
+}  // anonymous namespace
+
+struct SlabMemoryAllocator::Slab {
+    Slab(const ResourceMemoryAllocation& allocation, size_t sizeClass, uint32_t slotCount)
+        : allocation(allocation), sizeClass(sizeClass), slotCount(slotCount) {
+        // Hand out the slots in increasing offset order.
+        freeSlots.reserve(slotCount);
+        for (uint32_t slot = slotCount; slot > 0; --slot) {
+            freeSlots.push_back(slot - 1);
+        }
+    }
+
+    ResourceMemoryAllocation allocation;
+    size_t sizeClass;
+    uint32_t slotCount;
+    std::vector<uint32_t> freeSlots;
+
+    // The index of this slab in the available slabs of its size class, if it has free slots.
+    static constexpr size_t kNotAvailable = std::numeric_limits<size_t>::max();
+    size_t availableIndex = kNotAvailable;
+};
+
+SlabMemoryAllocator::SlabMemoryAllocator(BuddyMemoryAllocator* slabAllocator,
+                                         uint64_t maxAllocationSize,
+                                         uint64_t slabAlignment)
+    : mSlabAllocator(slabAllocator),
+      mMaxAllocationSize(maxAllocationSize),
+      mSlabAlignment(slabAlignment) {
+    const uint64_t maxSlabSize = mSlabAllocator->GetMemoryBlockSize();
+    for (uint64_t powerOfTwo = kMinSlotSize; powerOfTwo <= mMaxAllocationSize; powerOfTwo *= 2) {
+        for (uint64_t i = 0; i < kSizeClassesPerPowerOfTwo; ++i) {
+            SizeClass sizeClass;
+            sizeClass.slotSize = powerOfTwo + i * (powerOfTwo / kSizeClassesPerPowerOfTwo);
+            sizeClass.slabSize = std::min(
+                maxSlabSize,
+                std::max(kMinSlabSize, NextPowerOfTwo(sizeClass.slotSize * kMinSlotsPerSlab)));
+            if (sizeClass.slotSize > mMaxAllocationSize ||
+                sizeClass.slotSize > sizeClass.slabSize) {
+                break;
+            }
+            mSizeClasses.push_back(std::move(sizeClass));
+        }
+    }
+}
+
+SlabMemoryAllocator::~SlabMemoryAllocator() = default;
+
+size_t SlabMemoryAllocator::FindSizeClass(uint64_t allocationSize, uint64_t alignment) const {
+    auto it = std::lower_bound(
+        mSizeClasses.begin(), mSizeClasses.end(), allocationSize,
+        [](const SizeClass& sizeClass, uint64_t size) { return sizeClass.slotSize < size; });
+
+    // Slots are placed at multiples of their size in the slab, so the slot size must be a multiple
+    // of the alignment. Powers of two larger than the alignment always are.
+    for (; it != mSizeClasses.end(); ++it) {
+        if (it->slotSize % alignment == 0) {
+            return static_cast<size_t>(it - mSizeClasses.begin());
+        }
+    }
+    return kInvalidSizeClass;
+}
+
+ResultOrError<ResourceMemoryAllocation> SlabMemoryAllocator::Allocate(uint64_t allocationSize,
+                                                                      uint64_t alignment) {
+    ResourceMemoryAllocation invalidAllocation = ResourceMemoryAllocation{};
+
+    if (allocationSize == 0 || allocationSize > mMaxAllocationSize) {
+        return std::move(invalidAllocation);
+    }
+
+    const size_t sizeClassIndex = FindSizeClass(allocationSize, alignment);
+    if (sizeClassIndex == kInvalidSizeClass) {
+        return std::move(invalidAllocation);
+    }
+    SizeClass& sizeClass = mSizeClasses[sizeClassIndex];
+
+    if (sizeClass.availableSlabs.empty()) {
+        ResourceMemoryAllocation slabAllocation;
+        DAWN_TRY_ASSIGN(slabAllocation,
+                        mSlabAllocator->Allocate(sizeClass.slabSize, mSlabAlignment));
+        if (slabAllocation.GetInfo().mMethod == AllocationMethod::kInvalid) {
+            return std::move(invalidAllocation);
+        }
+
+        const uint64_t slabBlockOffset = slabAllocation.GetInfo().mBlockOffset;
+        auto slab = std::make_unique<Slab>(
+            slabAllocation, sizeClassIndex,
+            static_cast<uint32_t>(sizeClass.slabSize / sizeClass.slotSize));
+        AddAvailableSlab(slab.get());
+        mSlabs.emplace(slabBlockOffset, std::move(slab));
+        mSlabBytes += sizeClass.slabSize;
+    }
+
+    Slab* slab = sizeClass.availableSlabs.back();
+    const uint32_t slot = slab->freeSlots.back();
+    slab->freeSlots.pop_back();
+    if (slab->freeSlots.empty()) {
+        RemoveAvailableSlab(slab);
+    }
+    mSlabBytesInUse += sizeClass.slotSize;
+
+    const uint64_t slotOffset = slot * sizeClass.slotSize;
+
+    AllocationInfo info;
+    info.mBlockOffset = slab->allocation.GetInfo().mBlockOffset + slotOffset;
+    info.mMethod = AllocationMethod::kSubAllocated;
+
+    return ResourceMemoryAllocation{info, slab->allocation.GetOffset() + slotOffset,
+                                    slab->allocation.GetResourceHeap()};
+}
+
+bool SlabMemoryAllocator::Deallocate(const ResourceMemoryAllocation& allocation) {
+    const AllocationInfo info = allocation.GetInfo();
+    DAWN_ASSERT(info.mMethod == AllocationMethod::kSubAllocated);
+
+    // Find the slab with the largest block offset that is <= the allocation's block offset.
+    auto slabIt = mSlabs.upper_bound(info.mBlockOffset);
+    if (slabIt == mSlabs.begin()) {
+        return false;
+    }
+    --slabIt;
+
+    Slab* slab = slabIt->second.get();
+    SizeClass& sizeClass = mSizeClasses[slab->sizeClass];
+    const uint64_t slotOffset = info.mBlockOffset - slabIt->first;
+    if (slotOffset >= sizeClass.slabSize) {
+        return false;
+    }
+    DAWN_ASSERT(slotOffset % sizeClass.slotSize == 0);
+
+    if (slab->freeSlots.empty()) {
+        AddAvailableSlab(slab);
+    }
+    slab->freeSlots.push_back(static_cast<uint32_t>(slotOffset / sizeClass.slotSize));
+    mSlabBytesInUse -= sizeClass.slotSize;
+
+    // Keep the slab if it is the last one of its size class with free slots.
+    if (slab->freeSlots.size() == slab->slotCount && sizeClass.availableSlabs.size() > 1) {
+        ReleaseSlab(slabIt);
+    }
+    return true;
+}
+
+void SlabMemoryAllocator::ReleaseEmptySlabs() {
+    for (auto slabIt = mSlabs.begin(); slabIt != mSlabs.end();) {
+        Slab* slab = slabIt->second.get();
+        auto nextIt = std::next(slabIt);
+        if (slab->freeSlots.size() == slab->slotCount) {
+            ReleaseSlab(slabIt);
+        }
+        slabIt = nextIt;
+    }
+}
+
+uint64_t SlabMemoryAllocator::GetSlabBytes() const {
+    return mSlabBytes;
+}
+
+uint64_t SlabMemoryAllocator::GetSlabBytesInUse() const {
+    return mSlabBytesInUse;
+}
+
+void SlabMemoryAllocator::AddAvailableSlab(Slab* slab) {
+    std::vector<Slab*>& availableSlabs = mSizeClasses[slab->sizeClass].availableSlabs;
+    DAWN_ASSERT(slab->availableIndex == Slab::kNotAvailable);
+    slab->availableIndex = availableSlabs.size();
+    availableSlabs.push_back(slab);
+}
+
+void SlabMemoryAllocator::RemoveAvailableSlab(Slab* slab) {
+    std::vector<Slab*>& availableSlabs = mSizeClasses[slab->sizeClass].availableSlabs;
+    DAWN_ASSERT(slab->availableIndex < availableSlabs.size());
+
+    // Swap with the last slab so that removal is O(1).
+    Slab* lastSlab = availableSlabs.back();
+    availableSlabs[slab->availableIndex] = lastSlab;
+    lastSlab->availableIndex = slab->availableIndex;
+    availableSlabs.pop_back();
+    slab->availableIndex = Slab::kNotAvailable;
+}
+
+void SlabMemoryAllocator::ReleaseSlab(std::map<uint64_t, std::unique_ptr<Slab>>::iterator slabIt) {
+    Slab* slab = slabIt->second.get();
+    DAWN_ASSERT(slab->freeSlots.size() == slab->slotCount);
+
+    RemoveAvailableSlab(slab);
+    mSlabAllocator->Deallocate(slab->allocation);
+    mSlabBytes -= mSizeClasses[slab->sizeClass].slabSize;
+    mSlabs.erase(slabIt);
+}
+
+}  // namespace dawn::native
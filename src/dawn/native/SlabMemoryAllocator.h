@@ -0,0 +1,107 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef SRC_DAWN_NATIVE_SLABMEMORYALLOCATOR_H_
+#define SRC_DAWN_NATIVE_SLABMEMORYALLOCATOR_H_
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "dawn/native/Error.h"
+#include "dawn/native/ResourceMemoryAllocation.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::native {
+
+class BuddyMemoryAllocator;
+
+// SlabMemoryAllocator is a tier in front of a BuddyMemoryAllocator for small allocations. The buddy
+// allocator rounds allocations up to a power of two, which wastes up to half of the memory for
+// sizes just above one. Instead, allocations are rounded up to one of several size classes per
+// power of two and are served from slabs: buddy blocks that are split in slots of a single size
+// class.
+class SlabMemoryAllocator {
+  public:
+    // Slabs are allocated from `slabAllocator` with `slabAlignment`. Allocations larger than
+    // `maxAllocationSize` aren't served by slabs.
+    SlabMemoryAllocator(BuddyMemoryAllocator* slabAllocator,
+                        uint64_t maxAllocationSize,
+                        uint64_t slabAlignment);
+    ~SlabMemoryAllocator();
+
+    // Returns an invalid allocation if the allocation isn't served by slabs or if no slab could
+    // be allocated, in which case the caller should fall back to the buddy allocator.
+    ResultOrError<ResourceMemoryAllocation> Allocate(uint64_t allocationSize, uint64_t alignment);
+    // Returns false if the allocation wasn't made by this allocator.
+    bool Deallocate(const ResourceMemoryAllocation& allocation);
+
+    // One empty slab is kept per size class to avoid reallocating it when allocations of that size
+    // are created and destroyed repeatedly. This returns them to the buddy allocator.
+    void ReleaseEmptySlabs();
+
+    // The memory of the slabs, and the part of it used by allocations.
+    uint64_t GetSlabBytes() const;
+    uint64_t GetSlabBytesInUse() const;
+
+    // The smallest size class. Smaller allocations waste the rest of their slot.
+    static constexpr uint64_t kMinSlotSize = 256;
+
+  private:
+    struct Slab;
+    struct SizeClass {
+        uint64_t slotSize;
+        uint64_t slabSize;
+        // The slabs of this size class that have free slots.
+        std::vector<Slab*> availableSlabs;
+    };
+
+    static constexpr size_t kInvalidSizeClass = std::numeric_limits<size_t>::max();
+    size_t FindSizeClass(uint64_t allocationSize, uint64_t alignment) const;
+
+    void AddAvailableSlab(Slab* slab);
+    void RemoveAvailableSlab(Slab* slab);
+    void ReleaseSlab(std::map<uint64_t, std::unique_ptr<Slab>>::iterator slabIt);
+
+    raw_ptr<BuddyMemoryAllocator> mSlabAllocator;
+    uint64_t mMaxAllocationSize;
+    uint64_t mSlabAlignment;
+
+    // Sorted by slot size.
+    std::vector<SizeClass> mSizeClasses;
+
+    // All the slabs, keyed by the block offset of their buddy allocation. Slabs are buddy blocks
+    // so an allocation is in a slab if and only if its block offset is inside that slab.
+    std::map<uint64_t, std::unique_ptr<Slab>> mSlabs;
+
+    uint64_t mSlabBytes = 0;
+    uint64_t mSlabBytesInUse = 0;
+};
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_SLABMEMORYALLOCATOR_H_
@@ -27,11 +27,14 @@
 
 #include "dawn/native/TintUtils.h"
 
+#include <string>
+
 #include "dawn/native/BindGroupLayoutInternal.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/Pipeline.h"
 #include "dawn/native/PipelineLayout.h"
 #include "dawn/native/RenderPipeline.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 #include "tint/tint.h"
 
@@ -154,6 +157,21 @@ ScopedTintICEHandler::~ScopedTintICEHandler() {
     tlDevice = nullptr;
 }
 
+ScopedTintPassTracer::ScopedTintPassTracer(platform::Platform* platform) : mPlatform(platform) {
+    if (TRACE_EVENT_CATEGORY_ENABLED(platform, General)) {
+        mScope.emplace(this);
+    }
+}
+
+ScopedTintPassTracer::~ScopedTintPassTracer() = default;
+
+void ScopedTintPassTracer::OnPass(const tint::core::ir::PassProfile& profile) {
+    // The pass names are not string literals, so the trace event has to copy them.
+    TRACE_EVENT_COPY_INSTANT2(mPlatform, General, std::string(profile.name).c_str(), "durationNs",
+                              static_cast<uint64_t>(profile.duration.count()), "instructions",
+                              static_cast<uint64_t>(profile.instructions_after));
+}
+
 tint::ast::transform::VertexPulling::Config BuildVertexPullingTransformConfig(
     const RenderPipelineBase& renderPipeline,
     BindGroupIndex pullingBufferBindingSet) {
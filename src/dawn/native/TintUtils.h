@@ -29,6 +29,7 @@
 #define SRC_DAWN_NATIVE_TINTUTILS_H_
 
 #include <functional>
+#include <optional>
 
 #include "dawn/common/NonCopyable.h"
 #include "dawn/native/IntegerTypes.h"
@@ -36,6 +37,10 @@
 
 #include "tint/tint.h"
 
+namespace dawn::platform {
+class Platform;
+}  // namespace dawn::platform
+
 namespace dawn::native {
 
 class DeviceBase;
@@ -54,6 +59,23 @@ class ScopedTintICEHandler : public NonCopyable {
     ScopedTintICEHandler(ScopedTintICEHandler&&) = delete;
 };
 
+// Indicates that for the lifetime of this object the Tint IR passes run on this thread should be
+// reported as trace events of the given platform. Nothing is profiled when the platform's General
+// trace category is disabled, since profiling a pass walks the whole module before and after it.
+class ScopedTintPassTracer : public NonCopyable, private tint::core::ir::PassProfiler {
+  public:
+    explicit ScopedTintPassTracer(platform::Platform* platform);
+    ~ScopedTintPassTracer() override;
+
+  private:
+    ScopedTintPassTracer(ScopedTintPassTracer&&) = delete;
+
+    void OnPass(const tint::core::ir::PassProfile& profile) override;
+
+    platform::Platform* mPlatform;
+    std::optional<tint::core::ir::ScopedPassProfiler> mScope;
+};
+
 tint::ast::transform::VertexPulling::Config BuildVertexPullingTransformConfig(
     const RenderPipelineBase& renderPipeline,
     BindGroupIndex pullingBufferBindingSet);
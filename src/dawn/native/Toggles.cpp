@@ -598,6 +598,67 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "Don't validate the required VkImage size against the size of the AHardwareBuffer on import. "
       "Some drivers report the wrong size.",
       "https://crbug.com/333424893", ToggleStage::Device}},
+    {Toggle::VulkanUseGraphicsPipelineLibrary,
+     {"vulkan_use_graphics_pipeline_library",
+      "Create render pipelines by linking per-state-subset VkPipeline libraries created with "
+      "VK_EXT_graphics_pipeline_library. Libraries are cached so that pipelines that only differ "
+      "in their vertex input, pre-rasterization, fragment shader or fragment output state reuse "
+      "the other libraries and only pay for a fast link instead of a full compilation. The "
+      "pipelines are then link-time optimized in the background. Disabled by default.",
+      "https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/"
+      "VK_EXT_graphics_pipeline_library.html",
+      ToggleStage::Device}},
+    {Toggle::VulkanAsyncQueueSubmission,
+     {"vulkan_async_queue_submission",
+      "Call vkQueueSubmit from a worker task instead of the thread calling Queue::Submit, so that "
+      "the driver's submission cost doesn't stall the API thread. Requires timeline semaphores to "
+      "track queue completion.",
+      "https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/vkQueueSubmit.html",
+      ToggleStage::Device}},
+    {Toggle::VulkanUseDescriptorUpdateTemplates,
+     {"vulkan_use_descriptor_update_templates",
+      "Write the descriptors of bind groups with a VkDescriptorUpdateTemplate created once per "
+      "bind group layout, instead of building a VkWriteDescriptorSet for each binding of every "
+      "bind group.",
+      "https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/"
+      "VK_KHR_descriptor_update_template.html",
+      ToggleStage::Device}},
+    {Toggle::VulkanUseSlabSuballocation,
+     {"vulkan_use_slab_suballocation",
+      "Suballocate the memory of small non-mappable buffers from slabs split in size classes, "
+      "instead of rounding their size up to a power of two in the buddy allocator. Disabled by "
+      "default.",
+      "https://crbug.com/dawn/849", ToggleStage::Device}},
+    {Toggle::VulkanBackgroundDeferredDeletion,
+     {"vulkan_background_deferred_deletion",
+      "Destroy the Vulkan objects whose last use has completed on the GPU from a worker task "
+      "instead of in the device tick, so that tearing down many objects doesn't stall the API "
+      "thread.",
+      "https://registry.khronos.org/vulkan/specs/1.3-extensions/html/"
+      "vkspec.html#fundamentals-threadingbehavior",
+      ToggleStage::Device}},
+    {Toggle::VulkanUseImagelessFramebuffers,
+     {"vulkan_use_imageless_framebuffers",
+      "Begin render passes with imageless framebuffers that are cached on the device, instead of "
+      "creating a VkFramebuffer for each render pass. Requires VK_KHR_imageless_framebuffer.",
+      "https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/"
+      "VK_KHR_imageless_framebuffer.html",
+      ToggleStage::Device}},
+    {Toggle::VulkanRecordRenderBundlesInParallel,
+     {"vulkan_record_render_bundles_in_parallel",
+      "Record the render bundles executed in a render pass into secondary command buffers on the "
+      "device's worker threads, in parallel with each other and with the rest of the pass.",
+      "https://registry.khronos.org/vulkan/specs/1.3-extensions/html/"
+      "vkspec.html#commandbuffers-secondary",
+      ToggleStage::Device}},
+    {Toggle::NullBackendExecuteCommands,
+     {"null_backend_execute_commands",
+      "Execute the buffer-to-buffer copies, buffer clears and buffer writes recorded in command "
+      "buffers on the CPU when they are submitted to the null backend, so that their results can "
+      "be read back. Only these commands are executed: copies involving textures, compute "
+      "dispatches and draws are skipped and leave the contents of resources unchanged.",
+      "https://dawn.googlesource.com/dawn/+/refs/heads/main/src/dawn/native/null/",
+      ToggleStage::Device}},
     // Comment to separate the }} so it is clearer what to copy-paste to add a toggle.
 }};
 }  // anonymous namespace
@@ -146,6 +146,14 @@ enum class Toggle {
 
     D3D11UseUnmonitoredFence,
     IgnoreImportedAHardwareBufferVulkanImageSize,
+    VulkanUseGraphicsPipelineLibrary,
+    VulkanAsyncQueueSubmission,
+    VulkanUseDescriptorUpdateTemplates,
+    VulkanUseSlabSuballocation,
+    VulkanBackgroundDeferredDeletion,
+    VulkanUseImagelessFramebuffers,
+    VulkanRecordRenderBundlesInParallel,
+    NullBackendExecuteCommands,
 
     EnumCount,
     InvalidEnum = EnumCount,
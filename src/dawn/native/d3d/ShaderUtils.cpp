@@ -251,7 +251,7 @@ MaybeError TranslateToHLSL(d3d::HlslCompilationRequest r,
     }
 
     // Validate workgroup size after program runs transforms.
-    if (r.stage == SingleShaderStage::Compute) {
+    if (r.stage == SingleShaderStage::Compute && !r.workgroupSizeValidatedFromReflection) {
         Extent3D _;
         DAWN_TRY_ASSIGN(
             _, ValidateComputeStageWorkgroupSize(transformedProgram, remappedEntryPointName->data(),
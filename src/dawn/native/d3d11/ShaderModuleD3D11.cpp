@@ -215,6 +215,16 @@ ResultOrError<d3d::CompiledShader> ShaderModule::Compile(
     const CombinedLimits& limits = device->GetLimits();
     req.hlsl.limits = LimitsForCompilationRequest::Create(limits.v1);
 
+    // Entry points whose workgroup size doesn't depend on overrides are validated from the
+    // reflection, so the compilation doesn't need to inspect the transformed program.
+    if (stage == SingleShaderStage::Compute && entryPoint.workgroupSize.has_value()) {
+        Extent3D _;
+        DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(entryPoint, req.hlsl.limits,
+                                                             /* maxSubgroupSizeForFullSubgroups */
+                                                             std::nullopt));
+        req.hlsl.workgroupSizeValidatedFromReflection = true;
+    }
+
     req.hlsl.tintOptions.disable_robustness = !device->IsRobustnessEnabled();
     req.hlsl.tintOptions.disable_workgroup_init =
         device->IsToggleEnabled(Toggle::DisableWorkgroupInit);
@@ -381,6 +381,15 @@ ResultOrError<d3d::CompiledShader> ShaderModule::Compile(
     const CombinedLimits& limits = device->GetLimits();
     req.hlsl.limits = LimitsForCompilationRequest::Create(limits.v1);
 
+    // Entry points whose workgroup size doesn't depend on overrides are validated from the
+    // reflection, so the compilation doesn't need to inspect the transformed program.
+    if (stage == SingleShaderStage::Compute && entryPoint.workgroupSize.has_value()) {
+        Extent3D _;
+        DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(entryPoint, req.hlsl.limits,
+                                                             maxSubgroupSizeForFullSubgroups));
+        req.hlsl.workgroupSizeValidatedFromReflection = true;
+    }
+
     CacheResult<d3d::CompiledShader> compiledShader;
     MaybeError compileError = [&]() -> MaybeError {
         DAWN_TRY_LOAD_OR_RUN(compiledShader, device, std::move(req), d3d::CompiledShader::FromBlob,
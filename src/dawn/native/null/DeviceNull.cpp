@@ -357,7 +357,8 @@ BindGroupLayout::BindGroupLayout(DeviceBase* device, const BindGroupLayoutDescri
 
 Buffer::Buffer(Device* device, const UnpackedPtr<BufferDescriptor>& descriptor)
     : BufferBase(device, descriptor) {
-    mBackingData = std::unique_ptr<uint8_t[]>(new uint8_t[GetSize()]);
+    // Zero the data so that reading it back, or copying it, before it is written is well defined.
+    mBackingData = std::unique_ptr<uint8_t[]>(new uint8_t[GetSize()]());
     mAllocatedSize = GetSize();
 }
 
@@ -385,6 +386,21 @@ void Buffer::DoWriteBuffer(uint64_t bufferOffset, const void* data, size_t size)
     memcpy(mBackingData.get() + bufferOffset, data, size);
 }
 
+void Buffer::CopyFromBuffer(const Buffer* source,
+                            uint64_t sourceOffset,
+                            uint64_t destinationOffset,
+                            uint64_t size) {
+    DAWN_ASSERT(sourceOffset + size <= source->GetSize());
+    DAWN_ASSERT(destinationOffset + size <= GetSize());
+    memmove(mBackingData.get() + destinationOffset, source->mBackingData.get() + sourceOffset,
+            size);
+}
+
+void Buffer::Clear(uint64_t offset, uint64_t size) {
+    DAWN_ASSERT(offset + size <= GetSize());
+    memset(mBackingData.get() + offset, 0, size);
+}
+
 MaybeError Buffer::MapAsyncImpl(wgpu::MapMode mode, size_t offset, size_t size) {
     GetDevice()->GetQueue()->IncrementLastSubmittedCommandSerial();
     return {};
@@ -413,6 +429,47 @@ void Buffer::DestroyImpl() {
 CommandBuffer::CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor)
     : CommandBufferBase(encoder, descriptor) {}
 
+void CommandBuffer::Execute() {
+    Command type;
+    while (mCommands.NextCommandId(&type)) {
+        switch (type) {
+            case Command::CopyBufferToBuffer: {
+                CopyBufferToBufferCmd* copy = mCommands.NextCommand<CopyBufferToBufferCmd>();
+                if (copy->size == 0) {
+                    break;
+                }
+                ToBackend(copy->destination)
+                    ->CopyFromBuffer(ToBackend(copy->source.Get()), copy->sourceOffset,
+                                     copy->destinationOffset, copy->size);
+                break;
+            }
+
+            case Command::ClearBuffer: {
+                ClearBufferCmd* cmd = mCommands.NextCommand<ClearBufferCmd>();
+                if (cmd->size == 0) {
+                    break;
+                }
+                ToBackend(cmd->buffer)->Clear(cmd->offset, cmd->size);
+                break;
+            }
+
+            case Command::WriteBuffer: {
+                WriteBufferCmd* write = mCommands.NextCommand<WriteBufferCmd>();
+                if (write->size == 0) {
+                    break;
+                }
+                const uint8_t* data = mCommands.NextData<uint8_t>(write->size);
+                ToBackend(write->buffer)->DoWriteBuffer(write->offset, data, write->size);
+                break;
+            }
+
+            default:
+                SkipCommand(&mCommands, type);
+                break;
+        }
+    }
+}
+
 // QuerySet
 
 QuerySet::QuerySet(Device* device, const QuerySetDescriptor* descriptor)
@@ -424,10 +481,15 @@ Queue::Queue(Device* device, const QueueDescriptor* descriptor) : QueueBase(devi
 
 Queue::~Queue() {}
 
-MaybeError Queue::SubmitImpl(uint32_t, CommandBufferBase* const*) {
+MaybeError Queue::SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands) {
     Device* device = ToBackend(GetDevice());
 
     DAWN_TRY(device->SubmitPendingOperations());
+    if (device->IsToggleEnabled(Toggle::NullBackendExecuteCommands)) {
+        for (uint32_t i = 0; i < commandCount; ++i) {
+            ToBackend(commands[i])->Execute();
+        }
+    }
     IncrementLastSubmittedCommandSerial();
 
     return {};
@@ -468,6 +530,26 @@ MaybeError Queue::WaitForIdleForDestruction() {
 MaybeError ComputePipeline::InitializeImpl() {
     const ProgrammableStage& computeStage = GetStage(SingleShaderStage::Compute);
 
+    // Do the workgroup size validation, although different backend will have different
+    // fullSubgroups parameter.
+    const CombinedLimits& limits = GetDevice()->GetLimits();
+    const LimitsForCompilationRequest compilationLimits =
+        LimitsForCompilationRequest::Create(limits.v1);
+    const std::optional<uint32_t> maxSubgroupSizeForFullSubgroups =
+        IsFullSubgroupsRequired()
+            ? std::make_optional(limits.experimentalSubgroupLimits.maxSubgroupSize)
+            : std::nullopt;
+
+    // The workgroup size is already known from the reflection when it doesn't depend on
+    // overrides, so there is no need to transform and inspect the program.
+    Extent3D _;
+    if (computeStage.metadata->workgroupSize) {
+        DAWN_TRY_ASSIGN(_,
+                        ValidateComputeStageWorkgroupSize(*computeStage.metadata, compilationLimits,
+                                                          maxSubgroupSizeForFullSubgroups));
+        return {};
+    }
+
     tint::Program transformedProgram;
     tint::ast::transform::Manager transformManager;
     tint::ast::transform::DataMap transformInputs;
@@ -488,17 +570,9 @@ MaybeError ComputePipeline::InitializeImpl() {
     DAWN_TRY_ASSIGN(transformedProgram, RunTransforms(&transformManager, &(tintProgram->program),
                                                       transformInputs, nullptr, nullptr));
 
-    // Do the workgroup size validation, although different backend will have different
-    // fullSubgroups parameter.
-    const CombinedLimits& limits = GetDevice()->GetLimits();
-    Extent3D _;
-    DAWN_TRY_ASSIGN(
-        _, ValidateComputeStageWorkgroupSize(
-               transformedProgram, computeStage.entryPoint.c_str(),
-               LimitsForCompilationRequest::Create(limits.v1), /* maxSubgroupSizeForFullSubgroups */
-               IsFullSubgroupsRequired()
-                   ? std::make_optional(limits.experimentalSubgroupLimits.maxSubgroupSize)
-                   : std::nullopt));
+    DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(
+                           transformedProgram, computeStage.entryPoint.c_str(), compilationLimits,
+                           maxSubgroupSizeForFullSubgroups));
 
     return {};
 }
@@ -258,6 +258,11 @@ class Buffer final : public BufferBase {
                          uint64_t size);
 
     void DoWriteBuffer(uint64_t bufferOffset, const void* data, size_t size);
+    void CopyFromBuffer(const Buffer* source,
+                        uint64_t sourceOffset,
+                        uint64_t destinationOffset,
+                        uint64_t size);
+    void Clear(uint64_t offset, uint64_t size);
 
   private:
     MaybeError MapAsyncImpl(wgpu::MapMode mode, size_t offset, size_t size) override;
@@ -273,6 +278,11 @@ class Buffer final : public BufferBase {
 class CommandBuffer final : public CommandBufferBase {
   public:
     CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
+
+    // Executes the buffer copies, clears and writes of the command buffer on the CPU so that
+    // their results can be read back. Texture copies are skipped, and so are passes since the
+    // null backend has no way to run shaders.
+    void Execute();
 };
 
 class QuerySet final : public QuerySetBase {
@@ -1224,6 +1224,119 @@ MaybeError CommandBuffer::ExecuteRenderPass(BeginRenderPassCmd* renderPass) {
                 break;
             }
 
+            case Command::MultiDrawIndirect: {
+                MultiDrawIndirectCmd* cmd = iter->NextCommand<MultiDrawIndirectCmd>();
+
+                if (lastPipeline->UsesInstanceIndex()) {
+                    gl.Uniform1ui(PipelineLayout::PushConstantLocation::FirstInstance, 0);
+                }
+                vertexStateBufferBindingTracker.Apply(gl, 0, 0);
+                bindGroupTracker.Apply(gl);
+
+                Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
+                DAWN_ASSERT(indirectBuffer != nullptr);
+
+                // Count buffer is optional
+                Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
+
+                const GLenum topology = lastPipeline->GetGLPrimitiveTopology();
+                const void* indirect =
+                    reinterpret_cast<void*>(static_cast<intptr_t>(cmd->indirectOffset));
+
+                gl.BindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer->GetHandle());
+                if (gl.GetVersion().IsES()) {
+                    // Without a native draw count, the indirect draw validation zeroed the
+                    // draws past the count, so maxDrawCount draws are always issued.
+                    gl.MultiDrawArraysIndirectEXT(topology, indirect, cmd->maxDrawCount,
+                                                  kDrawIndirectSize);
+                } else if (countBuffer == nullptr) {
+                    gl.MultiDrawArraysIndirect(topology, indirect, cmd->maxDrawCount,
+                                               kDrawIndirectSize);
+                } else {
+                    const GLintptr drawCountOffset = static_cast<GLintptr>(cmd->drawCountOffset);
+                    const bool hasNativeDrawCount =
+                        gl.IsAtLeastGL(4, 6) ||
+                        gl.IsGLExtensionSupported("GL_ARB_indirect_parameters");
+                    if (hasNativeDrawCount) {
+                        gl.BindBuffer(GL_PARAMETER_BUFFER, countBuffer->GetHandle());
+                    }
+                    if (gl.IsAtLeastGL(4, 6)) {
+                        gl.MultiDrawArraysIndirectCount(topology, indirect, drawCountOffset,
+                                                        cmd->maxDrawCount, kDrawIndirectSize);
+                    } else if (hasNativeDrawCount) {
+                        gl.MultiDrawArraysIndirectCountARB(topology, indirect, drawCountOffset,
+                                                           cmd->maxDrawCount, kDrawIndirectSize);
+                    } else {
+                        // See Device::ShouldEmulateIndirectDrawCount.
+                        gl.MultiDrawArraysIndirect(topology, indirect, cmd->maxDrawCount,
+                                                   kDrawIndirectSize);
+                    }
+                    countBuffer->TrackUsage();
+                }
+                indirectBuffer->TrackUsage();
+                break;
+            }
+
+            case Command::MultiDrawIndexedIndirect: {
+                MultiDrawIndexedIndirectCmd* cmd = iter->NextCommand<MultiDrawIndexedIndirectCmd>();
+
+                if (lastPipeline->UsesInstanceIndex()) {
+                    gl.Uniform1ui(PipelineLayout::PushConstantLocation::FirstInstance, 0);
+                }
+                vertexStateBufferBindingTracker.Apply(gl, 0, 0);
+                bindGroupTracker.Apply(gl);
+
+                Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
+                DAWN_ASSERT(indirectBuffer != nullptr);
+
+                // Count buffer is optional
+                Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
+
+                const GLenum topology = lastPipeline->GetGLPrimitiveTopology();
+                if (topology == GL_LINE_STRIP || topology == GL_TRIANGLE_STRIP) {
+                    gl.Enable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+                } else {
+                    gl.Disable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+                }
+                const void* indirect =
+                    reinterpret_cast<void*>(static_cast<intptr_t>(cmd->indirectOffset));
+
+                // The index buffer offset was folded into firstIndex by the indirect draw
+                // validation, like for DrawIndexedIndirect.
+                gl.BindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer->GetHandle());
+                if (gl.GetVersion().IsES()) {
+                    gl.MultiDrawElementsIndirectEXT(topology, indexBufferFormat, indirect,
+                                                    cmd->maxDrawCount, kDrawIndexedIndirectSize);
+                } else if (countBuffer == nullptr) {
+                    gl.MultiDrawElementsIndirect(topology, indexBufferFormat, indirect,
+                                                 cmd->maxDrawCount, kDrawIndexedIndirectSize);
+                } else {
+                    const GLintptr drawCountOffset = static_cast<GLintptr>(cmd->drawCountOffset);
+                    const bool hasNativeDrawCount =
+                        gl.IsAtLeastGL(4, 6) ||
+                        gl.IsGLExtensionSupported("GL_ARB_indirect_parameters");
+                    if (hasNativeDrawCount) {
+                        gl.BindBuffer(GL_PARAMETER_BUFFER, countBuffer->GetHandle());
+                    }
+                    if (gl.IsAtLeastGL(4, 6)) {
+                        gl.MultiDrawElementsIndirectCount(topology, indexBufferFormat, indirect,
+                                                          drawCountOffset, cmd->maxDrawCount,
+                                                          kDrawIndexedIndirectSize);
+                    } else if (hasNativeDrawCount) {
+                        gl.MultiDrawElementsIndirectCountARB(topology, indexBufferFormat, indirect,
+                                                             drawCountOffset, cmd->maxDrawCount,
+                                                             kDrawIndexedIndirectSize);
+                    } else {
+                        // See Device::ShouldEmulateIndirectDrawCount.
+                        gl.MultiDrawElementsIndirect(topology, indexBufferFormat, indirect,
+                                                     cmd->maxDrawCount, kDrawIndexedIndirectSize);
+                    }
+                    countBuffer->TrackUsage();
+                }
+                indirectBuffer->TrackUsage();
+                break;
+            }
+
             case Command::InsertDebugMarker:
             case Command::PopDebugGroup:
             case Command::PushDebugGroup: {
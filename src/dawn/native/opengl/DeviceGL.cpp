@@ -201,6 +201,8 @@ MaybeError Device::Initialize(const UnpackedPtr<DeviceDescriptor>& descriptor) {
     if (HasAnisotropicFiltering(gl)) {
         gl.GetIntegerv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &mMaxTextureMaxAnisotropy);
     }
+    mEmulateIndirectDrawCount =
+        !gl.IsAtLeastGL(4, 6) && !gl.IsGLExtensionSupported("GL_ARB_indirect_parameters");
     return DeviceBase::Initialize(std::move(queue));
 }
 
@@ -431,6 +433,10 @@ bool Device::ShouldApplyIndexBufferOffsetToFirstIndex() const {
     return true;
 }
 
+bool Device::ShouldEmulateIndirectDrawCount() const {
+    return mEmulateIndirectDrawCount;
+}
+
 const OpenGLFunctions& Device::GetGL() const {
     mContext->MakeCurrent();
     ToBackend(GetQueue())->OnGLUsed();
@@ -100,6 +100,7 @@ class Device final : public DeviceBase {
 
     bool MayRequireDuplicationOfIndirectParameters() const override;
     bool ShouldApplyIndexBufferOffsetToFirstIndex() const override;
+    bool ShouldEmulateIndirectDrawCount() const override;
 
   private:
     Device(AdapterBase* adapter,
@@ -147,6 +148,7 @@ class Device final : public DeviceBase {
     GLFormatTable mFormatTable;
     std::unique_ptr<ContextEGL> mContext;
     int mMaxTextureMaxAnisotropy = 0;
+    bool mEmulateIndirectDrawCount = false;
 };
 
 }  // namespace dawn::native::opengl
@@ -261,6 +261,14 @@ void PhysicalDevice::InitializeSupportedFeaturesImpl() {
         EnableFeature(Feature::IndirectFirstInstance);
     }
 
+    // MultiDrawIndirect is core in desktop OpenGL 4.3 and needs GL_EXT_multi_draw_indirect on
+    // OpenGL ES. The drawCountBuffer variant is emulated when glMultiDraw*IndirectCount is
+    // unavailable, see Device::ShouldEmulateIndirectDrawCount.
+    if (mFunctions.IsAtLeastGL(4, 3) ||
+        mFunctions.IsGLExtensionSupported("GL_EXT_multi_draw_indirect")) {
+        EnableFeature(Feature::MultiDrawIndirect);
+    }
+
     // ShaderF16
     if (mFunctions.IsGLExtensionSupported("GL_AMD_gpu_shader_half_float")) {
         EnableFeature(Feature::ShaderF16);
@@ -93,6 +93,7 @@ using InterstageLocationAndName = std::pair<uint32_t, std::string>;
     X(SingleShaderStage, stage)                                                                  \
     X(std::optional<tint::ast::transform::SubstituteOverride::Config>, substituteOverrideConfig) \
     X(LimitsForCompilationRequest, limits)                                                       \
+    X(bool, workgroupSizeValidatedFromReflection)                                                \
     X(bool, disableSymbolRenaming)                                                               \
     X(std::vector<InterstageLocationAndName>, interstageVariables)                               \
     X(std::vector<std::string>, bufferBindingVariables)                                          \
@@ -459,6 +460,16 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
     req.limits = LimitsForCompilationRequest::Create(limits.v1);
     req.platform = UnsafeUnkeyedValue(GetDevice()->GetPlatform());
 
+    // Entry points whose workgroup size doesn't depend on overrides are validated from the
+    // reflection, so the compilation doesn't need to inspect the transformed program.
+    if (stage == SingleShaderStage::Compute && programmableStage.metadata->workgroupSize) {
+        Extent3D _;
+        DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(*programmableStage.metadata,
+                                                             req.limits,
+                                                             /* fullSubgroups */ {}));
+        req.workgroupSizeValidatedFromReflection = true;
+    }
+
     req.tintOptions.version = tint::glsl::writer::Version(ToTintGLStandard(version.GetStandard()),
                                                           version.GetMajor(), version.GetMinor());
 
@@ -559,7 +570,7 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
             }
             DAWN_ASSERT(remappedEntryPoint != "");
 
-            if (r.stage == SingleShaderStage::Compute) {
+            if (r.stage == SingleShaderStage::Compute && !r.workgroupSizeValidatedFromReflection) {
                 // Validate workgroup size after program runs transforms.
                 Extent3D _;
                 DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(
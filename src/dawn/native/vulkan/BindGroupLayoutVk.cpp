@@ -178,6 +178,55 @@ MaybeError BindGroupLayout::Initialize() {
                                                                  nullptr, &*mHandle),
                             "CreateDescriptorSetLayout"));
 
+    // Compute the descriptors written for each bind group. Static samplers are immutable samplers
+    // of the VkDescriptorSetLayout so they aren't written, and textures paired with a static
+    // sampler are written in the combined image sampler entry of that sampler.
+    for (BindingIndex bindingIndex : Range(GetBindingCount())) {
+        const BindingInfo& bindingInfo = GetBindingInfo(bindingIndex);
+        if (std::holds_alternative<StaticSamplerBindingInfo>(bindingInfo.bindingLayout)) {
+            continue;
+        }
+
+        VkDescriptorUpdateTemplateEntry entry;
+        entry.dstBinding = static_cast<uint32_t>(bindingIndex);
+        entry.dstArrayElement = 0;
+        entry.descriptorCount = 1;
+        entry.descriptorType = VulkanDescriptorType(bindingInfo);
+        entry.offset = mDescriptorUpdateEntries.size() * sizeof(DescriptorUpdateData);
+        entry.stride = sizeof(DescriptorUpdateData);
+
+        if (auto samplerIndex = GetStaticSamplerIndexForTexture(bindingIndex)) {
+            entry.dstBinding = static_cast<uint32_t>(samplerIndex.value());
+            entry.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        }
+
+        mDescriptorUpdateEntries.push_back(entry);
+    }
+
+    // The layout of the descriptor writes is the same for all the bind groups of this layout, so
+    // create a template once that writes them all from the packed DescriptorUpdateData.
+    if (device->IsToggleEnabled(Toggle::VulkanUseDescriptorUpdateTemplates) &&
+        !mDescriptorUpdateEntries.empty()) {
+        VkDescriptorUpdateTemplateCreateInfo templateCreateInfo;
+        templateCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        templateCreateInfo.pNext = nullptr;
+        templateCreateInfo.flags = 0;
+        templateCreateInfo.descriptorUpdateEntryCount =
+            static_cast<uint32_t>(mDescriptorUpdateEntries.size());
+        templateCreateInfo.pDescriptorUpdateEntries = mDescriptorUpdateEntries.data();
+        templateCreateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        templateCreateInfo.descriptorSetLayout = mHandle;
+        // The remaining members are only used for push descriptor templates.
+        templateCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        templateCreateInfo.pipelineLayout = VK_NULL_HANDLE;
+        templateCreateInfo.set = 0;
+
+        DAWN_TRY(CheckVkSuccess(
+            device->fn.CreateDescriptorUpdateTemplate(device->GetVkDevice(), &templateCreateInfo,
+                                                      nullptr, &*mDescriptorUpdateTemplate),
+            "CreateDescriptorUpdateTemplate"));
+    }
+
     // Compute the size of descriptor pools used for this layout.
     absl::flat_hash_map<VkDescriptorType, uint32_t> descriptorCountPerType;
 
@@ -247,6 +296,13 @@ void BindGroupLayout::DestroyImpl() {
         device->fn.DestroyDescriptorSetLayout(device->GetVkDevice(), mHandle, nullptr);
         mHandle = VK_NULL_HANDLE;
     }
+    // Like the DescriptorSetLayout, the template is only used on the host to write descriptor
+    // sets so it can be destroyed immediately.
+    if (mDescriptorUpdateTemplate != VK_NULL_HANDLE) {
+        device->fn.DestroyDescriptorUpdateTemplate(device->GetVkDevice(),
+                                                   mDescriptorUpdateTemplate, nullptr);
+        mDescriptorUpdateTemplate = VK_NULL_HANDLE;
+    }
     mDescriptorSetAllocator = nullptr;
 }
 
@@ -254,6 +310,15 @@ VkDescriptorSetLayout BindGroupLayout::GetHandle() const {
     return mHandle;
 }
 
+const std::vector<VkDescriptorUpdateTemplateEntry>& BindGroupLayout::GetDescriptorUpdateEntries()
+    const {
+    return mDescriptorUpdateEntries;
+}
+
+VkDescriptorUpdateTemplate BindGroupLayout::GetDescriptorUpdateTemplate() const {
+    return mDescriptorUpdateTemplate;
+}
+
 ResultOrError<Ref<BindGroup>> BindGroupLayout::AllocateBindGroup(
     Device* device,
     const BindGroupDescriptor* descriptor) {
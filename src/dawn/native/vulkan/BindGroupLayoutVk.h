@@ -48,6 +48,13 @@ class Device;
 
 VkDescriptorType VulkanDescriptorType(const BindingInfo& bindingInfo);
 
+// The data of a single descriptor written to a VkDescriptorSet. BindGroups pack one per descriptor
+// update entry of their layout so that it can be read by the layout's VkDescriptorUpdateTemplate.
+union DescriptorUpdateData {
+    VkDescriptorBufferInfo bufferInfo;
+    VkDescriptorImageInfo imageInfo;
+};
+
 // In Vulkan descriptor pools have to be sized to an exact number of descriptors. This means
 // it's hard to have something where we can mix different types of descriptor sets because
 // we don't know if their vector of number of descriptors will be similar.
@@ -69,6 +76,12 @@ class BindGroupLayout final : public BindGroupLayoutInternalBase {
 
     VkDescriptorSetLayout GetHandle() const;
 
+    // The descriptors written for each bind group, in BindingIndex order, skipping static
+    // samplers. Their offsets index an array of DescriptorUpdateData.
+    const std::vector<VkDescriptorUpdateTemplateEntry>& GetDescriptorUpdateEntries() const;
+    // VK_NULL_HANDLE if descriptor update templates aren't used.
+    VkDescriptorUpdateTemplate GetDescriptorUpdateTemplate() const;
+
     ResultOrError<Ref<BindGroup>> AllocateBindGroup(Device* device,
                                                     const BindGroupDescriptor* descriptor);
     void DeallocateBindGroup(BindGroup* bindGroup,
@@ -93,6 +106,9 @@ class BindGroupLayout final : public BindGroupLayoutInternalBase {
 
     VkDescriptorSetLayout mHandle = VK_NULL_HANDLE;
 
+    std::vector<VkDescriptorUpdateTemplateEntry> mDescriptorUpdateEntries;
+    VkDescriptorUpdateTemplate mDescriptorUpdateTemplate = VK_NULL_HANDLE;
+
     MutexProtected<SlabAllocator<BindGroup>> mBindGroupAllocator;
     MutexProtected<Ref<DescriptorSetAllocator>> mDescriptorSetAllocator;
 };
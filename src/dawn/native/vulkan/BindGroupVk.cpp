@@ -27,6 +27,8 @@
 
 #include "dawn/native/vulkan/BindGroupVk.h"
 
+#include <vector>
+
 #include "dawn/common/BitSetIterator.h"
 #include "dawn/common/MatchVariant.h"
 #include "dawn/common/Range.h"
@@ -43,6 +45,56 @@
 
 namespace dawn::native::vulkan {
 
+namespace {
+
+// Writes the descriptors one VkWriteDescriptorSet at a time, for when the descriptor update
+// template can't be used.
+void WriteDescriptors(Device* device,
+                      VkDescriptorSet set,
+                      const std::vector<VkDescriptorUpdateTemplateEntry>& entries,
+                      const DescriptorUpdateData* descriptorData,
+                      const bool* shouldWriteDescriptor) {
+    const uint32_t descriptorCount = static_cast<uint32_t>(entries.size());
+    ityp::stack_vec<uint32_t, VkWriteDescriptorSet, kMaxOptimalBindingsPerGroup> writes(
+        descriptorCount);
+    uint32_t numWrites = 0;
+    for (uint32_t i = 0; i < descriptorCount; ++i) {
+        if (!shouldWriteDescriptor[i]) {
+            continue;
+        }
+
+        const VkDescriptorUpdateTemplateEntry& entry = entries[i];
+        auto& write = writes[numWrites];
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.pNext = nullptr;
+        write.dstSet = set;
+        write.dstBinding = entry.dstBinding;
+        write.dstArrayElement = entry.dstArrayElement;
+        write.descriptorCount = entry.descriptorCount;
+        write.descriptorType = entry.descriptorType;
+        write.pImageInfo = nullptr;
+        write.pBufferInfo = nullptr;
+        write.pTexelBufferView = nullptr;
+
+        switch (entry.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                write.pBufferInfo = &descriptorData[i].bufferInfo;
+                break;
+            default:
+                write.pImageInfo = &descriptorData[i].imageInfo;
+                break;
+        }
+        numWrites++;
+    }
+
+    device->fn.UpdateDescriptorSets(device->GetVkDevice(), numWrites, writes.data(), 0, nullptr);
+}
+
+}  // anonymous namespace
+
 // static
 ResultOrError<Ref<BindGroup>> BindGroup::Create(Device* device,
                                                 const BindGroupDescriptor* descriptor) {
@@ -54,30 +106,31 @@ BindGroup::BindGroup(Device* device,
                      const BindGroupDescriptor* descriptor,
                      DescriptorSetAllocation descriptorSetAllocation)
     : BindGroupBase(this, device, descriptor), mDescriptorSetAllocation(descriptorSetAllocation) {
-    // Now do a write of a single descriptor set with all possible chained data allocated on the
-    // stack.
-    const uint32_t bindingCount = static_cast<uint32_t>((GetLayout()->GetBindingCount()));
-    ityp::stack_vec<uint32_t, VkWriteDescriptorSet, kMaxOptimalBindingsPerGroup> writes(
-        bindingCount);
-    ityp::stack_vec<uint32_t, VkDescriptorBufferInfo, kMaxOptimalBindingsPerGroup> writeBufferInfo(
-        bindingCount);
-    ityp::stack_vec<uint32_t, VkDescriptorImageInfo, kMaxOptimalBindingsPerGroup> writeImageInfo(
-        bindingCount);
+    const BindGroupLayout* layout = ToBackend(GetLayout());
+    const std::vector<VkDescriptorUpdateTemplateEntry>& entries =
+        layout->GetDescriptorUpdateEntries();
+    const uint32_t descriptorCount = static_cast<uint32_t>(entries.size());
 
-    uint32_t numWrites = 0;
+    // Pack the data of all the descriptors on the stack, in the order of the layout's descriptor
+    // update entries.
+    ityp::stack_vec<uint32_t, DescriptorUpdateData, kMaxOptimalBindingsPerGroup> descriptorData(
+        descriptorCount);
+    ityp::stack_vec<uint32_t, bool, kMaxOptimalBindingsPerGroup> shouldWriteDescriptor(
+        descriptorCount);
+    bool skippedDescriptor = false;
+
+    uint32_t descriptorIndex = 0;
     for (BindingIndex bindingIndex : Range(GetLayout()->GetBindingCount())) {
         const BindingInfo& bindingInfo = GetLayout()->GetBindingInfo(bindingIndex);
+        if (std::holds_alternative<StaticSamplerBindingInfo>(bindingInfo.bindingLayout)) {
+            // Static samplers are bound into the Vulkan layout as immutable samplers at
+            // BindGroupLayout creation time. There is no work to be done at BindGroup creation
+            // time.
+            continue;
+        }
 
-        auto& write = writes[numWrites];
-        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        write.pNext = nullptr;
-        write.dstSet = GetHandle();
-        write.dstBinding = static_cast<uint32_t>(bindingIndex);
-        write.dstArrayElement = 0;
-        write.descriptorCount = 1;
-        write.descriptorType = VulkanDescriptorType(bindingInfo);
-
-        bool shouldWriteDescriptor = MatchVariant(
+        DescriptorUpdateData& data = descriptorData[descriptorIndex];
+        bool shouldWrite = MatchVariant(
             bindingInfo.bindingLayout,
             [&](const BufferBindingInfo&) -> bool {
                 BufferBinding binding = GetBindingAsBufferBinding(bindingIndex);
@@ -90,22 +143,20 @@ BindGroup::BindGroup(Device* device,
                     // resources.
                     return false;
                 }
-                writeBufferInfo[numWrites].buffer = handle;
-                writeBufferInfo[numWrites].offset = binding.offset;
-                writeBufferInfo[numWrites].range = binding.size;
-                write.pBufferInfo = &writeBufferInfo[numWrites];
+                data.bufferInfo.buffer = handle;
+                data.bufferInfo.offset = binding.offset;
+                data.bufferInfo.range = binding.size;
                 return true;
             },
             [&](const SamplerBindingInfo&) -> bool {
                 Sampler* sampler = ToBackend(GetBindingAsSampler(bindingIndex));
-                writeImageInfo[numWrites].sampler = sampler->GetHandle();
-                write.pImageInfo = &writeImageInfo[numWrites];
+                data.imageInfo.sampler = sampler->GetHandle();
+                data.imageInfo.imageView = VK_NULL_HANDLE;
+                data.imageInfo.imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
                 return true;
             },
-            [&](const StaticSamplerBindingInfo& layout) -> bool {
-                // Static samplers are bound into the Vulkan layout as immutable
-                // samplers at BindGroupLayout creation time. There is no work
-                // to be done at BindGroup creation time.
+            [&](const StaticSamplerBindingInfo&) -> bool {
+                DAWN_UNREACHABLE();
                 return false;
             },
             [&](const TextureBindingInfo&) -> bool {
@@ -121,24 +172,12 @@ BindGroup::BindGroup(Device* device,
                     return false;
                 }
 
-                // TODO(crbug.com/41488897: Add GetVkDescriptorSet{Index,
-                // Type}(BindingIndex) functions to BindGroupLayoutVk that
-                // access vectors holding entries for all BGL entries and
-                // eliminate this special-case code in favor of calling those
-                // functions to assign `dstBinding` and `descriptorType` above.
-                if (auto samplerIndex =
-                        ToBackend(GetLayout())->GetStaticSamplerIndexForTexture(bindingIndex)) {
-                    // Write the info of the texture at the binding index for the
-                    // sampler.
-                    write.dstBinding = static_cast<uint32_t>(samplerIndex.value());
-                    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-                }
-
-                writeImageInfo[numWrites].imageView = handle;
-                writeImageInfo[numWrites].imageLayout = VulkanImageLayout(
-                    view->GetTexture()->GetFormat(), wgpu::TextureUsage::TextureBinding);
-
-                write.pImageInfo = &writeImageInfo[numWrites];
+                // Textures paired with a static sampler are written in the combined image
+                // sampler of the layout, where the sampler is immutable and ignored.
+                data.imageInfo.sampler = VK_NULL_HANDLE;
+                data.imageInfo.imageView = handle;
+                data.imageInfo.imageLayout = VulkanImageLayout(view->GetTexture()->GetFormat(),
+                                                               wgpu::TextureUsage::TextureBinding);
                 return true;
             },
             [&](const StorageTextureBindingInfo&) -> bool {
@@ -158,10 +197,9 @@ BindGroup::BindGroup(Device* device,
                     // resources.
                     return false;
                 }
-                writeImageInfo[numWrites].imageView = handle;
-                writeImageInfo[numWrites].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-
-                write.pImageInfo = &writeImageInfo[numWrites];
+                data.imageInfo.sampler = VK_NULL_HANDLE;
+                data.imageInfo.imageView = handle;
+                data.imageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
                 return true;
             },
             [&](const InputAttachmentBindingInfo&) -> bool {
@@ -176,20 +214,28 @@ BindGroup::BindGroup(Device* device,
                     // resources.
                     return false;
                 }
-                writeImageInfo[numWrites].imageView = handle;
-                writeImageInfo[numWrites].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-                write.pImageInfo = &writeImageInfo[numWrites];
+                data.imageInfo.sampler = VK_NULL_HANDLE;
+                data.imageInfo.imageView = handle;
+                data.imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
                 return true;
             });
 
-        if (shouldWriteDescriptor) {
-            numWrites++;
-        }
+        shouldWriteDescriptor[descriptorIndex] = shouldWrite;
+        skippedDescriptor |= !shouldWrite;
+        descriptorIndex++;
     }
+    DAWN_ASSERT(descriptorIndex == descriptorCount);
 
-    // TODO(crbug.com/dawn/855): Batch these updates
-    device->fn.UpdateDescriptorSets(device->GetVkDevice(), numWrites, writes.data(), 0, nullptr);
+    // Write all the descriptors in a single call with the layout's template. It can't skip
+    // descriptors, so bind groups with skipped descriptors are written one descriptor at a time.
+    VkDescriptorUpdateTemplate updateTemplate = layout->GetDescriptorUpdateTemplate();
+    if (updateTemplate != VK_NULL_HANDLE && !skippedDescriptor) {
+        device->fn.UpdateDescriptorSetWithTemplate(device->GetVkDevice(), GetHandle(),
+                                                   updateTemplate, descriptorData.data());
+    } else {
+        WriteDescriptors(device, GetHandle(), entries, descriptorData.data(),
+                         shouldWriteDescriptor.data());
+    }
 
     SetLabelImpl();
 }
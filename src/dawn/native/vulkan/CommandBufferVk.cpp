@@ -28,8 +28,16 @@
 #include "dawn/native/vulkan/CommandBufferVk.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "dawn/native/AsyncTask.h"
 #include "dawn/native/BindGroupTracker.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/CommandValidation.h"
@@ -43,6 +51,7 @@
 #include "dawn/native/vulkan/ComputePipelineVk.h"
 #include "dawn/native/vulkan/DeviceVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
+#include "dawn/native/vulkan/FramebufferCache.h"
 #include "dawn/native/vulkan/PhysicalDeviceVk.h"
 #include "dawn/native/vulkan/PipelineLayoutVk.h"
 #include "dawn/native/vulkan/QuerySetVk.h"
@@ -167,16 +176,14 @@ class DescriptorSetTracker : public BindGroupTrackerBase<true, uint32_t> {
         mInternalImmediateDataSize = pipeline->GetInternalImmediateDataSize();
     }
 
-    void Apply(Device* device,
-               CommandRecordingContext* recordingContext,
-               VkPipelineBindPoint bindPoint) {
+    void Apply(Device* device, VkCommandBuffer commands, VkPipelineBindPoint bindPoint) {
         BeforeApply();
         for (BindGroupIndex dirtyIndex : IterateBitSet(mDirtyBindGroupsObjectChangedOrIsDynamic)) {
             VkDescriptorSet set = ToBackend(mBindGroups[dirtyIndex])->GetHandle();
             uint32_t count = static_cast<uint32_t>(mDynamicOffsets[dirtyIndex].size());
             const uint32_t* dynamicOffset =
                 count > 0 ? mDynamicOffsets[dirtyIndex].data() : nullptr;
-            device->fn.CmdBindDescriptorSets(recordingContext->commandBuffer, bindPoint, mVkLayout,
+            device->fn.CmdBindDescriptorSets(commands, bindPoint, mVkLayout,
                                              static_cast<uint32_t>(dirtyIndex), 1, &*set, count,
                                              dynamicOffset);
         }
@@ -251,17 +258,10 @@ MaybeError TransitionAndClearForSyncScope(Device* device,
         }
     }
 
-    auto MergeImageBarriers = [](Barriers* barriers, VkPipelineStageFlags srcStages,
-                                 VkPipelineStageFlags dstStages,
-                                 const std::vector<VkImageMemoryBarrier>& imageBarriers) {
-        barriers->srcStages |= srcStages;
-        barriers->dstStages |= dstStages;
-        barriers->imageBarriers.insert(barriers->imageBarriers.end(), imageBarriers.begin(),
-                                       imageBarriers.end());
-    };
-
-    // TODO(crbug.com/dawn/851): Add image barriers directly to the correct vector.
-    std::vector<VkImageMemoryBarrier> imageBarriers;
+    // The image barriers of all the textures are batched in the two pipeline barriers below. They
+    // are recorded directly in the non-vertex barriers and moved to the vertex barriers after the
+    // fact for the textures whose destination stages turn out to contain vertex stages.
+    std::vector<VkImageMemoryBarrier>& imageBarriers = nonVertexBarriers.imageBarriers;
     for (size_t i = 0; i < scope.textures.size(); ++i) {
         Texture* texture = ToBackend(scope.textures[i]);
 
@@ -278,22 +278,32 @@ MaybeError TransitionAndClearForSyncScope(Device* device,
                 }
                 return {};
             }));
+        size_t textureBarrierStart = imageBarriers.size();
         texture->TransitionUsageForPass(recordingContext, scope.textureSyncInfos[i], &imageBarriers,
                                         &srcStages, &dstStages);
 
-        if (!imageBarriers.empty()) {
-            MergeImageBarriers((dstStages & vertexStages) ? &vertexBarriers : &nonVertexBarriers,
-                               srcStages, dstStages, imageBarriers);
-            imageBarriers.clear();
+        if (imageBarriers.size() == textureBarrierStart) {
+            continue;
+        }
+        if (dstStages & vertexStages) {
+            vertexBarriers.srcStages |= srcStages;
+            vertexBarriers.dstStages |= dstStages;
+            vertexBarriers.imageBarriers.insert(vertexBarriers.imageBarriers.end(),
+                                                imageBarriers.begin() + textureBarrierStart,
+                                                imageBarriers.end());
+            imageBarriers.resize(textureBarrierStart);
+        } else {
+            nonVertexBarriers.srcStages |= srcStages;
+            nonVertexBarriers.dstStages |= dstStages;
         }
     }
 
-    for (const Barriers& barriers : {vertexBarriers, nonVertexBarriers}) {
-        if (!barriers.bufferBarriers.empty() || !barriers.imageBarriers.empty()) {
+    for (const Barriers* barriers : {&vertexBarriers, &nonVertexBarriers}) {
+        if (!barriers->bufferBarriers.empty() || !barriers->imageBarriers.empty()) {
             device->fn.CmdPipelineBarrier(
-                recordingContext->commandBuffer, barriers.srcStages, barriers.dstStages, 0, 0,
-                nullptr, barriers.bufferBarriers.size(), barriers.bufferBarriers.data(),
-                barriers.imageBarriers.size(), barriers.imageBarriers.data());
+                recordingContext->commandBuffer, barriers->srcStages, barriers->dstStages, 0, 0,
+                nullptr, barriers->bufferBarriers.size(), barriers->bufferBarriers.data(),
+                barriers->imageBarriers.size(), barriers->imageBarriers.data());
         }
     }
 
@@ -333,14 +343,12 @@ void ResetUsedQuerySetsOnRenderPass(Device* device,
     }
 }
 
-void RecordWriteTimestampCmd(CommandRecordingContext* recordingContext,
+void RecordWriteTimestampCmd(VkCommandBuffer commands,
                              Device* device,
                              QuerySetBase* querySet,
                              uint32_t queryIndex,
                              bool isRenderPass,
                              VkPipelineStageFlagBits pipelineStage) {
-    VkCommandBuffer commands = recordingContext->commandBuffer;
-
     // The queries must be reset between uses, and the reset command cannot be called in render
     // pass.
     if (!isRenderPass) {
@@ -392,11 +400,506 @@ void RecordResolveQuerySetCmd(VkCommandBuffer commands,
     }
 }
 
+void RecordBeginDebugUtilsLabel(Device* device, VkCommandBuffer commands, const char* label) {
+    VkDebugUtilsLabelEXT utilsLabel;
+    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+    utilsLabel.pNext = nullptr;
+    utilsLabel.pLabelName = label;
+    // Default color to black
+    utilsLabel.color[0] = 0.0;
+    utilsLabel.color[1] = 0.0;
+    utilsLabel.color[2] = 0.0;
+    utilsLabel.color[3] = 1.0;
+    device->fn.CmdBeginDebugUtilsLabelEXT(commands, &utilsLabel);
+}
+
+// The dynamic state set by render passes. Secondary command buffers don't inherit it so it is
+// tracked to be set again at the start of each of them.
+struct RenderPassDynamicState {
+    VkViewport viewport;
+    VkRect2D scissorRect;
+    std::array<float, 4> blendConstants = {0.0f, 0.0f, 0.0f, 0.0f};
+    uint32_t stencilReference = 0;
+};
+
+RenderPassDynamicState GetDefaultDynamicState(const BeginRenderPassCmd* renderPass) {
+    RenderPassDynamicState state;
+
+    // The viewport and scissor default to cover all of the attachments
+    state.viewport.x = 0.0f;
+    state.viewport.y = static_cast<float>(renderPass->height);
+    state.viewport.width = static_cast<float>(renderPass->width);
+    state.viewport.height = -static_cast<float>(renderPass->height);
+    state.viewport.minDepth = 0.0f;
+    state.viewport.maxDepth = 1.0f;
+
+    state.scissorRect.offset.x = 0;
+    state.scissorRect.offset.y = 0;
+    state.scissorRect.extent.width = renderPass->width;
+    state.scissorRect.extent.height = renderPass->height;
+
+    return state;
+}
+
+void RecordDynamicState(Device* device,
+                        VkCommandBuffer commands,
+                        const RenderPassDynamicState& state) {
+    device->fn.CmdSetLineWidth(commands, 1.0f);
+    device->fn.CmdSetDepthBounds(commands, 0.0f, 1.0f);
+
+    device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK, state.stencilReference);
+    device->fn.CmdSetBlendConstants(commands, state.blendConstants.data());
+    device->fn.CmdSetViewport(commands, 0, 1, &state.viewport);
+    device->fn.CmdSetScissor(commands, 0, 1, &state.scissorRect);
+}
+
+VkViewport ToVulkanViewport(const SetViewportCmd* cmd) {
+    VkViewport viewport;
+    viewport.x = cmd->x;
+    viewport.y = cmd->y + cmd->height;
+    viewport.width = cmd->width;
+    viewport.height = -cmd->height;
+    viewport.minDepth = cmd->minDepth;
+    viewport.maxDepth = cmd->maxDepth;
+
+    // Vulkan disallows width = 0, but VK_KHR_maintenance1 which we require allows
+    // height = 0 so use that to do an empty viewport.
+    if (viewport.width == 0) {
+        viewport.height = 0;
+
+        // Set the viewport x range to a range that's always valid.
+        viewport.x = 0;
+        viewport.width = 1;
+    }
+    return viewport;
+}
+
+VkRect2D ToVulkanRect(const SetScissorRectCmd* cmd) {
+    VkRect2D rect;
+    rect.offset.x = cmd->x;
+    rect.offset.y = cmd->y;
+    rect.extent.width = cmd->width;
+    rect.extent.height = cmd->height;
+    return rect;
+}
+
+// The state tracked while recording the commands that can be both in render passes and render
+// bundles.
+struct RenderCommandRecordingState {
+    DescriptorSetTracker descriptorSets = {};
+    raw_ptr<RenderPipeline> lastPipeline = nullptr;
+
+    // Tracking for the push constants needed by the ClampFragDepth transform.
+    // TODO(dawn:1125): Avoid the need for this when the depthClamp feature is available, but doing
+    // so would require fixing issue dawn:1576 first to have more dynamic push constant usage. (and
+    // also additional tests that the dirtying logic here is correct so with a Toggle we can test it
+    // on our infra).
+    ClampFragDepthArgs clampFragDepthArgs = {0.0f, 1.0f};
+    bool clampFragDepthArgsDirty = true;
+};
+
+void ApplyClampFragDepthArgs(Device* device,
+                             VkCommandBuffer commands,
+                             RenderCommandRecordingState* state) {
+    if (!state->clampFragDepthArgsDirty || state->lastPipeline == nullptr) {
+        return;
+    }
+    device->fn.CmdPushConstants(
+        commands, state->lastPipeline->GetVkLayout(),
+        ToBackend(state->lastPipeline->GetLayout())->GetImmediateDataRangeStage(),
+        kClampFragDepthArgsOffset, kClampFragDepthArgsSize, &state->clampFragDepthArgs);
+    state->clampFragDepthArgsDirty = false;
+}
+
+void RecordRenderCommand(Device* device,
+                         VkCommandBuffer commands,
+                         RenderCommandRecordingState* state,
+                         CommandIterator* iter,
+                         Command type) {
+    DescriptorSetTracker& descriptorSets = state->descriptorSets;
+
+    switch (type) {
+        case Command::Draw: {
+            DrawCmd* draw = iter->NextCommand<DrawCmd>();
+
+            descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            device->fn.CmdDraw(commands, draw->vertexCount, draw->instanceCount, draw->firstVertex,
+                               draw->firstInstance);
+            break;
+        }
+
+        case Command::DrawIndexed: {
+            DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+
+            descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            device->fn.CmdDrawIndexed(commands, draw->indexCount, draw->instanceCount,
+                                      draw->firstIndex, draw->baseVertex, draw->firstInstance);
+            break;
+        }
+
+        case Command::DrawIndirect: {
+            DrawIndirectCmd* draw = iter->NextCommand<DrawIndirectCmd>();
+            Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
+
+            descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            device->fn.CmdDrawIndirect(commands, buffer->GetHandle(),
+                                       static_cast<VkDeviceSize>(draw->indirectOffset), 1, 0);
+            break;
+        }
+
+        case Command::DrawIndexedIndirect: {
+            DrawIndexedIndirectCmd* draw = iter->NextCommand<DrawIndexedIndirectCmd>();
+            Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
+            DAWN_ASSERT(buffer != nullptr);
+
+            descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            device->fn.CmdDrawIndexedIndirect(commands, buffer->GetHandle(),
+                                              static_cast<VkDeviceSize>(draw->indirectOffset), 1,
+                                              0);
+            break;
+        }
+
+        case Command::MultiDrawIndirect: {
+            MultiDrawIndirectCmd* cmd = iter->NextCommand<MultiDrawIndirectCmd>();
+
+            Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
+            DAWN_ASSERT(indirectBuffer != nullptr);
+
+            // Count buffer is optional
+            Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
+
+            descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+
+            if (countBuffer == nullptr) {
+                device->fn.CmdDrawIndirect(commands, indirectBuffer->GetHandle(),
+                                           static_cast<VkDeviceSize>(cmd->indirectOffset),
+                                           cmd->maxDrawCount, kDrawIndirectSize);
+            } else {
+                device->fn.CmdDrawIndirectCountKHR(
+                    commands, indirectBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->indirectOffset), countBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->drawCountOffset), cmd->maxDrawCount,
+                    kDrawIndirectSize);
+            }
+            break;
+        }
+        case Command::MultiDrawIndexedIndirect: {
+            MultiDrawIndexedIndirectCmd* cmd = iter->NextCommand<MultiDrawIndexedIndirectCmd>();
+
+            Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
+            DAWN_ASSERT(indirectBuffer != nullptr);
+
+            // Count buffer is optional
+            Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
+
+            descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+
+            if (countBuffer == nullptr) {
+                device->fn.CmdDrawIndexedIndirect(commands, indirectBuffer->GetHandle(),
+                                                  static_cast<VkDeviceSize>(cmd->indirectOffset),
+                                                  cmd->maxDrawCount, kDrawIndexedIndirectSize);
+            } else {
+                device->fn.CmdDrawIndexedIndirectCountKHR(
+                    commands, indirectBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->indirectOffset), countBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->drawCountOffset), cmd->maxDrawCount,
+                    kDrawIndexedIndirectSize);
+            }
+
+            break;
+        }
+
+        case Command::InsertDebugMarker: {
+            if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                InsertDebugMarkerCmd* cmd = iter->NextCommand<InsertDebugMarkerCmd>();
+                const char* label = iter->NextData<char>(cmd->length + 1);
+                VkDebugUtilsLabelEXT utilsLabel;
+                utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+                utilsLabel.pNext = nullptr;
+                utilsLabel.pLabelName = label;
+                // Default color to black
+                utilsLabel.color[0] = 0.0;
+                utilsLabel.color[1] = 0.0;
+                utilsLabel.color[2] = 0.0;
+                utilsLabel.color[3] = 1.0;
+                device->fn.CmdInsertDebugUtilsLabelEXT(commands, &utilsLabel);
+            } else {
+                SkipCommand(iter, Command::InsertDebugMarker);
+            }
+            break;
+        }
+
+        case Command::PopDebugGroup: {
+            if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                iter->NextCommand<PopDebugGroupCmd>();
+                device->fn.CmdEndDebugUtilsLabelEXT(commands);
+            } else {
+                SkipCommand(iter, Command::PopDebugGroup);
+            }
+            break;
+        }
+
+        case Command::PushDebugGroup: {
+            if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                PushDebugGroupCmd* cmd = iter->NextCommand<PushDebugGroupCmd>();
+                const char* label = iter->NextData<char>(cmd->length + 1);
+                RecordBeginDebugUtilsLabel(device, commands, label);
+            } else {
+                SkipCommand(iter, Command::PushDebugGroup);
+            }
+            break;
+        }
+
+        case Command::SetBindGroup: {
+            SetBindGroupCmd* cmd = iter->NextCommand<SetBindGroupCmd>();
+            BindGroup* bindGroup = ToBackend(cmd->group.Get());
+            uint32_t* dynamicOffsets = nullptr;
+            if (cmd->dynamicOffsetCount > 0) {
+                dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
+            }
+
+            descriptorSets.OnSetBindGroup(cmd->index, bindGroup, cmd->dynamicOffsetCount,
+                                          dynamicOffsets);
+            break;
+        }
+
+        case Command::SetIndexBuffer: {
+            SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
+            VkBuffer indexBuffer = ToBackend(cmd->buffer)->GetHandle();
+
+            device->fn.CmdBindIndexBuffer(commands, indexBuffer, cmd->offset,
+                                          VulkanIndexType(cmd->format));
+            break;
+        }
+
+        case Command::SetRenderPipeline: {
+            SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
+            RenderPipeline* pipeline = ToBackend(cmd->pipeline).Get();
+
+            device->fn.CmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                       pipeline->GetHandle());
+            state->lastPipeline = pipeline;
+
+            descriptorSets.OnSetPipeline<RenderPipeline>(pipeline);
+
+            // Apply the deferred min/maxDepth push constants update if needed.
+            ApplyClampFragDepthArgs(device, commands, state);
+            break;
+        }
+
+        case Command::SetVertexBuffer: {
+            SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
+            VkBuffer buffer = ToBackend(cmd->buffer)->GetHandle();
+            VkDeviceSize offset = static_cast<VkDeviceSize>(cmd->offset);
+
+            device->fn.CmdBindVertexBuffers(commands, static_cast<uint8_t>(cmd->slot), 1, &*buffer,
+                                            &offset);
+            break;
+        }
+
+        default:
+            DAWN_UNREACHABLE();
+            break;
+    }
+}
+
+// The maximum number of threads recording the render bundles of a render pass in parallel,
+// including the thread recording the pass.
+constexpr size_t kMaxRenderBundleRecordingThreads = 8;
+
+// Allocates a secondary command buffer from pool, or reuses one allocated before the pool was
+// reset, and begins it to continue the render pass in inheritanceInfo.
+::VkResult BeginSecondaryCommandBuffer(Device* device,
+                                       SecondaryCommandPool* pool,
+                                       const VkCommandBufferInheritanceInfo& inheritanceInfo,
+                                       VkCommandBuffer* commands) {
+    if (pool->usedCommandBufferCount == pool->commandBuffers.size()) {
+        VkCommandBufferAllocateInfo allocateInfo;
+        allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.pNext = nullptr;
+        allocateInfo.commandPool = pool->pool;
+        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocateInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        ::VkResult result =
+            device->fn.AllocateCommandBuffers(device->GetVkDevice(), &allocateInfo, &commandBuffer);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        pool->commandBuffers.push_back(commandBuffer);
+    }
+    *commands = pool->commandBuffers[pool->usedCommandBufferCount++];
+
+    VkCommandBufferBeginInfo beginInfo;
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.pNext = nullptr;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT |
+                      VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+    return device->fn.BeginCommandBuffer(*commands, &beginInfo);
+}
+
+// A render bundle executed in a render pass recorded with secondary command buffers, with where
+// each of its executions goes in the pass, and the dynamic state and debug groups it starts with.
+struct RenderBundleExecutions {
+    struct Execution {
+        size_t secondaryIndex;
+        RenderPassDynamicState dynamicState;
+        // The labels of the debug groups open in the render pass. They point in the commands of the
+        // command buffer so they stay valid while it is recorded.
+        std::vector<const char*> debugGroups;
+    };
+
+    raw_ptr<RenderBundleBase> bundle;
+    std::vector<Execution> executions;
+};
+
+// The state shared by the threads recording the render bundles of a render pass. It is kept alive
+// by the worker tasks since they can start after all the bundles are recorded.
+struct ParallelRenderBundleRecording {
+    raw_ptr<Device> device;
+    VkCommandBufferInheritanceInfo inheritanceInfo;
+    std::vector<RenderBundleExecutions> bundles;
+    std::vector<VkCommandBuffer> secondaries;
+
+    // The command pools of the recording threads, one per thread. They are owned by the recording
+    // context.
+    raw_ptr<SecondaryCommandPool, AllowPtrArithmetic> pools = nullptr;
+    std::atomic<size_t> nextPool = 0;
+    std::atomic<size_t> nextBundle = 0;
+
+    std::mutex mutex;
+    std::condition_variable recordedCondition;
+    size_t recordedBundleCount = 0;
+    ::VkResult result = VK_SUCCESS;
+};
+
+::VkResult RecordRenderBundleExecution(Device* device,
+                                       SecondaryCommandPool* pool,
+                                       const VkCommandBufferInheritanceInfo& inheritanceInfo,
+                                       RenderBundleBase* bundle,
+                                       const RenderBundleExecutions::Execution& execution,
+                                       VkCommandBuffer* commands) {
+    ::VkResult result = BeginSecondaryCommandBuffer(device, pool, inheritanceInfo, commands);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    const RenderPassDynamicState& dynamicState = execution.dynamicState;
+    RecordDynamicState(device, *commands, dynamicState);
+
+    // Reopen the debug groups of the render pass so that the bundle's commands are nested in them,
+    // and close them at the end since debug groups must be balanced in secondary command buffers.
+    for (const char* label : execution.debugGroups) {
+        RecordBeginDebugUtilsLabel(device, *commands, label);
+    }
+
+    RenderCommandRecordingState state;
+    state.clampFragDepthArgs = {dynamicState.viewport.minDepth, dynamicState.viewport.maxDepth};
+
+    CommandIterator* iter = bundle->GetCommands();
+    iter->Reset();
+    Command type;
+    while (iter->NextCommandId(&type)) {
+        RecordRenderCommand(device, *commands, &state, iter, type);
+    }
+
+    for (size_t i = 0; i < execution.debugGroups.size(); ++i) {
+        device->fn.CmdEndDebugUtilsLabelEXT(*commands);
+    }
+    return device->fn.EndCommandBuffer(*commands);
+}
+
+// Records render bundles until there are none left. Each render bundle is recorded by a single
+// thread since iterating its commands isn't thread-safe, and each thread allocates its secondary
+// command buffers from its own command pool since they must be externally synchronized.
+void RecordRenderBundles(ParallelRenderBundleRecording* recording) {
+    SecondaryCommandPool* pool = nullptr;
+    for (size_t i = recording->nextBundle++; i < recording->bundles.size();
+         i = recording->nextBundle++) {
+        if (pool == nullptr) {
+            pool = recording->pools + recording->nextPool++;
+        }
+
+        const RenderBundleExecutions& bundle = recording->bundles[i];
+        ::VkResult result = VK_SUCCESS;
+        for (const RenderBundleExecutions::Execution& execution : bundle.executions) {
+            result = RecordRenderBundleExecution(
+                recording->device, pool, recording->inheritanceInfo, bundle.bundle, execution,
+                &recording->secondaries[execution.secondaryIndex]);
+            if (result != VK_SUCCESS) {
+                break;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(recording->mutex);
+        if (recording->result == VK_SUCCESS) {
+            recording->result = result;
+        }
+        if (++recording->recordedBundleCount == recording->bundles.size()) {
+            recording->recordedCondition.notify_all();
+        }
+    }
+}
+
+// Records the executions of the render bundles in secondary command buffers, on this thread and
+// on up to kMaxRenderBundleRecordingThreads - 1 worker threads, and stores them in their slot of
+// secondaries.
+MaybeError RecordRenderBundlesInParallel(Device* device,
+                                         CommandRecordingContext* recordingContext,
+                                         const VkCommandBufferInheritanceInfo& inheritanceInfo,
+                                         std::vector<RenderBundleExecutions> bundles,
+                                         std::vector<VkCommandBuffer>* secondaries) {
+    if (bundles.empty()) {
+        return {};
+    }
+
+    size_t threadCount = std::min(bundles.size(), kMaxRenderBundleRecordingThreads);
+
+    // The pools are owned by the recording context as soon as they are acquired so that they are
+    // released even if the recording fails.
+    Queue* queue = ToBackend(device->GetQueue());
+    size_t firstPool = recordingContext->secondaryCommandPools.size();
+    for (size_t i = 0; i < threadCount; ++i) {
+        SecondaryCommandPool pool;
+        DAWN_TRY_ASSIGN(pool, queue->GetUnusedSecondaryCommandPool());
+        recordingContext->secondaryCommandPools.push_back(std::move(pool));
+    }
+
+    auto recording = std::make_shared<ParallelRenderBundleRecording>();
+    recording->device = device;
+    recording->inheritanceInfo = inheritanceInfo;
+    recording->bundles = std::move(bundles);
+    recording->secondaries = std::move(*secondaries);
+    recording->pools = recordingContext->secondaryCommandPools.data() + firstPool;
+
+    for (size_t i = 1; i < threadCount; ++i) {
+        device->GetAsyncTaskManager()->PostTask(
+            [recording] { RecordRenderBundles(recording.get()); });
+    }
+    // This thread records bundles too so that the recording makes progress even if all the
+    // worker threads are busy.
+    RecordRenderBundles(recording.get());
+
+    {
+        std::unique_lock<std::mutex> lock(recording->mutex);
+        recording->recordedCondition.wait(lock, [&recording] {
+            return recording->recordedBundleCount == recording->bundles.size();
+        });
+    }
+
+    DAWN_TRY(CheckVkSuccess(recording->result, "Recording render bundles"));
+    *secondaries = std::move(recording->secondaries);
+    return {};
+}
+
 }  // anonymous namespace
 
 MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
                                  Device* device,
-                                 BeginRenderPassCmd* renderPass) {
+                                 BeginRenderPassCmd* renderPass,
+                                 VkSubpassContents subpassContents,
+                                 VkRenderPass* renderPassOut) {
     VkCommandBuffer commands = recordingContext->commandBuffer;
 
     // Query a VkRenderPass from the cache
@@ -427,83 +930,122 @@ MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
         DAWN_TRY_ASSIGN(renderPassInfo, device->GetRenderPassCache()->GetRenderPass(query));
         renderPassVK = renderPassInfo.renderPass;
     }
+    if (renderPassOut != nullptr) {
+        *renderPassOut = renderPassVK;
+    }
 
-    // Create a framebuffer that will be used once for the render pass and gather the clear
-    // values for the attachments at the same time.
+    // Gather the attachments and their clear values. With imageless framebuffers the framebuffer
+    // only depends on the properties of the attachments' images, so it is reused from the
+    // FramebufferCache and the views are given when the render pass begins. Otherwise create a
+    // framebuffer that will be used once for the render pass.
     std::array<VkClearValue, kMaxColorAttachments + 1> clearValues;
-    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    std::array<VkImageView, kMaxColorAttachments * 2 + 1> attachments;
     uint32_t attachmentCount = 0;
-    {
-        // Fill in the attachment info that will be chained in the framebuffer create info.
-        std::array<VkImageView, kMaxColorAttachments * 2 + 1> attachments;
 
-        for (auto i : IterateBitSet(renderPass->attachmentState->GetColorAttachmentsMask())) {
-            auto& attachmentInfo = renderPass->colorAttachments[i];
-            TextureView* view = ToBackend(attachmentInfo.view.Get());
-            if (view == nullptr) {
-                continue;
-            }
+    FramebufferCache* framebufferCache = device->GetFramebufferCache();
+    bool useImagelessFramebuffer = framebufferCache != nullptr;
+    FramebufferCacheQuery framebufferQuery;
+    // Imageless framebuffers must be created with the flags, usage and view formats of the
+    // attachments' images, so they can only be used when all of them are known. Vulkan also
+    // requires a non-empty view format list that matches the one the image was created with.
+    auto AddImagelessAttachment = [&](const TextureView* view, VkImageUsageFlags usage) {
+        const Texture* texture = ToBackend(view->GetTexture());
+        if (!useImagelessFramebuffer || !texture->HasKnownImageCreateInfo() || usage == 0 ||
+            texture->GetImageViewFormats().empty()) {
+            useImagelessFramebuffer = false;
+            return;
+        }
+        Extent3D size = view->GetSingleSubresourceVirtualSize();
+        framebufferQuery.AddAttachment(texture->GetImageCreateFlags(), usage,
+                                       texture->GetImageViewFormats(), size.width, size.height);
+    };
 
-            if (view->GetDimension() == wgpu::TextureViewDimension::e3D) {
-                VkImageView handleFor2DViewOn3D;
-                DAWN_TRY_ASSIGN(handleFor2DViewOn3D,
-                                view->GetOrCreate2DViewOn3D(attachmentInfo.depthSlice));
-                attachments[attachmentCount] = handleFor2DViewOn3D;
-            } else {
-                attachments[attachmentCount] = view->GetHandle();
-            }
+    for (auto i : IterateBitSet(renderPass->attachmentState->GetColorAttachmentsMask())) {
+        auto& attachmentInfo = renderPass->colorAttachments[i];
+        TextureView* view = ToBackend(attachmentInfo.view.Get());
+        if (view == nullptr) {
+            continue;
+        }
 
-            switch (view->GetFormat().GetAspectInfo(Aspect::Color).baseType) {
-                case TextureComponentType::Float: {
-                    const std::array<float, 4> appliedClearColor =
-                        ConvertToFloatColor(attachmentInfo.clearColor);
-                    for (uint32_t j = 0; j < 4; ++j) {
-                        clearValues[attachmentCount].color.float32[j] = appliedClearColor[j];
-                    }
-                    break;
+        if (view->GetDimension() == wgpu::TextureViewDimension::e3D) {
+            VkImageView handleFor2DViewOn3D;
+            DAWN_TRY_ASSIGN(handleFor2DViewOn3D,
+                            view->GetOrCreate2DViewOn3D(attachmentInfo.depthSlice));
+            attachments[attachmentCount] = handleFor2DViewOn3D;
+
+            // The 2D views on 3D textures inherit the usage of the image.
+            const Texture* texture = ToBackend(view->GetTexture());
+            AddImagelessAttachment(
+                view, texture->HasKnownImageCreateInfo() ? texture->GetImageUsage() : 0);
+        } else {
+            attachments[attachmentCount] = view->GetHandle();
+            AddImagelessAttachment(view, view->GetHandleUsage());
+        }
+
+        switch (view->GetFormat().GetAspectInfo(Aspect::Color).baseType) {
+            case TextureComponentType::Float: {
+                const std::array<float, 4> appliedClearColor =
+                    ConvertToFloatColor(attachmentInfo.clearColor);
+                for (uint32_t j = 0; j < 4; ++j) {
+                    clearValues[attachmentCount].color.float32[j] = appliedClearColor[j];
                 }
-                case TextureComponentType::Uint: {
-                    const std::array<uint32_t, 4> appliedClearColor =
-                        ConvertToUnsignedIntegerColor(attachmentInfo.clearColor);
-                    for (uint32_t j = 0; j < 4; ++j) {
-                        clearValues[attachmentCount].color.uint32[j] = appliedClearColor[j];
-                    }
-                    break;
+                break;
+            }
+            case TextureComponentType::Uint: {
+                const std::array<uint32_t, 4> appliedClearColor =
+                    ConvertToUnsignedIntegerColor(attachmentInfo.clearColor);
+                for (uint32_t j = 0; j < 4; ++j) {
+                    clearValues[attachmentCount].color.uint32[j] = appliedClearColor[j];
                 }
-                case TextureComponentType::Sint: {
-                    const std::array<int32_t, 4> appliedClearColor =
-                        ConvertToSignedIntegerColor(attachmentInfo.clearColor);
-                    for (uint32_t j = 0; j < 4; ++j) {
-                        clearValues[attachmentCount].color.int32[j] = appliedClearColor[j];
-                    }
-                    break;
+                break;
+            }
+            case TextureComponentType::Sint: {
+                const std::array<int32_t, 4> appliedClearColor =
+                    ConvertToSignedIntegerColor(attachmentInfo.clearColor);
+                for (uint32_t j = 0; j < 4; ++j) {
+                    clearValues[attachmentCount].color.int32[j] = appliedClearColor[j];
                 }
+                break;
             }
-            attachmentCount++;
         }
+        attachmentCount++;
+    }
 
-        if (renderPass->attachmentState->HasDepthStencilAttachment()) {
-            auto& attachmentInfo = renderPass->depthStencilAttachment;
-            TextureView* view = ToBackend(attachmentInfo.view.Get());
+    if (renderPass->attachmentState->HasDepthStencilAttachment()) {
+        auto& attachmentInfo = renderPass->depthStencilAttachment;
+        TextureView* view = ToBackend(attachmentInfo.view.Get());
 
-            attachments[attachmentCount] = view->GetHandle();
+        attachments[attachmentCount] = view->GetHandle();
+        AddImagelessAttachment(view, view->GetHandleUsage());
 
-            clearValues[attachmentCount].depthStencil.depth = attachmentInfo.clearDepth;
-            clearValues[attachmentCount].depthStencil.stencil = attachmentInfo.clearStencil;
+        clearValues[attachmentCount].depthStencil.depth = attachmentInfo.clearDepth;
+        clearValues[attachmentCount].depthStencil.stencil = attachmentInfo.clearStencil;
 
-            attachmentCount++;
-        }
+        attachmentCount++;
+    }
 
-        for (auto i : IterateBitSet(renderPass->attachmentState->GetColorAttachmentsMask())) {
-            if (renderPass->colorAttachments[i].resolveTarget != nullptr) {
-                TextureView* view = ToBackend(renderPass->colorAttachments[i].resolveTarget.Get());
+    for (auto i : IterateBitSet(renderPass->attachmentState->GetColorAttachmentsMask())) {
+        if (renderPass->colorAttachments[i].resolveTarget != nullptr) {
+            TextureView* view = ToBackend(renderPass->colorAttachments[i].resolveTarget.Get());
 
-                attachments[attachmentCount] = view->GetHandle();
+            attachments[attachmentCount] = view->GetHandle();
+            AddImagelessAttachment(view, view->GetHandleUsage());
 
-                attachmentCount++;
-            }
+            attachmentCount++;
         }
+    }
 
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkRenderPassAttachmentBeginInfo attachmentBeginInfo;
+    if (useImagelessFramebuffer) {
+        framebufferQuery.renderPass = renderPassVK;
+        framebufferQuery.width = renderPass->width;
+        framebufferQuery.height = renderPass->height;
+        DAWN_TRY_ASSIGN(framebuffer, framebufferCache->GetFramebuffer(framebufferQuery));
+
+        attachmentBeginInfo.attachmentCount = attachmentCount;
+        attachmentBeginInfo.pAttachments = AsVkArray(attachments.data());
+    } else {
         // Chain attachments and create the framebuffer
         VkFramebufferCreateInfo createInfo;
         createInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
@@ -537,11 +1079,19 @@ MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
     beginInfo.clearValueCount = attachmentCount;
     beginInfo.pClearValues = clearValues.data();
 
+    PNextChainBuilder beginInfoChain(&beginInfo);
+    if (useImagelessFramebuffer) {
+        beginInfoChain.Add(&attachmentBeginInfo,
+                           VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO);
+    }
+
     if (renderPass->attachmentState->GetExpandResolveInfo().attachmentsToExpandResolve.any()) {
+        // The expand resolve draw is recorded inline in the first subpass.
+        DAWN_ASSERT(subpassContents == VK_SUBPASS_CONTENTS_INLINE);
         DAWN_TRY(BeginRenderPassAndExpandResolveTextureWithDraw(device, recordingContext,
                                                                 renderPass, beginInfo));
     } else {
-        device->fn.CmdBeginRenderPass(commands, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+        device->fn.CmdBeginRenderPass(commands, &beginInfo, subpassContents);
     }
 
     return {};
@@ -852,7 +1402,8 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
                     GetResourceUsages().renderPasses[nextRenderPassNumber]));
 
                 LazyClearRenderPassAttachments(cmd);
-                DAWN_TRY(RecordRenderPass(recordingContext, cmd));
+                DAWN_TRY(RecordRenderPass(recordingContext, cmd,
+                                          GetResourceUsages().renderPasses[nextRenderPassNumber]));
 
                 recordingContext->hasRecordedRenderPass = true;
                 nextRenderPassNumber++;
@@ -918,8 +1469,9 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
             case Command::WriteTimestamp: {
                 WriteTimestampCmd* cmd = mCommands.NextCommand<WriteTimestampCmd>();
 
-                RecordWriteTimestampCmd(recordingContext, device, cmd->querySet.Get(),
-                                        cmd->queryIndex, false, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+                RecordWriteTimestampCmd(recordingContext->commandBuffer, device,
+                                        cmd->querySet.Get(), cmd->queryIndex, false,
+                                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
                 break;
             }
 
@@ -1023,7 +1575,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
     // Write timestamp at the beginning of compute pass if it's set
     if (computePassCmd->timestampWrites.beginningOfPassWriteIndex !=
         wgpu::kQuerySetIndexUndefined) {
-        RecordWriteTimestampCmd(recordingContext, device,
+        RecordWriteTimestampCmd(recordingContext->commandBuffer, device,
                                 computePassCmd->timestampWrites.querySet.Get(),
                                 computePassCmd->timestampWrites.beginningOfPassWriteIndex, false,
                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
@@ -1043,7 +1595,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
                 // Write timestamp at the end of compute pass if it's set.
                 if (computePassCmd->timestampWrites.endOfPassWriteIndex !=
                     wgpu::kQuerySetIndexUndefined) {
-                    RecordWriteTimestampCmd(recordingContext, device,
+                    RecordWriteTimestampCmd(recordingContext->commandBuffer, device,
                                             computePassCmd->timestampWrites.querySet.Get(),
                                             computePassCmd->timestampWrites.endOfPassWriteIndex,
                                             false, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
@@ -1056,7 +1608,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 
                 DAWN_TRY(TransitionAndClearForSyncScope(
                     device, recordingContext, resourceUsages.dispatchUsages[currentDispatch]));
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_COMPUTE);
+                descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_COMPUTE);
 
                 device->fn.CmdDispatch(commands, dispatch->x, dispatch->y, dispatch->z);
                 currentDispatch++;
@@ -1069,7 +1621,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 
                 DAWN_TRY(TransitionAndClearForSyncScope(
                     device, recordingContext, resourceUsages.dispatchUsages[currentDispatch]));
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_COMPUTE);
+                descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_COMPUTE);
 
                 device->fn.CmdDispatchIndirect(commands, indirectBuffer,
                                                static_cast<VkDeviceSize>(dispatch->indirectOffset));
@@ -1154,8 +1706,9 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
             case Command::WriteTimestamp: {
                 WriteTimestampCmd* cmd = mCommands.NextCommand<WriteTimestampCmd>();
 
-                RecordWriteTimestampCmd(recordingContext, device, cmd->querySet.Get(),
-                                        cmd->queryIndex, false, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+                RecordWriteTimestampCmd(recordingContext->commandBuffer, device,
+                                        cmd->querySet.Get(), cmd->queryIndex, false,
+                                        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
                 break;
             }
 
@@ -1169,16 +1722,25 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 }
 
 MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingContext,
-                                           BeginRenderPassCmd* renderPassCmd) {
+                                           BeginRenderPassCmd* renderPassCmd,
+                                           const RenderPassResourceUsage& resourceUsages) {
     Device* device = ToBackend(GetDevice());
     VkCommandBuffer commands = recordingContext->commandBuffer;
 
+    // Occlusion queries would have to be inherited by the secondary command buffers, and the
+    // expand resolve draw is recorded inline with the beginning of the render pass.
+    if (resourceUsages.executedRenderBundleCount > 0 &&
+        device->IsToggleEnabled(Toggle::VulkanRecordRenderBundlesInParallel) &&
+        renderPassCmd->occlusionQuerySet == nullptr &&
+        !renderPassCmd->attachmentState->GetExpandResolveInfo().attachmentsToExpandResolve.any()) {
+        return RecordRenderPassWithSecondaryCommandBuffers(recordingContext, renderPassCmd);
+    }
+
     // Write timestamp at the beginning of render pass if it's set.
     // We've observed that this must be called before the render pass or the timestamps produced
     // are nonsensical on multiple Android devices.
     if (renderPassCmd->timestampWrites.beginningOfPassWriteIndex != wgpu::kQuerySetIndexUndefined) {
-        RecordWriteTimestampCmd(recordingContext, device,
-                                renderPassCmd->timestampWrites.querySet.Get(),
+        RecordWriteTimestampCmd(commands, device, renderPassCmd->timestampWrites.querySet.Get(),
                                 renderPassCmd->timestampWrites.beginningOfPassWriteIndex, true,
                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
     }
@@ -1186,253 +1748,195 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
     DAWN_TRY(RecordBeginRenderPass(recordingContext, device, renderPassCmd));
 
     // Set the default value for the dynamic state
-    {
-        device->fn.CmdSetLineWidth(commands, 1.0f);
-        device->fn.CmdSetDepthBounds(commands, 0.0f, 1.0f);
-
-        device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK, 0);
-
-        float blendConstants[4] = {
-            0.0f,
-            0.0f,
-            0.0f,
-            0.0f,
-        };
-        device->fn.CmdSetBlendConstants(commands, blendConstants);
-
-        // The viewport and scissor default to cover all of the attachments
-        VkViewport viewport;
-        viewport.x = 0.0f;
-        viewport.y = static_cast<float>(renderPassCmd->height);
-        viewport.width = static_cast<float>(renderPassCmd->width);
-        viewport.height = -static_cast<float>(renderPassCmd->height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        device->fn.CmdSetViewport(commands, 0, 1, &viewport);
-
-        VkRect2D scissorRect;
-        scissorRect.offset.x = 0;
-        scissorRect.offset.y = 0;
-        scissorRect.extent.width = renderPassCmd->width;
-        scissorRect.extent.height = renderPassCmd->height;
-        device->fn.CmdSetScissor(commands, 0, 1, &scissorRect);
-    }
-
-    DescriptorSetTracker descriptorSets = {};
-    RenderPipeline* lastPipeline = nullptr;
+    RecordDynamicState(device, commands, GetDefaultDynamicState(renderPassCmd));
 
-    // Tracking for the push constants needed by the ClampFragDepth transform.
-    // TODO(dawn:1125): Avoid the need for this when the depthClamp feature is available, but doing
-    // so would require fixing issue dawn:1576 first to have more dynamic push constant usage. (and
-    // also additional tests that the dirtying logic here is correct so with a Toggle we can test it
-    // on our infra).
-    ClampFragDepthArgs clampFragDepthArgs = {0.0f, 1.0f};
-    bool clampFragDepthArgsDirty = true;
-    auto ApplyClampFragDepthArgs = [&] {
-        if (!clampFragDepthArgsDirty || lastPipeline == nullptr) {
-            return;
-        }
-        device->fn.CmdPushConstants(
-            commands, lastPipeline->GetVkLayout(),
-            ToBackend(lastPipeline->GetLayout())->GetImmediateDataRangeStage(),
-            kClampFragDepthArgsOffset, kClampFragDepthArgsSize, &clampFragDepthArgs);
-        clampFragDepthArgsDirty = false;
-    };
+    RenderCommandRecordingState state;
 
-    auto EncodeRenderBundleCommand = [&](CommandIterator* iter, Command type) {
+    Command type;
+    while (mCommands.NextCommandId(&type)) {
         switch (type) {
-            case Command::Draw: {
-                DrawCmd* draw = iter->NextCommand<DrawCmd>();
+            case Command::EndRenderPass: {
+                mCommands.NextCommand<EndRenderPassCmd>();
 
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDraw(commands, draw->vertexCount, draw->instanceCount,
-                                   draw->firstVertex, draw->firstInstance);
-                break;
-            }
+                device->fn.CmdEndRenderPass(commands);
 
-            case Command::DrawIndexed: {
-                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+                // Write timestamp at the end of render pass if it's set.
+                // We've observed that this must be called after the render pass ends or the
+                // timestamps produced are nonsensical on multiple Android devices.
+                if (renderPassCmd->timestampWrites.endOfPassWriteIndex !=
+                    wgpu::kQuerySetIndexUndefined) {
+                    RecordWriteTimestampCmd(commands, device,
+                                            renderPassCmd->timestampWrites.querySet.Get(),
+                                            renderPassCmd->timestampWrites.endOfPassWriteIndex,
+                                            true, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+                }
 
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDrawIndexed(commands, draw->indexCount, draw->instanceCount,
-                                          draw->firstIndex, draw->baseVertex, draw->firstInstance);
-                break;
+                return {};
             }
 
-            case Command::DrawIndirect: {
-                DrawIndirectCmd* draw = iter->NextCommand<DrawIndirectCmd>();
-                Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDrawIndirect(commands, buffer->GetHandle(),
-                                           static_cast<VkDeviceSize>(draw->indirectOffset), 1, 0);
+            case Command::SetBlendConstant: {
+                SetBlendConstantCmd* cmd = mCommands.NextCommand<SetBlendConstantCmd>();
+                const std::array<float, 4> blendConstants = ConvertToFloatColor(cmd->color);
+                device->fn.CmdSetBlendConstants(commands, blendConstants.data());
                 break;
             }
 
-            case Command::DrawIndexedIndirect: {
-                DrawIndexedIndirectCmd* draw = iter->NextCommand<DrawIndexedIndirectCmd>();
-                Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
-                DAWN_ASSERT(buffer != nullptr);
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDrawIndexedIndirect(commands, buffer->GetHandle(),
-                                                  static_cast<VkDeviceSize>(draw->indirectOffset),
-                                                  1, 0);
+            case Command::SetStencilReference: {
+                SetStencilReferenceCmd* cmd = mCommands.NextCommand<SetStencilReferenceCmd>();
+                device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK,
+                                                  cmd->reference);
                 break;
             }
 
-            case Command::MultiDrawIndirect: {
-                MultiDrawIndirectCmd* cmd = iter->NextCommand<MultiDrawIndirectCmd>();
-
-                Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
-                DAWN_ASSERT(indirectBuffer != nullptr);
-
-                // Count buffer is optional
-                Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            case Command::SetViewport: {
+                SetViewportCmd* cmd = mCommands.NextCommand<SetViewportCmd>();
+                VkViewport viewport = ToVulkanViewport(cmd);
+                device->fn.CmdSetViewport(commands, 0, 1, &viewport);
 
-                if (countBuffer == nullptr) {
-                    device->fn.CmdDrawIndirect(commands, indirectBuffer->GetHandle(),
-                                               static_cast<VkDeviceSize>(cmd->indirectOffset),
-                                               cmd->maxDrawCount, kDrawIndirectSize);
-                } else {
-                    device->fn.CmdDrawIndirectCountKHR(
-                        commands, indirectBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->indirectOffset), countBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->drawCountOffset), cmd->maxDrawCount,
-                        kDrawIndirectSize);
-                }
+                // Try applying the push constants that contain min/maxDepth immediately. This can
+                // be deferred if no pipeline is currently bound.
+                state.clampFragDepthArgs = {viewport.minDepth, viewport.maxDepth};
+                state.clampFragDepthArgsDirty = true;
+                ApplyClampFragDepthArgs(device, commands, &state);
                 break;
             }
-            case Command::MultiDrawIndexedIndirect: {
-                MultiDrawIndexedIndirectCmd* cmd = iter->NextCommand<MultiDrawIndexedIndirectCmd>();
-
-                Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
-                DAWN_ASSERT(indirectBuffer != nullptr);
-
-                // Count buffer is optional
-                Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-
-                if (countBuffer == nullptr) {
-                    device->fn.CmdDrawIndexedIndirect(
-                        commands, indirectBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->indirectOffset), cmd->maxDrawCount,
-                        kDrawIndexedIndirectSize);
-                } else {
-                    device->fn.CmdDrawIndexedIndirectCountKHR(
-                        commands, indirectBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->indirectOffset), countBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->drawCountOffset), cmd->maxDrawCount,
-                        kDrawIndexedIndirectSize);
-                }
 
+            case Command::SetScissorRect: {
+                SetScissorRectCmd* cmd = mCommands.NextCommand<SetScissorRectCmd>();
+                VkRect2D rect = ToVulkanRect(cmd);
+                device->fn.CmdSetScissor(commands, 0, 1, &rect);
                 break;
             }
 
-            case Command::InsertDebugMarker: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    InsertDebugMarkerCmd* cmd = iter->NextCommand<InsertDebugMarkerCmd>();
-                    const char* label = iter->NextData<char>(cmd->length + 1);
-                    VkDebugUtilsLabelEXT utilsLabel;
-                    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
-                    utilsLabel.pNext = nullptr;
-                    utilsLabel.pLabelName = label;
-                    // Default color to black
-                    utilsLabel.color[0] = 0.0;
-                    utilsLabel.color[1] = 0.0;
-                    utilsLabel.color[2] = 0.0;
-                    utilsLabel.color[3] = 1.0;
-                    device->fn.CmdInsertDebugUtilsLabelEXT(commands, &utilsLabel);
-                } else {
-                    SkipCommand(iter, Command::InsertDebugMarker);
-                }
-                break;
-            }
+            case Command::ExecuteBundles: {
+                ExecuteBundlesCmd* cmd = mCommands.NextCommand<ExecuteBundlesCmd>();
+                auto bundles = mCommands.NextData<Ref<RenderBundleBase>>(cmd->count);
 
-            case Command::PopDebugGroup: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    iter->NextCommand<PopDebugGroupCmd>();
-                    device->fn.CmdEndDebugUtilsLabelEXT(commands);
-                } else {
-                    SkipCommand(iter, Command::PopDebugGroup);
+                for (uint32_t i = 0; i < cmd->count; ++i) {
+                    CommandIterator* iter = bundles[i]->GetCommands();
+                    iter->Reset();
+                    while (iter->NextCommandId(&type)) {
+                        RecordRenderCommand(device, commands, &state, iter, type);
+                    }
                 }
                 break;
             }
 
-            case Command::PushDebugGroup: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    PushDebugGroupCmd* cmd = iter->NextCommand<PushDebugGroupCmd>();
-                    const char* label = iter->NextData<char>(cmd->length + 1);
-                    VkDebugUtilsLabelEXT utilsLabel;
-                    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
-                    utilsLabel.pNext = nullptr;
-                    utilsLabel.pLabelName = label;
-                    // Default color to black
-                    utilsLabel.color[0] = 0.0;
-                    utilsLabel.color[1] = 0.0;
-                    utilsLabel.color[2] = 0.0;
-                    utilsLabel.color[3] = 1.0;
-                    device->fn.CmdBeginDebugUtilsLabelEXT(commands, &utilsLabel);
-                } else {
-                    SkipCommand(iter, Command::PushDebugGroup);
-                }
+            case Command::BeginOcclusionQuery: {
+                BeginOcclusionQueryCmd* cmd = mCommands.NextCommand<BeginOcclusionQueryCmd>();
+
+                device->fn.CmdBeginQuery(commands, ToBackend(cmd->querySet.Get())->GetHandle(),
+                                         cmd->queryIndex, 0);
                 break;
             }
 
-            case Command::SetBindGroup: {
-                SetBindGroupCmd* cmd = iter->NextCommand<SetBindGroupCmd>();
-                BindGroup* bindGroup = ToBackend(cmd->group.Get());
-                uint32_t* dynamicOffsets = nullptr;
-                if (cmd->dynamicOffsetCount > 0) {
-                    dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
-                }
+            case Command::EndOcclusionQuery: {
+                EndOcclusionQueryCmd* cmd = mCommands.NextCommand<EndOcclusionQueryCmd>();
 
-                descriptorSets.OnSetBindGroup(cmd->index, bindGroup, cmd->dynamicOffsetCount,
-                                              dynamicOffsets);
+                device->fn.CmdEndQuery(commands, ToBackend(cmd->querySet.Get())->GetHandle(),
+                                       cmd->queryIndex);
                 break;
             }
 
-            case Command::SetIndexBuffer: {
-                SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
-                VkBuffer indexBuffer = ToBackend(cmd->buffer)->GetHandle();
+            case Command::WriteTimestamp: {
+                WriteTimestampCmd* cmd = mCommands.NextCommand<WriteTimestampCmd>();
 
-                device->fn.CmdBindIndexBuffer(commands, indexBuffer, cmd->offset,
-                                              VulkanIndexType(cmd->format));
+                RecordWriteTimestampCmd(commands, device, cmd->querySet.Get(), cmd->queryIndex,
+                                        true, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
                 break;
             }
 
-            case Command::SetRenderPipeline: {
-                SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
-                RenderPipeline* pipeline = ToBackend(cmd->pipeline).Get();
-
-                device->fn.CmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                           pipeline->GetHandle());
-                lastPipeline = pipeline;
-
-                descriptorSets.OnSetPipeline<RenderPipeline>(pipeline);
-
-                // Apply the deferred min/maxDepth push constants update if needed.
-                ApplyClampFragDepthArgs();
+            default: {
+                RecordRenderCommand(device, commands, &state, &mCommands, type);
                 break;
             }
+        }
+    }
 
-            case Command::SetVertexBuffer: {
-                SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
-                VkBuffer buffer = ToBackend(cmd->buffer)->GetHandle();
-                VkDeviceSize offset = static_cast<VkDeviceSize>(cmd->offset);
+    // EndRenderPass should have been called
+    DAWN_UNREACHABLE();
+}
 
-                device->fn.CmdBindVertexBuffers(commands, static_cast<uint8_t>(cmd->slot), 1,
-                                                &*buffer, &offset);
-                break;
-            }
+MaybeError CommandBuffer::RecordRenderPassWithSecondaryCommandBuffers(
+    CommandRecordingContext* recordingContext,
+    BeginRenderPassCmd* renderPassCmd) {
+    Device* device = ToBackend(GetDevice());
+    Queue* queue = ToBackend(device->GetQueue());
+    bool hasDebugUtils = device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils);
 
-            default:
-                DAWN_UNREACHABLE();
-                break;
+    // Write timestamp at the beginning of render pass if it's set, see RecordRenderPass.
+    if (renderPassCmd->timestampWrites.beginningOfPassWriteIndex != wgpu::kQuerySetIndexUndefined) {
+        RecordWriteTimestampCmd(recordingContext->commandBuffer, device,
+                                renderPassCmd->timestampWrites.querySet.Get(),
+                                renderPassCmd->timestampWrites.beginningOfPassWriteIndex, true,
+                                VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+    }
+
+    VkRenderPass renderPassVK = VK_NULL_HANDLE;
+    DAWN_TRY(RecordBeginRenderPass(recordingContext, device, renderPassCmd,
+                                   VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS, &renderPassVK));
+
+    // The framebuffer is optional in the inheritance info, so it isn't given since it is imageless
+    // when it comes from the FramebufferCache.
+    VkCommandBufferInheritanceInfo inheritanceInfo;
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.pNext = nullptr;
+    inheritanceInfo.renderPass = renderPassVK;
+    inheritanceInfo.subpass = 0;
+    inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+    inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+    inheritanceInfo.queryFlags = 0;
+    inheritanceInfo.pipelineStatistics = 0;
+
+    // The secondary command buffers executed by the render pass, in order. The ones for render
+    // bundles are filled after all the commands of the pass are iterated.
+    std::vector<VkCommandBuffer> secondaries;
+    std::vector<RenderBundleExecutions> bundles;
+    absl::flat_hash_map<RenderBundleBase*, size_t> bundleIndices;
+
+    // The commands between the ExecuteBundles are recorded on this thread, in secondary command
+    // buffers started lazily with the current dynamic state and debug groups.
+    SecondaryCommandPool* pool = nullptr;
+    {
+        SecondaryCommandPool inlinePool;
+        DAWN_TRY_ASSIGN(inlinePool, queue->GetUnusedSecondaryCommandPool());
+        recordingContext->secondaryCommandPools.push_back(std::move(inlinePool));
+        pool = &recordingContext->secondaryCommandPools.back();
+    }
+    VkCommandBuffer commands = VK_NULL_HANDLE;
+    RenderPassDynamicState dynamicState = GetDefaultDynamicState(renderPassCmd);
+    std::optional<RenderCommandRecordingState> state;
+    std::vector<const char*> debugGroups;
+
+    auto BeginCommands = [&]() -> MaybeError {
+        if (commands != VK_NULL_HANDLE) {
+            return {};
+        }
+        DAWN_TRY(CheckVkSuccess(
+            BeginSecondaryCommandBuffer(device, pool, inheritanceInfo, &commands),
+            "Beginning secondary command buffer"));
+        secondaries.push_back(commands);
+
+        RecordDynamicState(device, commands, dynamicState);
+        state.emplace();
+        state->clampFragDepthArgs = {dynamicState.viewport.minDepth,
+                                     dynamicState.viewport.maxDepth};
+        for (const char* label : debugGroups) {
+            RecordBeginDebugUtilsLabel(device, commands, label);
         }
+        return {};
+    };
+    auto EndCommands = [&]() -> MaybeError {
+        if (commands == VK_NULL_HANDLE) {
+            return {};
+        }
+        // Debug groups must be balanced in secondary command buffers.
+        for (size_t i = 0; i < debugGroups.size(); ++i) {
+            device->fn.CmdEndDebugUtilsLabelEXT(commands);
+        }
+        DAWN_TRY(CheckVkSuccess(device->fn.EndCommandBuffer(commands), "vkEndCommandBuffer"));
+        commands = VK_NULL_HANDLE;
+        return {};
     };
 
     Command type;
@@ -1440,15 +1944,23 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
         switch (type) {
             case Command::EndRenderPass: {
                 mCommands.NextCommand<EndRenderPassCmd>();
+                DAWN_TRY(EndCommands());
 
-                device->fn.CmdEndRenderPass(commands);
+                DAWN_TRY(RecordRenderBundlesInParallel(device, recordingContext, inheritanceInfo,
+                                                       std::move(bundles), &secondaries));
 
-                // Write timestamp at the end of render pass if it's set.
-                // We've observed that this must be called after the render pass ends or the
-                // timestamps produced are nonsensical on multiple Android devices.
+                VkCommandBuffer primary = recordingContext->commandBuffer;
+                if (!secondaries.empty()) {
+                    device->fn.CmdExecuteCommands(primary,
+                                                  static_cast<uint32_t>(secondaries.size()),
+                                                  secondaries.data());
+                }
+                device->fn.CmdEndRenderPass(primary);
+
+                // Write timestamp at the end of render pass if it's set, see RecordRenderPass.
                 if (renderPassCmd->timestampWrites.endOfPassWriteIndex !=
                     wgpu::kQuerySetIndexUndefined) {
-                    RecordWriteTimestampCmd(recordingContext, device,
+                    RecordWriteTimestampCmd(primary, device,
                                             renderPassCmd->timestampWrites.querySet.Get(),
                                             renderPassCmd->timestampWrites.endOfPassWriteIndex,
                                             true, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
@@ -1459,100 +1971,103 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
 
             case Command::SetBlendConstant: {
                 SetBlendConstantCmd* cmd = mCommands.NextCommand<SetBlendConstantCmd>();
-                const std::array<float, 4> blendConstants = ConvertToFloatColor(cmd->color);
-                device->fn.CmdSetBlendConstants(commands, blendConstants.data());
+                dynamicState.blendConstants = ConvertToFloatColor(cmd->color);
+                if (commands != VK_NULL_HANDLE) {
+                    device->fn.CmdSetBlendConstants(commands, dynamicState.blendConstants.data());
+                }
                 break;
             }
 
             case Command::SetStencilReference: {
                 SetStencilReferenceCmd* cmd = mCommands.NextCommand<SetStencilReferenceCmd>();
-                device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK,
-                                                  cmd->reference);
+                dynamicState.stencilReference = cmd->reference;
+                if (commands != VK_NULL_HANDLE) {
+                    device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK,
+                                                      cmd->reference);
+                }
                 break;
             }
 
             case Command::SetViewport: {
                 SetViewportCmd* cmd = mCommands.NextCommand<SetViewportCmd>();
-                VkViewport viewport;
-                viewport.x = cmd->x;
-                viewport.y = cmd->y + cmd->height;
-                viewport.width = cmd->width;
-                viewport.height = -cmd->height;
-                viewport.minDepth = cmd->minDepth;
-                viewport.maxDepth = cmd->maxDepth;
-
-                // Vulkan disallows width = 0, but VK_KHR_maintenance1 which we require allows
-                // height = 0 so use that to do an empty viewport.
-                if (viewport.width == 0) {
-                    viewport.height = 0;
-
-                    // Set the viewport x range to a range that's always valid.
-                    viewport.x = 0;
-                    viewport.width = 1;
+                dynamicState.viewport = ToVulkanViewport(cmd);
+                if (commands != VK_NULL_HANDLE) {
+                    device->fn.CmdSetViewport(commands, 0, 1, &dynamicState.viewport);
+
+                    state->clampFragDepthArgs = {dynamicState.viewport.minDepth,
+                                                 dynamicState.viewport.maxDepth};
+                    state->clampFragDepthArgsDirty = true;
+                    ApplyClampFragDepthArgs(device, commands, &*state);
                 }
-
-                device->fn.CmdSetViewport(commands, 0, 1, &viewport);
-
-                // Try applying the push constants that contain min/maxDepth immediately. This can
-                // be deferred if no pipeline is currently bound.
-                clampFragDepthArgs = {viewport.minDepth, viewport.maxDepth};
-                clampFragDepthArgsDirty = true;
-                ApplyClampFragDepthArgs();
                 break;
             }
 
             case Command::SetScissorRect: {
                 SetScissorRectCmd* cmd = mCommands.NextCommand<SetScissorRectCmd>();
-                VkRect2D rect;
-                rect.offset.x = cmd->x;
-                rect.offset.y = cmd->y;
-                rect.extent.width = cmd->width;
-                rect.extent.height = cmd->height;
-
-                device->fn.CmdSetScissor(commands, 0, 1, &rect);
+                dynamicState.scissorRect = ToVulkanRect(cmd);
+                if (commands != VK_NULL_HANDLE) {
+                    device->fn.CmdSetScissor(commands, 0, 1, &dynamicState.scissorRect);
+                }
                 break;
             }
 
             case Command::ExecuteBundles: {
                 ExecuteBundlesCmd* cmd = mCommands.NextCommand<ExecuteBundlesCmd>();
-                auto bundles = mCommands.NextData<Ref<RenderBundleBase>>(cmd->count);
+                auto bundlesToExecute = mCommands.NextData<Ref<RenderBundleBase>>(cmd->count);
+                DAWN_TRY(EndCommands());
 
+                // Reserve the place of each execution in the pass. Bundles executed more than once
+                // are recorded by the same thread.
                 for (uint32_t i = 0; i < cmd->count; ++i) {
-                    CommandIterator* iter = bundles[i]->GetCommands();
-                    iter->Reset();
-                    while (iter->NextCommandId(&type)) {
-                        EncodeRenderBundleCommand(iter, type);
+                    RenderBundleBase* bundle = bundlesToExecute[i].Get();
+                    auto [it, inserted] = bundleIndices.try_emplace(bundle, bundles.size());
+                    if (inserted) {
+                        bundles.push_back({bundle, {}});
                     }
+                    bundles[it->second].executions.push_back(
+                        {secondaries.size(), dynamicState, debugGroups});
+                    secondaries.push_back(VK_NULL_HANDLE);
                 }
                 break;
             }
 
-            case Command::BeginOcclusionQuery: {
-                BeginOcclusionQueryCmd* cmd = mCommands.NextCommand<BeginOcclusionQueryCmd>();
-
-                device->fn.CmdBeginQuery(commands, ToBackend(cmd->querySet.Get())->GetHandle(),
-                                         cmd->queryIndex, 0);
+            case Command::PushDebugGroup: {
+                if (hasDebugUtils) {
+                    PushDebugGroupCmd* cmd = mCommands.NextCommand<PushDebugGroupCmd>();
+                    const char* label = mCommands.NextData<char>(cmd->length + 1);
+                    DAWN_TRY(BeginCommands());
+                    RecordBeginDebugUtilsLabel(device, commands, label);
+                    debugGroups.push_back(label);
+                } else {
+                    SkipCommand(&mCommands, Command::PushDebugGroup);
+                }
                 break;
             }
 
-            case Command::EndOcclusionQuery: {
-                EndOcclusionQueryCmd* cmd = mCommands.NextCommand<EndOcclusionQueryCmd>();
-
-                device->fn.CmdEndQuery(commands, ToBackend(cmd->querySet.Get())->GetHandle(),
-                                       cmd->queryIndex);
+            case Command::PopDebugGroup: {
+                if (hasDebugUtils) {
+                    mCommands.NextCommand<PopDebugGroupCmd>();
+                    DAWN_TRY(BeginCommands());
+                    device->fn.CmdEndDebugUtilsLabelEXT(commands);
+                    debugGroups.pop_back();
+                } else {
+                    SkipCommand(&mCommands, Command::PopDebugGroup);
+                }
                 break;
             }
 
             case Command::WriteTimestamp: {
                 WriteTimestampCmd* cmd = mCommands.NextCommand<WriteTimestampCmd>();
+                DAWN_TRY(BeginCommands());
 
-                RecordWriteTimestampCmd(recordingContext, device, cmd->querySet.Get(),
-                                        cmd->queryIndex, true, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+                RecordWriteTimestampCmd(commands, device, cmd->querySet.Get(), cmd->queryIndex,
+                                        true, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
                 break;
             }
 
             default: {
-                EncodeRenderBundleCommand(&mCommands, type);
+                DAWN_TRY(BeginCommands());
+                RecordRenderCommand(device, commands, &*state, &mCommands, type);
                 break;
             }
         }
@@ -46,9 +46,14 @@ namespace dawn::native::vulkan {
 struct CommandRecordingContext;
 class Device;
 
+// Begins the render pass in recordingContext's command buffer. The VkRenderPass it uses is
+// returned in renderPassOut when it isn't null, so that secondary command buffers recorded for
+// the pass can inherit it.
 MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
                                  Device* device,
-                                 BeginRenderPassCmd* renderPass);
+                                 BeginRenderPassCmd* renderPass,
+                                 VkSubpassContents subpassContents = VK_SUBPASS_CONTENTS_INLINE,
+                                 VkRenderPass* renderPassOut = nullptr);
 
 class CommandBuffer final : public CommandBufferBase {
   public:
@@ -64,7 +69,13 @@ class CommandBuffer final : public CommandBufferBase {
                                  BeginComputePassCmd* computePass,
                                  const ComputePassResourceUsage& resourceUsages);
     MaybeError RecordRenderPass(CommandRecordingContext* recordingContext,
-                                BeginRenderPassCmd* renderPass);
+                                BeginRenderPassCmd* renderPass,
+                                const RenderPassResourceUsage& resourceUsages);
+    // Records a render pass whose contents are all in secondary command buffers, with the render
+    // bundles it executes recorded in parallel on the device's worker threads.
+    MaybeError RecordRenderPassWithSecondaryCommandBuffers(
+        CommandRecordingContext* recordingContext,
+        BeginRenderPassCmd* renderPass);
     MaybeError RecordCopyImageWithTemporaryBuffer(CommandRecordingContext* recordingContext,
                                                   const TextureCopy& srcCopy,
                                                   const TextureCopy& dstCopy,
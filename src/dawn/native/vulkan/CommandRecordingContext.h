@@ -48,6 +48,15 @@ struct CommandPoolAndBuffer {
     VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
 };
 
+// A command pool for secondary command buffers. Command pools must be externally synchronized so
+// each thread recording secondary command buffers for the same primary command buffer uses its
+// own. The command buffers allocated from the pool are reused after the pool is reset.
+struct SecondaryCommandPool {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> commandBuffers;
+    size_t usedCommandBufferCount = 0;
+};
+
 // Used to track operations that are handled after recording.
 // Currently only tracks semaphores, but may be used to do barrier coalescing in the future.
 struct CommandRecordingContext {
@@ -85,6 +94,10 @@ struct CommandRecordingContext {
     std::vector<VkCommandBuffer> commandBufferList;
     std::vector<VkCommandPool> commandPoolList;
 
+    // The pools of the secondary command buffers executed by the command buffers above. They are
+    // recycled with them once the submit is complete.
+    std::vector<SecondaryCommandPool> secondaryCommandPools;
+
     // Need to track if a render pass has already been recorded for the
     // VulkanSplitCommandBufferOnComputePassAfterRenderPass workaround.
     bool hasRecordedRenderPass = false;
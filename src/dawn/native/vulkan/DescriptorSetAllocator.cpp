@@ -29,6 +29,7 @@
 
 #include <utility>
 
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/Queue.h"
 #include "dawn/native/vulkan/BindGroupLayoutVk.h"
 #include "dawn/native/vulkan/DeviceVk.h"
@@ -163,6 +164,7 @@ MaybeError DescriptorSetAllocator::AllocateDescriptorPool(BindGroupLayout* layou
     DAWN_TRY(CheckVkSuccess(device->fn.CreateDescriptorPool(device->GetVkDevice(), &createInfo,
                                                             nullptr, &*descriptorPool),
                             "CreateDescriptorPool"));
+    device->GetMetrics()->RecordDescriptorPoolCreation();
 
     std::vector<VkDescriptorSetLayout> layouts(mMaxSets, layout->GetHandle());
 
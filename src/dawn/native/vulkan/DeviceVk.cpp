@@ -45,11 +45,13 @@
 #include "dawn/native/vulkan/CommandBufferVk.h"
 #include "dawn/native/vulkan/ComputePipelineVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
+#include "dawn/native/vulkan/FramebufferCache.h"
 #include "dawn/native/vulkan/PhysicalDeviceVk.h"
 #include "dawn/native/vulkan/PipelineCacheVk.h"
 #include "dawn/native/vulkan/PipelineLayoutVk.h"
 #include "dawn/native/vulkan/QuerySetVk.h"
 #include "dawn/native/vulkan/QueueVk.h"
+#include "dawn/native/vulkan/PipelineLibraryCache.h"
 #include "dawn/native/vulkan/RenderPassCache.h"
 #include "dawn/native/vulkan/RenderPipelineVk.h"
 #include "dawn/native/vulkan/ResourceMemoryAllocatorVk.h"
@@ -126,6 +128,12 @@ MaybeError Device::Initialize(const UnpackedPtr<DeviceDescriptor>& descriptor) {
     }
 
     mRenderPassCache = std::make_unique<RenderPassCache>(this);
+    if (IsToggleEnabled(Toggle::VulkanUseImagelessFramebuffers)) {
+        mFramebufferCache = std::make_unique<FramebufferCache>(this);
+    }
+    if (IsToggleEnabled(Toggle::VulkanUseGraphicsPipelineLibrary)) {
+        mPipelineLibraryCache = std::make_unique<PipelineLibraryCache>(this);
+    }
     mResourceMemoryAllocator = std::make_unique<MutexProtected<ResourceMemoryAllocator>>(this);
 
     mExternalMemoryService = std::make_unique<external_memory::Service>(this);
@@ -326,6 +334,10 @@ MaybeError Device::TickImpl() {
     GetFencedDeleter()->Tick(completedSerial);
     mDescriptorAllocatorsPendingDeallocation.ClearUpTo(completedSerial);
 
+    if (mPipelineLibraryCache != nullptr) {
+        mPipelineLibraryCache->Tick();
+    }
+
     DAWN_TRY(queue->SubmitPendingCommands());
     DAWN_TRY(CheckDebugLayerAndGenerateErrors());
 
@@ -359,6 +371,14 @@ RenderPassCache* Device::GetRenderPassCache() const {
     return mRenderPassCache.get();
 }
 
+FramebufferCache* Device::GetFramebufferCache() const {
+    return mFramebufferCache.get();
+}
+
+PipelineLibraryCache* Device::GetPipelineLibraryCache() const {
+    return mPipelineLibraryCache.get();
+}
+
 MutexProtected<ResourceMemoryAllocator>& Device::GetResourceMemoryAllocator() const {
     return *mResourceMemoryAllocator;
 }
@@ -540,6 +560,31 @@ ResultOrError<VulkanDeviceKnobs> Device::CreateDevice(VkPhysicalDevice vkPhysica
                           VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES);
     }
 
+    if (mDeviceInfo.HasExt(DeviceExt::TimelineSemaphore) &&
+        mDeviceInfo.timelineSemaphoreFeatures.timelineSemaphore == VK_TRUE) {
+        DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::TimelineSemaphore));
+
+        // Always use a timeline semaphore to track queue completion when available.
+        usedKnobs.timelineSemaphoreFeatures = mDeviceInfo.timelineSemaphoreFeatures;
+        featuresChain.Add(&usedKnobs.timelineSemaphoreFeatures);
+    }
+
+    if (IsToggleEnabled(Toggle::VulkanUseImagelessFramebuffers)) {
+        DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::ImagelessFramebuffer) &&
+                    mDeviceInfo.imagelessFramebufferFeatures.imagelessFramebuffer == VK_TRUE);
+
+        usedKnobs.imagelessFramebufferFeatures = mDeviceInfo.imagelessFramebufferFeatures;
+        featuresChain.Add(&usedKnobs.imagelessFramebufferFeatures);
+    }
+
+    if (IsToggleEnabled(Toggle::VulkanUseGraphicsPipelineLibrary)) {
+        DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::GraphicsPipelineLibrary) &&
+                    mDeviceInfo.graphicsPipelineLibraryFeatures.graphicsPipelineLibrary == VK_TRUE);
+
+        usedKnobs.graphicsPipelineLibraryFeatures = mDeviceInfo.graphicsPipelineLibraryFeatures;
+        featuresChain.Add(&usedKnobs.graphicsPipelineLibraryFeatures);
+    }
+
     if (HasFeature(Feature::MultiDrawIndirect)) {
         DAWN_ASSERT(usedKnobs.HasExt(DeviceExt::DrawIndirectCount) &&
                     mDeviceInfo.features.multiDrawIndirect == VK_TRUE);
@@ -906,10 +951,16 @@ void Device::DestroyImpl() {
     // Allow recycled memory to be deleted.
     GetResourceMemoryAllocator()->DestroyPool();
 
-    // The VkRenderPasses in the cache can be destroyed immediately since all commands referring
-    // to them are guaranteed to be finished executing.
+    // The VkFramebuffers and VkRenderPasses in the caches can be destroyed immediately since all
+    // commands referring to them are guaranteed to be finished executing.
+    mFramebufferCache = nullptr;
     mRenderPassCache = nullptr;
 
+    // Pipeline libraries aren't referenced by the pipelines that were linked from them so they
+    // can be destroyed immediately as well. The background link-time optimizations were waited on
+    // when the device started being destroyed.
+    mPipelineLibraryCache = nullptr;
+
     // Delete all the remaining VkDevice child objects immediately since the GPU timeline is
     // finished.
     GetFencedDeleter()->Tick(kMaxExecutionSerial);
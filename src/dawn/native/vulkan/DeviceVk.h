@@ -52,6 +52,8 @@ namespace dawn::native::vulkan {
 
 class BufferUploader;
 class FencedDeleter;
+class FramebufferCache;
+class PipelineLibraryCache;
 class RenderPassCache;
 class ResourceMemoryAllocator;
 
@@ -76,6 +78,9 @@ class Device final : public DeviceBase {
 
     MutexProtected<FencedDeleter>& GetFencedDeleter() const;
     RenderPassCache* GetRenderPassCache() const;
+    // Returns nullptr when Toggle::VulkanUseImagelessFramebuffers is disabled.
+    FramebufferCache* GetFramebufferCache() const;
+    PipelineLibraryCache* GetPipelineLibraryCache() const;
     MutexProtected<ResourceMemoryAllocator>& GetResourceMemoryAllocator() const;
     external_semaphore::Service* GetExternalSemaphoreService() const;
 
@@ -191,6 +196,8 @@ class Device final : public DeviceBase {
     std::unique_ptr<MutexProtected<FencedDeleter>> mDeleter;
     std::unique_ptr<MutexProtected<ResourceMemoryAllocator>> mResourceMemoryAllocator;
     std::unique_ptr<RenderPassCache> mRenderPassCache;
+    std::unique_ptr<FramebufferCache> mFramebufferCache;
+    std::unique_ptr<PipelineLibraryCache> mPipelineLibraryCache;
 
     std::unique_ptr<external_memory::Service> mExternalMemoryService;
     std::unique_ptr<external_semaphore::Service> mExternalSemaphoreService;
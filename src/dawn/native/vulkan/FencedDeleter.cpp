@@ -27,14 +27,40 @@
 
 #include "dawn/native/vulkan/FencedDeleter.h"
 
+#include <utility>
+
+#include "dawn/native/AsyncTask.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/Queue.h"
 #include "dawn/native/vulkan/DeviceVk.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 namespace dawn::native::vulkan {
 
-FencedDeleter::FencedDeleter(Device* device) : mDevice(device) {}
+namespace {
+
+// Objects handed to the worker task beyond which Tick waits for it to catch up.
+constexpr uint64_t kMaxPendingBackgroundDeletions = 64 * 1024;
+
+template <typename T>
+void TakeUpTo(SerialQueue<ExecutionSerial, T>* queue,
+              ExecutionSerial serial,
+              std::vector<T>* handles) {
+    for (T handle : queue->IterateUpTo(serial)) {
+        handles->push_back(handle);
+    }
+    queue->ClearUpTo(serial);
+}
+
+}  // anonymous namespace
+
+FencedDeleter::FencedDeleter(Device* device)
+    : mDevice(device),
+      mDeleteInBackground(device->IsToggleEnabled(Toggle::VulkanBackgroundDeferredDeletion)) {}
 
 FencedDeleter::~FencedDeleter() {
+    DAWN_ASSERT(!mBackgroundDeletionTaskRunning);
+    DAWN_ASSERT(mPendingBackgroundDeletions.empty());
     DAWN_ASSERT(mBuffersToDelete.Empty());
     DAWN_ASSERT(mDescriptorPoolsToDelete.Empty());
     DAWN_ASSERT(mFencesToDelete.Empty());
@@ -127,92 +153,178 @@ void FencedDeleter::Tick(ExecutionSerial completedSerial) {
     VkDevice vkDevice = mDevice->GetVkDevice();
     VkInstance instance = mDevice->GetVkInstance();
 
+    // Swapchains and surfaces are tied to the window system so they are always destroyed here.
+    // Vulkan swapchains must be destroyed before their corresponding VkSurface
+    for (VkSwapchainKHR swapChain : mSwapChainsToDelete.IterateUpTo(completedSerial)) {
+        mDevice->fn.DestroySwapchainKHR(vkDevice, swapChain, nullptr);
+    }
+    mSwapChainsToDelete.ClearUpTo(completedSerial);
+    for (VkSurfaceKHR surface : mSurfacesToDelete.IterateUpTo(completedSerial)) {
+        mDevice->fn.DestroySurfaceKHR(instance, surface, nullptr);
+    }
+    mSurfacesToDelete.ClearUpTo(completedSerial);
+
+    DeletionBatch batch;
+    TakeUpTo(&mBuffersToDelete, completedSerial, &batch.buffers);
+    TakeUpTo(&mImagesToDelete, completedSerial, &batch.images);
+    TakeUpTo(&mMemoriesToDelete, completedSerial, &batch.memories);
+    TakeUpTo(&mPipelineLayoutsToDelete, completedSerial, &batch.pipelineLayouts);
+    TakeUpTo(&mRenderPassesToDelete, completedSerial, &batch.renderPasses);
+    TakeUpTo(&mFencesToDelete, completedSerial, &batch.fences);
+    TakeUpTo(&mFramebuffersToDelete, completedSerial, &batch.framebuffers);
+    TakeUpTo(&mImageViewsToDelete, completedSerial, &batch.imageViews);
+    TakeUpTo(&mShaderModulesToDelete, completedSerial, &batch.shaderModules);
+    TakeUpTo(&mPipelinesToDelete, completedSerial, &batch.pipelines);
+    TakeUpTo(&mSemaphoresToDelete, completedSerial, &batch.semaphores);
+    TakeUpTo(&mDescriptorPoolsToDelete, completedSerial, &batch.descriptorPools);
+    TakeUpTo(&mQueryPoolsToDelete, completedSerial, &batch.queryPools);
+    TakeUpTo(&mSamplerYcbcrConversionsToDelete, completedSerial, &batch.samplerYcbcrConversions);
+    TakeUpTo(&mSamplersToDelete, completedSerial, &batch.samplers);
+
+    if (mDeleteInBackground && completedSerial != kMaxExecutionSerial) {
+        if (batch.GetCount() != 0) {
+            EnqueueBackgroundDeletion(std::move(batch));
+        }
+    } else {
+        // Objects from earlier ticks may still be waiting in the worker task. They must be
+        // destroyed first so that the order between ticks is kept, and so that nothing is left
+        // when the device is destroyed.
+        WaitForBackgroundDeletions();
+        DestroyBatch(batch);
+    }
+
+    mDevice->GetMetrics()->RecordDeferredDeletionQueueDepth(GetPendingDeletionCount());
+}
+
+uint64_t FencedDeleter::GetPendingDeletionCount() const {
+    return mBuffersToDelete.Size() + mDescriptorPoolsToDelete.Size() + mMemoriesToDelete.Size() +
+           mFencesToDelete.Size() + mFramebuffersToDelete.Size() + mImagesToDelete.Size() +
+           mImageViewsToDelete.Size() + mPipelinesToDelete.Size() +
+           mPipelineLayoutsToDelete.Size() + mQueryPoolsToDelete.Size() +
+           mRenderPassesToDelete.Size() + mSamplerYcbcrConversionsToDelete.Size() +
+           mSamplersToDelete.Size() + mSemaphoresToDelete.Size() + mShaderModulesToDelete.Size() +
+           mSurfacesToDelete.Size() + mSwapChainsToDelete.Size();
+}
+
+void FencedDeleter::WaitForBackgroundDeletions() {
+    if (!mDeleteInBackground) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mBackgroundDeletionMutex);
+    mBackgroundDeletionCondition.wait(lock, [&] { return !mBackgroundDeletionTaskRunning; });
+}
+
+void FencedDeleter::EnqueueBackgroundDeletion(DeletionBatch batch) {
+    uint64_t count = batch.GetCount();
+    bool postTask = false;
+    {
+        std::unique_lock<std::mutex> lock(mBackgroundDeletionMutex);
+
+        // Memory isn't returned to the driver until the worker task frees it, so don't let the
+        // task fall arbitrarily far behind. The wait only covers the batches of earlier ticks.
+        mBackgroundDeletionCondition.wait(lock, [&] {
+            return mPendingBackgroundDeletionCount <= kMaxPendingBackgroundDeletions;
+        });
+
+        mPendingBackgroundDeletions.push_back(std::move(batch));
+        mPendingBackgroundDeletionCount += count;
+        mDevice->GetMetrics()->RecordBackgroundDeletionQueueDepth(mPendingBackgroundDeletionCount);
+
+        postTask = !mBackgroundDeletionTaskRunning;
+        mBackgroundDeletionTaskRunning = true;
+    }
+
+    // The task doesn't need to keep a reference to anything: the device waits for it in
+    // Tick(kMaxExecutionSerial) before destroying the FencedDeleter.
+    if (postTask) {
+        mDevice->GetAsyncTaskManager()->PostTask([this] { ProcessBackgroundDeletions(); });
+    }
+}
+
+void FencedDeleter::ProcessBackgroundDeletions() {
+    std::unique_lock<std::mutex> lock(mBackgroundDeletionMutex);
+    DAWN_ASSERT(mBackgroundDeletionTaskRunning);
+    while (!mPendingBackgroundDeletions.empty()) {
+        DeletionBatch batch = std::move(mPendingBackgroundDeletions.front());
+        mPendingBackgroundDeletions.pop_front();
+
+        // Don't hold the lock while destroying the objects so the device can keep enqueuing
+        // batches.
+        lock.unlock();
+        TRACE_EVENT0(mDevice->GetPlatform(), General, "FencedDeleter::DestroyBatch");
+        DestroyBatch(batch);
+        lock.lock();
+
+        uint64_t count = batch.GetCount();
+        DAWN_ASSERT(mPendingBackgroundDeletionCount >= count);
+        mPendingBackgroundDeletionCount -= count;
+        mDevice->GetMetrics()->RecordBackgroundDeletions(count);
+        mDevice->GetMetrics()->RecordBackgroundDeletionQueueDepth(mPendingBackgroundDeletionCount);
+        mBackgroundDeletionCondition.notify_all();
+    }
+    mBackgroundDeletionTaskRunning = false;
+    mBackgroundDeletionCondition.notify_all();
+}
+
+void FencedDeleter::DestroyBatch(const DeletionBatch& batch) {
+    VkDevice vkDevice = mDevice->GetVkDevice();
+
     // Buffers and images must be deleted before memories because it is invalid to free memory
     // that still have resources bound to it.
-    for (VkBuffer buffer : mBuffersToDelete.IterateUpTo(completedSerial)) {
+    for (VkBuffer buffer : batch.buffers) {
         mDevice->fn.DestroyBuffer(vkDevice, buffer, nullptr);
     }
-    mBuffersToDelete.ClearUpTo(completedSerial);
-    for (VkImage image : mImagesToDelete.IterateUpTo(completedSerial)) {
+    for (VkImage image : batch.images) {
         mDevice->fn.DestroyImage(vkDevice, image, nullptr);
     }
-    mImagesToDelete.ClearUpTo(completedSerial);
-
-    for (VkDeviceMemory memory : mMemoriesToDelete.IterateUpTo(completedSerial)) {
+    for (VkDeviceMemory memory : batch.memories) {
         mDevice->fn.FreeMemory(vkDevice, memory, nullptr);
     }
-    mMemoriesToDelete.ClearUpTo(completedSerial);
 
-    for (VkPipelineLayout layout : mPipelineLayoutsToDelete.IterateUpTo(completedSerial)) {
+    for (VkPipelineLayout layout : batch.pipelineLayouts) {
         mDevice->fn.DestroyPipelineLayout(vkDevice, layout, nullptr);
     }
-    mPipelineLayoutsToDelete.ClearUpTo(completedSerial);
-
-    for (VkRenderPass renderPass : mRenderPassesToDelete.IterateUpTo(completedSerial)) {
+    for (VkRenderPass renderPass : batch.renderPasses) {
         mDevice->fn.DestroyRenderPass(vkDevice, renderPass, nullptr);
     }
-    mRenderPassesToDelete.ClearUpTo(completedSerial);
-
-    for (VkFence fence : mFencesToDelete.IterateUpTo(completedSerial)) {
+    for (VkFence fence : batch.fences) {
         mDevice->fn.DestroyFence(vkDevice, fence, nullptr);
     }
-    mFencesToDelete.ClearUpTo(completedSerial);
-
-    for (VkFramebuffer framebuffer : mFramebuffersToDelete.IterateUpTo(completedSerial)) {
+    for (VkFramebuffer framebuffer : batch.framebuffers) {
         mDevice->fn.DestroyFramebuffer(vkDevice, framebuffer, nullptr);
     }
-    mFramebuffersToDelete.ClearUpTo(completedSerial);
-
-    for (VkImageView view : mImageViewsToDelete.IterateUpTo(completedSerial)) {
+    for (VkImageView view : batch.imageViews) {
         mDevice->fn.DestroyImageView(vkDevice, view, nullptr);
     }
-    mImageViewsToDelete.ClearUpTo(completedSerial);
-
-    for (VkShaderModule module : mShaderModulesToDelete.IterateUpTo(completedSerial)) {
+    for (VkShaderModule module : batch.shaderModules) {
         mDevice->fn.DestroyShaderModule(vkDevice, module, nullptr);
     }
-    mShaderModulesToDelete.ClearUpTo(completedSerial);
-
-    for (VkPipeline pipeline : mPipelinesToDelete.IterateUpTo(completedSerial)) {
+    for (VkPipeline pipeline : batch.pipelines) {
         mDevice->fn.DestroyPipeline(vkDevice, pipeline, nullptr);
     }
-    mPipelinesToDelete.ClearUpTo(completedSerial);
-
-    // Vulkan swapchains must be destroyed before their corresponding VkSurface
-    for (VkSwapchainKHR swapChain : mSwapChainsToDelete.IterateUpTo(completedSerial)) {
-        mDevice->fn.DestroySwapchainKHR(vkDevice, swapChain, nullptr);
-    }
-    mSwapChainsToDelete.ClearUpTo(completedSerial);
-    for (VkSurfaceKHR surface : mSurfacesToDelete.IterateUpTo(completedSerial)) {
-        mDevice->fn.DestroySurfaceKHR(instance, surface, nullptr);
-    }
-    mSurfacesToDelete.ClearUpTo(completedSerial);
-
-    for (VkSemaphore semaphore : mSemaphoresToDelete.IterateUpTo(completedSerial)) {
+    for (VkSemaphore semaphore : batch.semaphores) {
         mDevice->fn.DestroySemaphore(vkDevice, semaphore, nullptr);
     }
-    mSemaphoresToDelete.ClearUpTo(completedSerial);
-
-    for (VkDescriptorPool pool : mDescriptorPoolsToDelete.IterateUpTo(completedSerial)) {
+    for (VkDescriptorPool pool : batch.descriptorPools) {
         mDevice->fn.DestroyDescriptorPool(vkDevice, pool, nullptr);
     }
-    mDescriptorPoolsToDelete.ClearUpTo(completedSerial);
-
-    for (VkQueryPool pool : mQueryPoolsToDelete.IterateUpTo(completedSerial)) {
+    for (VkQueryPool pool : batch.queryPools) {
         mDevice->fn.DestroyQueryPool(vkDevice, pool, nullptr);
     }
-    mQueryPoolsToDelete.ClearUpTo(completedSerial);
-
-    for (VkSamplerYcbcrConversion samplerYcbcrConversion :
-         mSamplerYcbcrConversionsToDelete.IterateUpTo(completedSerial)) {
+    for (VkSamplerYcbcrConversion samplerYcbcrConversion : batch.samplerYcbcrConversions) {
         mDevice->fn.DestroySamplerYcbcrConversion(vkDevice, samplerYcbcrConversion, nullptr);
     }
-    mSamplerYcbcrConversionsToDelete.ClearUpTo(completedSerial);
-
-    for (VkSampler sampler : mSamplersToDelete.IterateUpTo(completedSerial)) {
+    for (VkSampler sampler : batch.samplers) {
         mDevice->fn.DestroySampler(vkDevice, sampler, nullptr);
     }
-    mSamplersToDelete.ClearUpTo(completedSerial);
+}
+
+uint64_t FencedDeleter::DeletionBatch::GetCount() const {
+    return buffers.size() + images.size() + memories.size() + pipelineLayouts.size() +
+           renderPasses.size() + fences.size() + framebuffers.size() + imageViews.size() +
+           shaderModules.size() + pipelines.size() + semaphores.size() + descriptorPools.size() +
+           queryPools.size() + samplerYcbcrConversions.size() + samplers.size();
 }
 
 }  // namespace dawn::native::vulkan
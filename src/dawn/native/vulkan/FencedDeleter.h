@@ -28,6 +28,12 @@
 #ifndef SRC_DAWN_NATIVE_VULKAN_FENCEDDELETER_H_
 #define SRC_DAWN_NATIVE_VULKAN_FENCEDDELETER_H_
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
 #include "dawn/common/SerialQueue.h"
 #include "dawn/common/vulkan_platform.h"
 #include "dawn/native/IntegerTypes.h"
@@ -60,9 +66,46 @@ class FencedDeleter {
     void DeleteWhenUnused(VkSurfaceKHR surface);
     void DeleteWhenUnused(VkSwapchainKHR swapChain);
 
+    // Destroys the objects whose serial has completed. When
+    // Toggle::VulkanBackgroundDeferredDeletion is enabled, all but swapchains and surfaces are
+    // handed to a worker task instead.
+    // Tick(kMaxExecutionSerial) is only used when the device is destroyed, so it always destroys
+    // everything before returning.
     void Tick(ExecutionSerial completedSerial);
 
+    // Returns the number of objects waiting for their serial to complete.
+    uint64_t GetPendingDeletionCount() const;
+
+    // Waits for the worker task to destroy all the objects handed to it.
+    void WaitForBackgroundDeletions();
+
   private:
+    // Objects whose serial has completed. DestroyBatch destroys them in an order where resources
+    // are destroyed before the memory bound to them.
+    struct DeletionBatch {
+        uint64_t GetCount() const;
+
+        std::vector<VkBuffer> buffers;
+        std::vector<VkImage> images;
+        std::vector<VkDeviceMemory> memories;
+        std::vector<VkPipelineLayout> pipelineLayouts;
+        std::vector<VkRenderPass> renderPasses;
+        std::vector<VkFence> fences;
+        std::vector<VkFramebuffer> framebuffers;
+        std::vector<VkImageView> imageViews;
+        std::vector<VkShaderModule> shaderModules;
+        std::vector<VkPipeline> pipelines;
+        std::vector<VkSemaphore> semaphores;
+        std::vector<VkDescriptorPool> descriptorPools;
+        std::vector<VkQueryPool> queryPools;
+        std::vector<VkSamplerYcbcrConversion> samplerYcbcrConversions;
+        std::vector<VkSampler> samplers;
+    };
+
+    void DestroyBatch(const DeletionBatch& batch);
+    void EnqueueBackgroundDeletion(DeletionBatch batch);
+    void ProcessBackgroundDeletions();
+
     raw_ptr<Device> mDevice = nullptr;
     SerialQueue<ExecutionSerial, VkBuffer> mBuffersToDelete;
     SerialQueue<ExecutionSerial, VkDescriptorPool> mDescriptorPoolsToDelete;
@@ -81,6 +124,17 @@ class FencedDeleter {
     SerialQueue<ExecutionSerial, VkShaderModule> mShaderModulesToDelete;
     SerialQueue<ExecutionSerial, VkSurfaceKHR> mSurfacesToDelete;
     SerialQueue<ExecutionSerial, VkSwapchainKHR> mSwapChainsToDelete;
+
+    // When Toggle::VulkanBackgroundDeferredDeletion is enabled, Tick moves the completed objects
+    // into batches that are destroyed by a task posted to the AsyncTaskManager. At most one such
+    // task runs at a time and it destroys the batches in order. The objects are no longer used by
+    // anything else, so the only state shared with the task is the list of pending batches.
+    bool mDeleteInBackground = false;
+    std::mutex mBackgroundDeletionMutex;
+    std::condition_variable mBackgroundDeletionCondition;
+    std::deque<DeletionBatch> mPendingBackgroundDeletions;
+    uint64_t mPendingBackgroundDeletionCount = 0;
+    bool mBackgroundDeletionTaskRunning = false;
 };
 
 }  // namespace dawn::native::vulkan
@@ -0,0 +1,175 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/vulkan/FramebufferCache.h"
+
+#include "dawn/common/HashUtils.h"
+#include "dawn/native/vulkan/DeviceVk.h"
+#include "dawn/native/vulkan/FencedDeleter.h"
+#include "dawn/native/vulkan/UtilsVulkan.h"
+#include "dawn/native/vulkan/VulkanError.h"
+
+namespace dawn::native::vulkan {
+
+namespace {
+
+// Framebuffers are never removed from the cache, so stop caching new ones after this many. This
+// only happens with many differently sized render targets, like when a window is resized.
+constexpr size_t kMaxCachedFramebuffers = 1024;
+
+}  // anonymous namespace
+
+// FramebufferCacheQuery
+
+void FramebufferCacheQuery::AddAttachment(VkImageCreateFlags flags,
+                                          VkImageUsageFlags usage,
+                                          const std::vector<VkFormat>& viewFormats,
+                                          uint32_t width,
+                                          uint32_t height) {
+    DAWN_ASSERT(attachmentCount < attachments.size());
+    DAWN_ASSERT(!viewFormats.empty());
+    Attachment& attachment = attachments[attachmentCount++];
+    attachment.flags = flags;
+    attachment.usage = usage;
+    attachment.viewFormats.assign(viewFormats.begin(), viewFormats.end());
+    attachment.width = width;
+    attachment.height = height;
+}
+
+// FramebufferCache
+
+FramebufferCache::FramebufferCache(Device* device) : mDevice(device) {}
+
+FramebufferCache::~FramebufferCache() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCache.ForEach([&](const FramebufferCacheQuery&, VkFramebuffer framebuffer) {
+        mDevice->fn.DestroyFramebuffer(mDevice->GetVkDevice(), framebuffer, nullptr);
+    });
+}
+
+ResultOrError<VkFramebuffer> FramebufferCache::GetFramebuffer(const FramebufferCacheQuery& query) {
+    if (const VkFramebuffer* framebuffer = mCache.Find(query)) {
+        return VkFramebuffer(*framebuffer);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    // Another thread may have created the framebuffer while this one was waiting for the lock.
+    if (const VkFramebuffer* framebuffer = mCache.Find(query)) {
+        return VkFramebuffer(*framebuffer);
+    }
+
+    VkFramebuffer framebuffer;
+    DAWN_TRY_ASSIGN(framebuffer, CreateFramebufferForQuery(query));
+    if (mCache.Size() < kMaxCachedFramebuffers) {
+        mCache.Insert(query, framebuffer);
+    } else {
+        mDevice->GetFencedDeleter()->DeleteWhenUnused(framebuffer);
+    }
+    return framebuffer;
+}
+
+ResultOrError<VkFramebuffer> FramebufferCache::CreateFramebufferForQuery(
+    const FramebufferCacheQuery& query) const {
+    std::array<VkFramebufferAttachmentImageInfo, kMaxColorAttachments * 2 + 1> imageInfos;
+    for (uint32_t i = 0; i < query.attachmentCount; ++i) {
+        const FramebufferCacheQuery::Attachment& attachment = query.attachments[i];
+
+        // WebGPU render attachments are single-layer views, and Vulkan expects the size of the
+        // view's mip level here.
+        imageInfos[i].sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO;
+        imageInfos[i].pNext = nullptr;
+        imageInfos[i].flags = attachment.flags;
+        imageInfos[i].usage = attachment.usage;
+        imageInfos[i].width = attachment.width;
+        imageInfos[i].height = attachment.height;
+        imageInfos[i].layerCount = 1;
+        imageInfos[i].viewFormatCount = static_cast<uint32_t>(attachment.viewFormats.size());
+        imageInfos[i].pViewFormats = attachment.viewFormats.data();
+    }
+
+    VkFramebufferCreateInfo createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    createInfo.pNext = nullptr;
+    createInfo.flags = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT;
+    createInfo.renderPass = query.renderPass;
+    createInfo.attachmentCount = query.attachmentCount;
+    createInfo.pAttachments = nullptr;
+    createInfo.width = query.width;
+    createInfo.height = query.height;
+    createInfo.layers = 1;
+
+    VkFramebufferAttachmentsCreateInfo attachmentsInfo;
+    attachmentsInfo.attachmentImageInfoCount = query.attachmentCount;
+    attachmentsInfo.pAttachmentImageInfos = imageInfos.data();
+
+    PNextChainBuilder createInfoChain(&createInfo);
+    createInfoChain.Add(&attachmentsInfo, VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO);
+
+    VkFramebuffer framebuffer;
+    DAWN_TRY(CheckVkSuccess(mDevice->fn.CreateFramebuffer(mDevice->GetVkDevice(), &createInfo,
+                                                          nullptr, &*framebuffer),
+                            "CreateFramebuffer"));
+    return framebuffer;
+}
+
+// FramebufferCache
+
+size_t FramebufferCache::CacheFuncs::operator()(const FramebufferCacheQuery& query) const {
+    size_t hash = Hash(query.renderPass.GetHandle());
+    HashCombine(&hash, query.width, query.height, query.attachmentCount);
+    for (uint32_t i = 0; i < query.attachmentCount; ++i) {
+        const FramebufferCacheQuery::Attachment& attachment = query.attachments[i];
+        HashCombine(&hash, attachment.flags, attachment.usage, attachment.width,
+                    attachment.height, attachment.viewFormats.size());
+        for (VkFormat format : attachment.viewFormats) {
+            HashCombine(&hash, format);
+        }
+    }
+    return hash;
+}
+
+bool FramebufferCache::CacheFuncs::operator()(const FramebufferCacheQuery& a,
+                                              const FramebufferCacheQuery& b) const {
+    if (a.renderPass != b.renderPass || a.width != b.width || a.height != b.height ||
+        a.attachmentCount != b.attachmentCount) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < a.attachmentCount; ++i) {
+        const FramebufferCacheQuery::Attachment& attachmentA = a.attachments[i];
+        const FramebufferCacheQuery::Attachment& attachmentB = b.attachments[i];
+        if (attachmentA.flags != attachmentB.flags || attachmentA.usage != attachmentB.usage ||
+            attachmentA.width != attachmentB.width || attachmentA.height != attachmentB.height ||
+            attachmentA.viewFormats != attachmentB.viewFormats) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace dawn::native::vulkan
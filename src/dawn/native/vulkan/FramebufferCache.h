@@ -0,0 +1,106 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_VULKAN_FRAMEBUFFERCACHE_H_
+#define SRC_DAWN_NATIVE_VULKAN_FRAMEBUFFERCACHE_H_
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+#include "absl/container/inlined_vector.h"
+#include "dawn/common/Constants.h"
+#include "dawn/common/ReadMostlyHashMap.h"
+#include "dawn/common/vulkan_platform.h"
+#include "dawn/native/Error.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::native::vulkan {
+
+class Device;
+
+// This is a key to query the FramebufferCache. Imageless framebuffers don't reference
+// VkImageViews, only the properties of the images that are attached when the render pass begins,
+// so the attachments are described by the flags, usage and view formats of their images and by
+// the size of the views. Like for VkRenderPasses, the attachments are in
+// "color-depthstencil-resolve" order.
+struct FramebufferCacheQuery {
+    void AddAttachment(VkImageCreateFlags flags,
+                       VkImageUsageFlags usage,
+                       const std::vector<VkFormat>& viewFormats,
+                       uint32_t width,
+                       uint32_t height);
+
+    struct Attachment {
+        VkImageCreateFlags flags = 0;
+        VkImageUsageFlags usage = 0;
+        absl::InlinedVector<VkFormat, 2> viewFormats;
+        uint32_t width = 0;
+        uint32_t height = 0;
+    };
+
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t attachmentCount = 0;
+    std::array<Attachment, kMaxColorAttachments * 2 + 1> attachments;
+};
+
+// Caches imageless VkFramebuffers created with VK_KHR_imageless_framebuffer so that render passes
+// don't need to create and delete a VkFramebuffer each time they begin. The VkRenderPasses used
+// in the queries come from the RenderPassCache, so their handles are never reused while the
+// device is alive. All the operations on FramebufferCache are thread-safe, and lookups of
+// framebuffers that are already in the cache don't take a lock.
+class FramebufferCache {
+  public:
+    explicit FramebufferCache(Device* device);
+    ~FramebufferCache();
+
+    // Returns a framebuffer for the query. When the cache is full, the framebuffer is created for
+    // this render pass only and deleted once the commands currently being recorded are finished.
+    ResultOrError<VkFramebuffer> GetFramebuffer(const FramebufferCacheQuery& query);
+
+  private:
+    ResultOrError<VkFramebuffer> CreateFramebufferForQuery(
+        const FramebufferCacheQuery& query) const;
+
+    struct CacheFuncs {
+        size_t operator()(const FramebufferCacheQuery& query) const;
+        bool operator()(const FramebufferCacheQuery& a, const FramebufferCacheQuery& b) const;
+    };
+    using Cache = ReadMostlyHashMap<FramebufferCacheQuery, VkFramebuffer, CacheFuncs, CacheFuncs>;
+
+    raw_ptr<Device> mDevice = nullptr;
+
+    // Only taken on cache misses, to serialize the creation and insertion of framebuffers.
+    std::mutex mMutex;
+    Cache mCache;
+};
+
+}  // namespace dawn::native::vulkan
+
+#endif  // SRC_DAWN_NATIVE_VULKAN_FRAMEBUFFERCACHE_H_
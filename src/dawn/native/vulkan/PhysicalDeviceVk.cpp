@@ -819,6 +819,36 @@ void PhysicalDevice::SetupBackendDeviceToggles(dawn::platform::Platform* platfor
         GetDeviceInfo().shaderIntegerDotProductFeatures.shaderIntegerDotProduct == VK_FALSE) {
         deviceToggles->ForceSet(Toggle::PolyFillPacked4x8DotProduct, true);
     }
+
+    // Pipeline libraries can only be used when VK_EXT_graphics_pipeline_library is available.
+    // Without fast linking each link may cost as much as a monolithic pipeline creation, which
+    // defeats the purpose, so require it as well.
+    if (!GetDeviceInfo().HasExt(DeviceExt::GraphicsPipelineLibrary) ||
+        GetDeviceInfo().graphicsPipelineLibraryFeatures.graphicsPipelineLibrary == VK_FALSE ||
+        GetDeviceInfo().graphicsPipelineLibraryProperties.graphicsPipelineLibraryFastLinking ==
+            VK_FALSE) {
+        deviceToggles->ForceSet(Toggle::VulkanUseGraphicsPipelineLibrary, false);
+    }
+
+    // Asynchronous submits rely on waiting for serials that may not be submitted yet, which only
+    // timeline semaphores support.
+    if (!GetDeviceInfo().HasExt(DeviceExt::TimelineSemaphore) ||
+        GetDeviceInfo().timelineSemaphoreFeatures.timelineSemaphore == VK_FALSE) {
+        deviceToggles->ForceSet(Toggle::VulkanAsyncQueueSubmission, false);
+    }
+
+    if (!GetDeviceInfo().HasExt(DeviceExt::DescriptorUpdateTemplate)) {
+        deviceToggles->ForceSet(Toggle::VulkanUseDescriptorUpdateTemplates, false);
+    }
+    // By default write the descriptors of bind groups with update templates when possible.
+    deviceToggles->Default(Toggle::VulkanUseDescriptorUpdateTemplates, true);
+
+    if (!GetDeviceInfo().HasExt(DeviceExt::ImagelessFramebuffer) ||
+        GetDeviceInfo().imagelessFramebufferFeatures.imagelessFramebuffer == VK_FALSE) {
+        deviceToggles->ForceSet(Toggle::VulkanUseImagelessFramebuffers, false);
+    }
+    // By default reuse cached imageless framebuffers when possible.
+    deviceToggles->Default(Toggle::VulkanUseImagelessFramebuffers, true);
 }
 
 ResultOrError<Ref<DeviceBase>> PhysicalDevice::CreateDeviceImpl(
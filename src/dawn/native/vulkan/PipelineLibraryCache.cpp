@@ -0,0 +1,113 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/vulkan/PipelineLibraryCache.h"
+
+#include <algorithm>
+#include <string_view>
+
+#include "dawn/native/vulkan/DeviceVk.h"
+#include "dawn/native/vulkan/RenderPipelineVk.h"
+
+namespace dawn::native::vulkan {
+
+PipelineLibrary::PipelineLibrary(Device* device, VkPipeline handle)
+    : mDevice(device), mHandle(handle) {}
+
+PipelineLibrary::~PipelineLibrary() {
+    // Libraries are never bound in command buffers so they can be destroyed immediately.
+    mDevice->fn.DestroyPipeline(mDevice->GetVkDevice(), mHandle, nullptr);
+}
+
+VkPipeline PipelineLibrary::GetHandle() const {
+    return mHandle;
+}
+
+PipelineLibraryCache::PipelineLibraryCache(Device* device) : mDevice(device) {}
+
+PipelineLibraryCache::~PipelineLibraryCache() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCache.clear();
+    mLibraries.clear();
+    mOptimizedPipelines.clear();
+}
+
+Ref<PipelineLibrary> PipelineLibraryCache::Find(const CacheKey& key) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mCache.find(key);
+    if (it == mCache.end()) {
+        return nullptr;
+    }
+    mLibraries.splice(mLibraries.begin(), mLibraries, it->second);
+    return it->second->second;
+}
+
+Ref<PipelineLibrary> PipelineLibraryCache::Insert(const CacheKey& key, VkPipeline library) {
+    Ref<PipelineLibrary> newLibrary = AcquireRef(new PipelineLibrary(mDevice, library));
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mCache.find(key);
+    if (it != mCache.end()) {
+        mLibraries.splice(mLibraries.begin(), mLibraries, it->second);
+        return it->second->second;
+    }
+
+    if (mLibraries.size() >= kMaxLibraryCount) {
+        mCache.erase(mLibraries.back().first);
+        mLibraries.pop_back();
+    }
+    mLibraries.emplace_front(key, newLibrary);
+    mCache.emplace(key, mLibraries.begin());
+    return newLibrary;
+}
+
+void PipelineLibraryCache::AddOptimizedPipeline(Ref<RenderPipeline> pipeline) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mOptimizedPipelines.push_back(std::move(pipeline));
+}
+
+void PipelineLibraryCache::Tick() {
+    std::vector<Ref<RenderPipeline>> optimizedPipelines;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        optimizedPipelines.swap(mOptimizedPipelines);
+    }
+    for (Ref<RenderPipeline>& pipeline : optimizedPipelines) {
+        pipeline->SwapInOptimizedHandle();
+    }
+}
+
+size_t PipelineLibraryCache::CacheFuncs::operator()(const CacheKey& key) const {
+    return std::hash<std::string_view>()(
+        std::string_view(reinterpret_cast<const char*>(key.data()), key.size()));
+}
+
+bool PipelineLibraryCache::CacheFuncs::operator()(const CacheKey& a, const CacheKey& b) const {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+}  // namespace dawn::native::vulkan
@@ -0,0 +1,115 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_VULKAN_PIPELINELIBRARYCACHE_H_
+#define SRC_DAWN_NATIVE_VULKAN_PIPELINELIBRARYCACHE_H_
+
+#include <list>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "dawn/common/Ref.h"
+#include "dawn/common/RefCounted.h"
+#include "dawn/common/vulkan_platform.h"
+#include "dawn/native/CacheKey.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::native::vulkan {
+
+class Device;
+class RenderPipeline;
+
+// A VkPipeline library created with VK_EXT_graphics_pipeline_library. It is destroyed when the last
+// reference to it is released, so that a library evicted from the PipelineLibraryCache stays valid
+// while a pipeline is still being link-time optimized from it.
+class PipelineLibrary : public RefCounted {
+  public:
+    PipelineLibrary(Device* device, VkPipeline handle);
+
+    VkPipeline GetHandle() const;
+
+  private:
+    ~PipelineLibrary() override;
+
+    raw_ptr<Device> mDevice;
+    VkPipeline mHandle = VK_NULL_HANDLE;
+};
+
+// Caches the VkPipeline libraries created with VK_EXT_graphics_pipeline_library for each of the
+// four graphics pipeline state subsets (vertex input, pre-rasterization shaders, fragment shader
+// and fragment output). RenderPipelines that only differ in some of the subsets can then reuse the
+// libraries of the others and only pay for a fast link instead of a full pipeline compilation.
+// Libraries are keyed by the CacheKey of the state that went into their creation. At most
+// kMaxLibraryCount libraries are cached, the least recently used ones are evicted first.
+//
+// The fast-linked pipelines are then link-time optimized in the background and the cache keeps the
+// RenderPipelines whose optimized handle is ready until the next Tick, where they swap it in.
+// All the operations on PipelineLibraryCache are thread-safe.
+class PipelineLibraryCache {
+  public:
+    static constexpr size_t kMaxLibraryCount = 1024;
+
+    explicit PipelineLibraryCache(Device* device);
+    ~PipelineLibraryCache();
+
+    // Returns the library cached for `key`, or nullptr if there is none yet.
+    Ref<PipelineLibrary> Find(const CacheKey& key);
+
+    // Adds `library` to the cache and returns the library that is now cached for `key`. Libraries
+    // are created outside of the lock so two threads can race to create the same one. In that case
+    // the library that was inserted first wins and `library` is destroyed.
+    Ref<PipelineLibrary> Insert(const CacheKey& key, VkPipeline library);
+
+    // Called from the background tasks once the link-time optimized handle of `pipeline` is ready.
+    void AddOptimizedPipeline(Ref<RenderPipeline> pipeline);
+
+    // Swaps in the link-time optimized handles of the pipelines added since the last Tick. Must be
+    // called while no commands are being recorded, since those read the pipelines' handles.
+    void Tick();
+
+  private:
+    struct CacheFuncs {
+        size_t operator()(const CacheKey& key) const;
+        bool operator()(const CacheKey& a, const CacheKey& b) const;
+    };
+    // The most recently used libraries are at the front of the list.
+    using LibraryList = std::list<std::pair<CacheKey, Ref<PipelineLibrary>>>;
+    using Cache = absl::flat_hash_map<CacheKey, LibraryList::iterator, CacheFuncs, CacheFuncs>;
+
+    raw_ptr<Device> mDevice = nullptr;
+
+    std::mutex mMutex;
+    LibraryList mLibraries;
+    Cache mCache;
+    std::vector<Ref<RenderPipeline>> mOptimizedPipelines;
+};
+
+}  // namespace dawn::native::vulkan
+
+#endif  // SRC_DAWN_NATIVE_VULKAN_PIPELINELIBRARYCACHE_H_
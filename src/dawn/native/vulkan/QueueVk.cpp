@@ -32,6 +32,7 @@
 #include <utility>
 
 #include "dawn/common/Math.h"
+#include "dawn/native/AsyncTask.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/CommandValidation.h"
 #include "dawn/native/Commands.h"
@@ -70,6 +71,35 @@ void DestroyCommandPoolAndBuffer(const VulkanFunctions& fn,
     }
 }
 
+// Destroys a secondary command pool and its command buffers, see DestroyCommandPoolAndBuffer.
+void DestroySecondaryCommandPool(const VulkanFunctions& fn,
+                                 VkDevice device,
+                                 const SecondaryCommandPool& pool) {
+    if (!pool.commandBuffers.empty()) {
+        fn.FreeCommandBuffers(device, pool.pool, static_cast<uint32_t>(pool.commandBuffers.size()),
+                              pool.commandBuffers.data());
+    }
+    fn.DestroyCommandPool(device, pool.pool, nullptr);
+}
+
+// Waits on the CPU for the counter value of the timeline `semaphore` to reach `serial`.
+::VkResult WaitForTimelineSemaphore(Device* device,
+                                    VkSemaphore semaphore,
+                                    ExecutionSerial serial,
+                                    uint64_t timeout) {
+    uint64_t value = static_cast<uint64_t>(serial);
+
+    VkSemaphoreWaitInfo waitInfo;
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.pNext = nullptr;
+    waitInfo.flags = 0;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = AsVkArray(&semaphore);
+    waitInfo.pValues = &value;
+
+    return device->fn.WaitSemaphores(device->GetVkDevice(), &waitInfo, timeout);
+}
+
 }  // anonymous namespace
 
 // static
@@ -92,10 +122,41 @@ MaybeError Queue::Initialize() {
 
     DAWN_TRY(PrepareRecordingContext());
 
+    if (device->GetDeviceInfo().timelineSemaphoreFeatures.timelineSemaphore == VK_TRUE) {
+        DAWN_TRY(CreateTimelineSemaphore());
+    }
+    mUseAsyncSubmission =
+        UsesTimelineSemaphore() && device->IsToggleEnabled(Toggle::VulkanAsyncQueueSubmission);
+
     SetLabelImpl();
     return {};
 }
 
+MaybeError Queue::CreateTimelineSemaphore() {
+    Device* device = ToBackend(GetDevice());
+
+    VkSemaphoreTypeCreateInfo semaphoreTypeInfo;
+    semaphoreTypeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    semaphoreTypeInfo.pNext = nullptr;
+    semaphoreTypeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    semaphoreTypeInfo.initialValue = static_cast<uint64_t>(GetLastSubmittedCommandSerial());
+
+    VkSemaphoreCreateInfo createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    createInfo.pNext = &semaphoreTypeInfo;
+    createInfo.flags = 0;
+
+    DAWN_TRY(CheckVkSuccess(device->fn.CreateSemaphore(device->GetVkDevice(), &createInfo,
+                                                       nullptr, &*mTimelineSemaphore),
+                            "vkCreateSemaphore"));
+    mLastSignaledSerial = GetLastSubmittedCommandSerial();
+    return {};
+}
+
+bool Queue::UsesTimelineSemaphore() const {
+    return mTimelineSemaphore != VK_NULL_HANDLE;
+}
+
 MaybeError Queue::SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands) {
     TRACE_EVENT_BEGIN0(GetDevice()->GetPlatform(), Recording, "CommandBufferVk::RecordCommands");
     CommandRecordingContext* recordingContext = GetPendingRecordingContext();
@@ -126,6 +187,24 @@ VkQueue Queue::GetVkQueue() const {
 
 ResultOrError<ExecutionSerial> Queue::CheckAndUpdateCompletedSerials() {
     Device* device = ToBackend(GetDevice());
+    DAWN_TRY(CheckAsyncSubmitError());
+
+    if (UsesTimelineSemaphore()) {
+        // Submits signal the timeline semaphore with their serial, so its counter value is the
+        // last completed serial.
+        uint64_t completedValue = 0;
+        VkResult result = VkResult::WrapUnsafe(
+            INJECT_ERROR_OR_RUN(device->fn.GetSemaphoreCounterValue(
+                                    device->GetVkDevice(), mTimelineSemaphore, &completedValue),
+                                VK_ERROR_DEVICE_LOST));
+        // The device is lost on errors, so make sure that the submit task is done with the objects
+        // that will be assumed unused.
+        DAWN_TRY_WITH_CLEANUP(
+            CheckVkSuccess(::VkResult(result), "vkGetSemaphoreCounterValue"),
+            { DrainAsyncSubmits(kMaxExecutionSerial); });
+        return ExecutionSerial(completedValue);
+    }
+
     return mFencesInFlight.Use([&](auto fencesInFlight) -> ResultOrError<ExecutionSerial> {
         ExecutionSerial fenceSerial(0);
         while (!fencesInFlight->empty()) {
@@ -166,9 +245,16 @@ MaybeError Queue::WaitForIdleForDestruction() {
         CommandPoolAndBuffer commands = {mRecordingContext.commandPool,
                                          mRecordingContext.commandBuffer};
         mUnusedCommands.push_back(commands);
+        for (SecondaryCommandPool& pool : mRecordingContext.secondaryCommandPools) {
+            mUnusedSecondaryCommandPools.push_back(std::move(pool));
+        }
         mRecordingContext = CommandRecordingContext();
     }
 
+    // The VkQueue can't be used while asynchronous submits are in progress. Their errors are
+    // ignored like the ones of QueueWaitIdle below.
+    DrainAsyncSubmits(kMaxExecutionSerial);
+
     Device* device = ToBackend(GetDevice());
     VkDevice vkDevice = device->GetVkDevice();
 
@@ -178,6 +264,26 @@ MaybeError Queue::WaitForIdleForDestruction() {
     [[maybe_unused]] VkResult waitIdleResult =
         VkResult::WrapUnsafe(device->fn.QueueWaitIdle(mQueue));
 
+    // Make sure all submits are complete by explicitly waiting on the last signaled serial.
+    if (UsesTimelineSemaphore()) {
+        VkResult result = VkResult::WrapUnsafe(VK_TIMEOUT);
+        do {
+            // See the comment on the fence wait below for why no error is injected while
+            // Disconnected.
+            if (GetDevice()->GetState() == Device::State::Disconnected) {
+                result = VkResult::WrapUnsafe(WaitForTimelineSemaphore(
+                    device, mTimelineSemaphore, mLastSignaledSerial, UINT64_MAX));
+                continue;
+            }
+
+            result = VkResult::WrapUnsafe(
+                INJECT_ERROR_OR_RUN(WaitForTimelineSemaphore(device, mTimelineSemaphore,
+                                                             mLastSignaledSerial, UINT64_MAX),
+                                    VK_ERROR_DEVICE_LOST));
+        } while (result == VK_TIMEOUT);
+        // Ignore errors from vkWaitSemaphores for the same reasons as vkWaitForFences below.
+    }
+
     // Make sure all fences are complete by explicitly waiting on them all
     mFencesInFlight.Use([&](auto fencesInFlight) {
         while (!fencesInFlight->empty()) {
@@ -312,11 +418,44 @@ ResultOrError<CommandPoolAndBuffer> Queue::BeginVkCommandBuffer() {
     return commands;
 }
 
+ResultOrError<SecondaryCommandPool> Queue::GetUnusedSecondaryCommandPool() {
+    Device* device = ToBackend(GetDevice());
+    VkDevice vkDevice = device->GetVkDevice();
+
+    // First try to recycle unused command pools.
+    if (!mUnusedSecondaryCommandPools.empty()) {
+        SecondaryCommandPool pool = std::move(mUnusedSecondaryCommandPools.back());
+        mUnusedSecondaryCommandPools.pop_back();
+        DAWN_TRY_WITH_CLEANUP(CheckVkSuccess(device->fn.ResetCommandPool(vkDevice, pool.pool, 0),
+                                             "vkResetCommandPool"),
+                              { DestroySecondaryCommandPool(device->fn, vkDevice, pool); });
+        pool.usedCommandBufferCount = 0;
+        return pool;
+    }
+
+    VkCommandPoolCreateInfo createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    createInfo.pNext = nullptr;
+    createInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    createInfo.queueFamilyIndex = mQueueFamily;
+
+    SecondaryCommandPool pool;
+    DAWN_TRY(CheckVkSuccess(
+        device->fn.CreateCommandPool(vkDevice, &createInfo, nullptr, &*pool.pool),
+        "vkCreateCommandPool"));
+    return pool;
+}
+
 void Queue::RecycleCompletedCommands(ExecutionSerial completedSerial) {
     for (auto& commands : mCommandsInFlight.IterateUpTo(completedSerial)) {
         mUnusedCommands.push_back(commands);
     }
     mCommandsInFlight.ClearUpTo(completedSerial);
+
+    for (auto& pool : mSecondaryCommandPoolsInFlight.IterateUpTo(completedSerial)) {
+        mUnusedSecondaryCommandPools.push_back(std::move(pool));
+    }
+    mSecondaryCommandPoolsInFlight.ClearUpTo(completedSerial);
 }
 
 MaybeError Queue::SubmitPendingCommands() {
@@ -324,6 +463,9 @@ MaybeError Queue::SubmitPendingCommands() {
         return {};
     }
 
+    // Report the errors of earlier asynchronous submits before making new ones.
+    DAWN_TRY(CheckAsyncSubmitError());
+
     Device* device = ToBackend(GetDevice());
 
     if (!mRecordingContext.mappableBuffersForEagerTransition.empty()) {
@@ -373,36 +515,46 @@ MaybeError Queue::SubmitPendingCommands() {
     DAWN_TRY(CheckVkSuccess(device->fn.EndCommandBuffer(mRecordingContext.commandBuffer),
                             "vkEndCommandBuffer"));
 
-    std::vector<VkPipelineStageFlags> dstStageMasks(mRecordingContext.waitSemaphores.size(),
-                                                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
-
     for (auto& externalTextureSemaphore : externalTextureSemaphores) {
         mRecordingContext.signalSemaphores.push_back(externalTextureSemaphore.Get());
     }
 
-    VkSubmitInfo submitInfo;
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.pNext = nullptr;
-    submitInfo.waitSemaphoreCount = static_cast<uint32_t>(mRecordingContext.waitSemaphores.size());
-    submitInfo.pWaitSemaphores = AsVkArray(mRecordingContext.waitSemaphores.data());
-    submitInfo.pWaitDstStageMask = dstStageMasks.data();
-    submitInfo.commandBufferCount = mRecordingContext.commandBufferList.size();
-    submitInfo.pCommandBuffers = mRecordingContext.commandBufferList.data();
-    submitInfo.signalSemaphoreCount = mRecordingContext.signalSemaphores.size();
-    submitInfo.pSignalSemaphores = AsVkArray(mRecordingContext.signalSemaphores.data());
+    // The serial this submit will be assigned once it succeeds.
+    ExecutionSerial submitSerial =
+        ExecutionSerial(static_cast<uint64_t>(GetLastSubmittedCommandSerial()) + 1);
+
+    PendingSubmit submit;
+    submit.serial = submitSerial;
+    submit.commandBuffers = mRecordingContext.commandBufferList;
+    submit.waitSemaphores = mRecordingContext.waitSemaphores;
+    submit.signalSemaphores = mRecordingContext.signalSemaphores;
+
+    // The semaphores of external textures can only be exported once their signal operation is
+    // pending, so submits that have some are always made synchronously.
+    bool submitAsync = mUseAsyncSubmission && externalTextureSemaphores.empty();
 
     VkFence fence = VK_NULL_HANDLE;
-    DAWN_TRY_ASSIGN(fence, GetUnusedFence());
+    if (!submitAsync) {
+        // Keep the submits in order with the asynchronous ones that are still pending.
+        DAWN_TRY(WaitForAsyncSubmits());
+
+        // With a timeline semaphore, it is signaled with the submit's serial instead of using a
+        // fence.
+        if (!UsesTimelineSemaphore()) {
+            DAWN_TRY_ASSIGN(fence, GetUnusedFence());
+        }
 
-    TRACE_EVENT_BEGIN0(device->GetPlatform(), Recording, "vkQueueSubmit");
-    DAWN_TRY_WITH_CLEANUP(
-        CheckVkSuccess(device->fn.QueueSubmit(mQueue, 1, &submitInfo, fence), "vkQueueSubmit"), {
+        TRACE_EVENT_BEGIN0(device->GetPlatform(), Recording, "vkQueueSubmit");
+        DAWN_TRY_WITH_CLEANUP(CheckVkSuccess(SubmitToVkQueue(submit, fence), "vkQueueSubmit"), {
             // If submitting to the queue fails, move the fence back into the unused fence
             // list, as if it were never acquired. Not doing so would leak the fence since
             // it would be neither in the unused list nor in the in-flight list.
-            mUnusedFences->push_back(fence);
+            if (fence != VK_NULL_HANDLE) {
+                mUnusedFences->push_back(fence);
+            }
         });
-    TRACE_EVENT_END0(device->GetPlatform(), Recording, "vkQueueSubmit");
+        TRACE_EVENT_END0(device->GetPlatform(), Recording, "vkQueueSubmit");
+    }
 
     // Enqueue the semaphores before incrementing the serial, so that they can be deleted as
     // soon as the current submission is finished.
@@ -411,13 +563,29 @@ MaybeError Queue::SubmitPendingCommands() {
     }
     IncrementLastSubmittedCommandSerial();
     ExecutionSerial lastSubmittedSerial = GetLastSubmittedCommandSerial();
-    mFencesInFlight->emplace_back(fence, lastSubmittedSerial);
+    DAWN_ASSERT(lastSubmittedSerial == submitSerial);
+    if (!UsesTimelineSemaphore()) {
+        mFencesInFlight->emplace_back(fence, lastSubmittedSerial);
+    } else if (!submitAsync) {
+        // The submit task updates mLastSignaledSerial for asynchronous submits.
+        mLastSignaledSerial = lastSubmittedSerial;
+    }
 
     for (size_t i = 0; i < mRecordingContext.commandBufferList.size(); ++i) {
         CommandPoolAndBuffer submittedCommands = {mRecordingContext.commandPoolList[i],
                                                   mRecordingContext.commandBufferList[i]};
         mCommandsInFlight.Enqueue(submittedCommands, lastSubmittedSerial);
     }
+    if (!mRecordingContext.secondaryCommandPools.empty()) {
+        mSecondaryCommandPoolsInFlight.Enqueue(std::move(mRecordingContext.secondaryCommandPools),
+                                               lastSubmittedSerial);
+    }
+
+    // Only hand the submit to the submit task once its serial is tracked as submitted, so that it
+    // can't be seen completing before that.
+    if (submitAsync) {
+        EnqueueAsyncSubmit(std::move(submit));
+    }
 
     auto externalTextureSemaphoreIter = externalTextureSemaphores.begin();
     for (auto texture : mRecordingContext.specialSyncTextures) {
@@ -439,6 +607,125 @@ MaybeError Queue::SubmitPendingCommands() {
     return {};
 }
 
+::VkResult Queue::SubmitToVkQueue(const PendingSubmit& submit, VkFence fence) {
+    Device* device = ToBackend(GetDevice());
+
+    std::vector<VkPipelineStageFlags> dstStageMasks(submit.waitSemaphores.size(),
+                                                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    // Signal values are ignored for the binary semaphores but one is needed per signal semaphore.
+    std::vector<VkSemaphore> signalSemaphores = submit.signalSemaphores;
+    std::vector<uint64_t> signalSemaphoreValues;
+    VkTimelineSemaphoreSubmitInfo timelineSubmitInfo;
+    if (UsesTimelineSemaphore()) {
+        signalSemaphores.push_back(mTimelineSemaphore);
+        signalSemaphoreValues.resize(signalSemaphores.size(), 0);
+        signalSemaphoreValues.back() = static_cast<uint64_t>(submit.serial);
+
+        timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineSubmitInfo.pNext = nullptr;
+        timelineSubmitInfo.waitSemaphoreValueCount = 0;
+        timelineSubmitInfo.pWaitSemaphoreValues = nullptr;
+        timelineSubmitInfo.signalSemaphoreValueCount =
+            static_cast<uint32_t>(signalSemaphoreValues.size());
+        timelineSubmitInfo.pSignalSemaphoreValues = signalSemaphoreValues.data();
+    }
+
+    VkSubmitInfo submitInfo;
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = UsesTimelineSemaphore() ? &timelineSubmitInfo : nullptr;
+    submitInfo.waitSemaphoreCount = static_cast<uint32_t>(submit.waitSemaphores.size());
+    submitInfo.pWaitSemaphores = AsVkArray(submit.waitSemaphores.data());
+    submitInfo.pWaitDstStageMask = dstStageMasks.data();
+    submitInfo.commandBufferCount = static_cast<uint32_t>(submit.commandBuffers.size());
+    submitInfo.pCommandBuffers = submit.commandBuffers.data();
+    submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+    submitInfo.pSignalSemaphores = AsVkArray(signalSemaphores.data());
+
+    return device->fn.QueueSubmit(mQueue, 1, &submitInfo, fence);
+}
+
+void Queue::EnqueueAsyncSubmit(PendingSubmit submit) {
+    bool postTask = false;
+    {
+        std::lock_guard<std::mutex> lock(mAsyncSubmitMutex);
+        mPendingAsyncSubmits.push_back(std::move(submit));
+        postTask = !mAsyncSubmitTaskRunning;
+        mAsyncSubmitTaskRunning = true;
+    }
+
+    // The task keeps a reference to the queue so that it stays alive until the task is done.
+    if (postTask) {
+        Ref<Queue> self = this;
+        GetDevice()->GetAsyncTaskManager()->PostTask(
+            [self = std::move(self)] { self->ProcessAsyncSubmits(); });
+    }
+}
+
+void Queue::ProcessAsyncSubmits() {
+    std::unique_lock<std::mutex> lock(mAsyncSubmitMutex);
+    DAWN_ASSERT(mAsyncSubmitTaskRunning);
+    while (!mPendingAsyncSubmits.empty()) {
+        PendingSubmit submit = std::move(mPendingAsyncSubmits.front());
+        mPendingAsyncSubmits.pop_front();
+
+        if (!mAsyncSubmitError.has_value()) {
+            // Don't hold the lock during vkQueueSubmit so the frontend can keep enqueuing submits.
+            lock.unlock();
+            TRACE_EVENT0(GetDevice()->GetPlatform(), Recording, "vkQueueSubmit");
+            ::VkResult result = SubmitToVkQueue(submit, VK_NULL_HANDLE);
+            lock.lock();
+
+            if (result == VK_SUCCESS) {
+                mLastSignaledSerial = submit.serial;
+            } else {
+                mAsyncSubmitError = result;
+            }
+        }
+
+        mLastAsyncProcessedSerial = submit.serial;
+        mAsyncSubmitCondition.notify_all();
+    }
+    mAsyncSubmitTaskRunning = false;
+    mAsyncSubmitCondition.notify_all();
+}
+
+void Queue::DrainAsyncSubmits(ExecutionSerial serial) {
+    if (!mUseAsyncSubmission) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mAsyncSubmitMutex);
+    mAsyncSubmitCondition.wait(lock, [&] {
+        return mLastAsyncProcessedSerial >= serial || !mAsyncSubmitTaskRunning;
+    });
+}
+
+MaybeError Queue::WaitForAsyncSubmits(ExecutionSerial serial) {
+    DrainAsyncSubmits(serial);
+    return CheckAsyncSubmitError();
+}
+
+MaybeError Queue::CheckAsyncSubmitError() {
+    if (!mUseAsyncSubmission) {
+        return {};
+    }
+
+    std::optional<::VkResult> error;
+    {
+        std::lock_guard<std::mutex> lock(mAsyncSubmitMutex);
+        error = mAsyncSubmitError;
+    }
+    if (error.has_value()) {
+        // The submit task drops the remaining submits after an error so this doesn't wait long.
+        // Once the error is reported the device is lost, and the objects of the dropped submits
+        // assumed unused.
+        DrainAsyncSubmits(kMaxExecutionSerial);
+        DAWN_TRY(CheckVkSuccess(*error, "vkQueueSubmit"));
+    }
+    return {};
+}
+
 ResultOrError<VkFence> Queue::GetUnusedFence() {
     Device* device = ToBackend(GetDevice());
     VkDevice vkDevice = device->GetVkDevice();
@@ -473,6 +760,10 @@ ResultOrError<VkFence> Queue::GetUnusedFence() {
 }
 
 void Queue::DestroyImpl() {
+    // Wait for the asynchronous submits to be done with the command buffers and semaphores before
+    // destroying them.
+    DrainAsyncSubmits(kMaxExecutionSerial);
+
     Device* device = ToBackend(GetDevice());
     VkDevice vkDevice = device->GetVkDevice();
 
@@ -482,6 +773,10 @@ void Queue::DestroyImpl() {
         DestroyCommandPoolAndBuffer(
             device->fn, vkDevice, {mRecordingContext.commandPool, mRecordingContext.commandBuffer});
     }
+    for (const SecondaryCommandPool& pool : mRecordingContext.secondaryCommandPools) {
+        DestroySecondaryCommandPool(device->fn, vkDevice, pool);
+    }
+    mRecordingContext.secondaryCommandPools.clear();
 
     for (VkSemaphore semaphore : mRecordingContext.waitSemaphores) {
         device->fn.DestroySemaphore(vkDevice, semaphore, nullptr);
@@ -499,6 +794,12 @@ void Queue::DestroyImpl() {
     }
     mUnusedCommands.clear();
 
+    DAWN_ASSERT(mSecondaryCommandPoolsInFlight.Empty());
+    for (const SecondaryCommandPool& pool : mUnusedSecondaryCommandPools) {
+        DestroySecondaryCommandPool(device->fn, vkDevice, pool);
+    }
+    mUnusedSecondaryCommandPools.clear();
+
     // Some fences might still be marked as in-flight if we shut down because of a device loss.
     // Delete them since at this point all commands are complete.
     mFencesInFlight.Use([&](auto fencesInFlight) {
@@ -515,6 +816,11 @@ void Queue::DestroyImpl() {
         unusedFences->clear();
     });
 
+    if (mTimelineSemaphore != VK_NULL_HANDLE) {
+        device->fn.DestroySemaphore(vkDevice, mTimelineSemaphore, nullptr);
+        mTimelineSemaphore = VK_NULL_HANDLE;
+    }
+
     QueueBase::DestroyImpl();
 }
 
@@ -528,7 +834,30 @@ ResultOrError<bool> Queue::WaitForQueueSerial(ExecutionSerial serial, Nanosecond
     // specified).
     // TODO(crbug.com/344798087): Handle the issue of timeouts in a more general way further up the
     // stack.
+    if (UsesTimelineSemaphore() && serial <= GetCompletedCommandSerial()) {
+        return true;
+    }
+    // Host waits on the timeline semaphore work for serials that aren't submitted yet, but wait
+    // for their asynchronous submit anyway so that an error doesn't make the wait hang.
+    DAWN_TRY(WaitForAsyncSubmits(serial));
     while (1) {
+        if (UsesTimelineSemaphore()) {
+            // A single wait on the timeline semaphore's counter value, no fence lookup needed.
+            VkResult waitResult = VkResult::WrapUnsafe(INJECT_ERROR_OR_RUN(
+                WaitForTimelineSemaphore(device, mTimelineSemaphore, serial,
+                                         static_cast<uint64_t>(timeout)),
+                VK_ERROR_DEVICE_LOST));
+            if (waitResult == VK_TIMEOUT) {
+                // See the comment on VK_TIMEOUT for fences below.
+                if (static_cast<uint64_t>(timeout) == std::numeric_limits<uint64_t>::max()) {
+                    continue;
+                }
+                return false;
+            }
+            DAWN_TRY(CheckVkSuccess(::VkResult(waitResult), "vkWaitSemaphores"));
+            return true;
+        }
+
         VkResult waitResult = mFencesInFlight.Use([&](auto fencesInFlight) {
             // Search from for the first fence >= serial.
             VkFence waitFence = VK_NULL_HANDLE;
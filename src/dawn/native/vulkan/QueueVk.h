@@ -28,7 +28,10 @@
 #ifndef SRC_DAWN_NATIVE_VULKAN_QUEUEVK_H_
 #define SRC_DAWN_NATIVE_VULKAN_QUEUEVK_H_
 
+#include <condition_variable>
 #include <deque>
+#include <mutex>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -52,12 +55,19 @@ class Queue final : public QueueBase {
 
     CommandRecordingContext* GetPendingRecordingContext(SubmitMode submitMode = SubmitMode::Normal);
     MaybeError SplitRecordingContext(CommandRecordingContext* recordingContext);
+    // Returns a reset command pool to allocate secondary command buffers from. It must be added to
+    // the secondaryCommandPools of the recording context they are executed in.
+    ResultOrError<SecondaryCommandPool> GetUnusedSecondaryCommandPool();
     MaybeError SubmitPendingCommands() override;
 
     void RecycleCompletedCommands(ExecutionSerial completedSerial);
 
     ResultOrError<bool> WaitForQueueSerial(ExecutionSerial serial, Nanoseconds timeout) override;
 
+    // Waits until all the asynchronous submits up to |serial| have been made to the VkQueue. The
+    // VkQueue must not be used directly (e.g. to present) before the asynchronous submits are done.
+    MaybeError WaitForAsyncSubmits(ExecutionSerial serial = kMaxExecutionSerial);
+
   private:
     Queue(Device* device, const QueueDescriptor* descriptor, uint32_t family);
     ~Queue() override;
@@ -76,11 +86,37 @@ class Queue final : public QueueBase {
     void SetLabelImpl() override;
 
     ResultOrError<VkFence> GetUnusedFence();
+    MaybeError CreateTimelineSemaphore();
+    bool UsesTimelineSemaphore() const;
+
+    // The part of a pending submit that is needed to call vkQueueSubmit.
+    struct PendingSubmit {
+        ExecutionSerial serial;
+        std::vector<VkCommandBuffer> commandBuffers;
+        std::vector<VkSemaphore> waitSemaphores;
+        std::vector<VkSemaphore> signalSemaphores;
+    };
+    // Calls vkQueueSubmit for |submit|, also signaling the timeline semaphore with its serial if
+    // there is one.
+    ::VkResult SubmitToVkQueue(const PendingSubmit& submit, VkFence fence);
+
+    void EnqueueAsyncSubmit(PendingSubmit submit);
+    void ProcessAsyncSubmits();
+    void DrainAsyncSubmits(ExecutionSerial serial);
+    MaybeError CheckAsyncSubmitError();
 
     // We track which operations are in flight on the GPU with an increasing serial.
     // This works only because we have a single queue. Each submit to a queue is associated
     // to a serial and a fence, such that when the fence is "ready" we know the operations
     // have finished.
+    // When timeline semaphores are supported, each submit instead signals mTimelineSemaphore with
+    // its serial, so the semaphore's counter value is the last completed serial and no fences
+    // are used.
+    VkSemaphore mTimelineSemaphore = VK_NULL_HANDLE;
+    // The last serial signaled on mTimelineSemaphore. This can lag behind the last submitted
+    // serial after the device is lost and the commands are assumed to be complete.
+    // With asynchronous submits it is written by the submit task, under mAsyncSubmitMutex.
+    ExecutionSerial mLastSignaledSerial = kBeginningOfGPUTime;
     MutexProtected<std::deque<std::pair<VkFence, ExecutionSerial>>> mFencesInFlight;
     // Fences in the unused list aren't reset yet.
     MutexProtected<std::vector<VkFence>> mUnusedFences;
@@ -91,9 +127,26 @@ class Queue final : public QueueBase {
     SerialQueue<ExecutionSerial, CommandPoolAndBuffer> mCommandsInFlight;
     // Command pools in the unused list haven't been reset yet.
     std::vector<CommandPoolAndBuffer> mUnusedCommands;
+    SerialQueue<ExecutionSerial, SecondaryCommandPool> mSecondaryCommandPoolsInFlight;
+    std::vector<SecondaryCommandPool> mUnusedSecondaryCommandPools;
     // There is always a valid recording context stored in mRecordingContext
     CommandRecordingContext mRecordingContext;
 
+    // When Toggle::VulkanAsyncQueueSubmission is enabled, the frontend still does all of the
+    // recording and serial tracking, but hands the vkQueueSubmit calls to a task on the device's
+    // AsyncTaskManager. At most one such task runs at a time and it makes the submits in order,
+    // so it is the only user of mQueue until WaitForAsyncSubmits returns.
+    bool mUseAsyncSubmission = false;
+    std::mutex mAsyncSubmitMutex;
+    std::condition_variable mAsyncSubmitCondition;
+    std::deque<PendingSubmit> mPendingAsyncSubmits;
+    bool mAsyncSubmitTaskRunning = false;
+    // The last serial the submit task is done with, whether vkQueueSubmit succeeded or not.
+    ExecutionSerial mLastAsyncProcessedSerial = kBeginningOfGPUTime;
+    // The first error returned by an asynchronous vkQueueSubmit. Further submits are dropped
+    // since the device is going to be lost when the error is reported.
+    std::optional<::VkResult> mAsyncSubmitError;
+
     uint32_t mQueueFamily = 0;
     VkQueue mQueue = VK_NULL_HANDLE;
 };
@@ -138,24 +138,26 @@ RenderPassCache::RenderPassCache(Device* device) : mDevice(device) {}
 
 RenderPassCache::~RenderPassCache() {
     std::lock_guard<std::mutex> lock(mMutex);
-    for (auto [_, renderPassInfo] : mCache) {
+    mCache.ForEach([&](const RenderPassCacheQuery&, const RenderPassInfo& renderPassInfo) {
         mDevice->fn.DestroyRenderPass(mDevice->GetVkDevice(), renderPassInfo.renderPass, nullptr);
-    }
-
-    mCache.clear();
+    });
 }
 
 ResultOrError<RenderPassCache::RenderPassInfo> RenderPassCache::GetRenderPass(
     const RenderPassCacheQuery& query) {
+    if (const RenderPassInfo* renderPass = mCache.Find(query)) {
+        return RenderPassInfo(*renderPass);
+    }
+
     std::lock_guard<std::mutex> lock(mMutex);
-    auto it = mCache.find(query);
-    if (it != mCache.end()) {
-        return RenderPassInfo(it->second);
+    // Another thread may have created the render pass while this one was waiting for the lock.
+    if (const RenderPassInfo* renderPass = mCache.Find(query)) {
+        return RenderPassInfo(*renderPass);
     }
 
     RenderPassInfo renderPass;
     DAWN_TRY_ASSIGN(renderPass, CreateRenderPassForQuery(query));
-    mCache.emplace(query, renderPass);
+    mCache.Insert(query, renderPass);
     return renderPass;
 }
 
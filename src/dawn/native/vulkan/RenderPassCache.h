@@ -32,8 +32,8 @@
 #include <bitset>
 #include <mutex>
 
-#include "absl/container/flat_hash_map.h"
 #include "dawn/common/Constants.h"
+#include "dawn/common/ReadMostlyHashMap.h"
 #include "dawn/common/ityp_array.h"
 #include "dawn/common/ityp_bitset.h"
 #include "dawn/common/vulkan_platform.h"
@@ -89,7 +89,9 @@ struct RenderPassCacheQuery {
 // render pass. We always arrange the order of attachments in "color-depthstencil-resolve" order
 // when creating render pass and framebuffer so that we can always make sure the order of
 // attachments in the rendering pipeline matches the one of the framebuffer.
-// All the operations on RenderPassCache are guaranteed to be thread-safe.
+// All the operations on RenderPassCache are guaranteed to be thread-safe. Lookups of render passes
+// that are already in the cache don't take a lock, so that beginning render passes on several
+// threads doesn't serialize on the cache.
 // TODO(cwallez@chromium.org): Make it an LRU cache somehow?
 class RenderPassCache {
   public:
@@ -107,16 +109,17 @@ class RenderPassCache {
     // Does the actual VkRenderPass creation on a cache miss.
     ResultOrError<RenderPassInfo> CreateRenderPassForQuery(const RenderPassCacheQuery& query) const;
 
-    // Implements the functors necessary for to use RenderPassCacheQueries as absl::flat_hash_map
+    // Implements the functors necessary for to use RenderPassCacheQueries as ReadMostlyHashMap
     // keys.
     struct CacheFuncs {
         size_t operator()(const RenderPassCacheQuery& query) const;
         bool operator()(const RenderPassCacheQuery& a, const RenderPassCacheQuery& b) const;
     };
-    using Cache = absl::flat_hash_map<RenderPassCacheQuery, RenderPassInfo, CacheFuncs, CacheFuncs>;
+    using Cache = ReadMostlyHashMap<RenderPassCacheQuery, RenderPassInfo, CacheFuncs, CacheFuncs>;
 
     raw_ptr<Device> mDevice = nullptr;
 
+    // Only taken on cache misses, to serialize the creation and insertion of render passes.
     std::mutex mMutex;
     Cache mCache;
 };
@@ -37,6 +37,7 @@
 #include "dawn/native/vulkan/FencedDeleter.h"
 #include "dawn/native/vulkan/PipelineCacheVk.h"
 #include "dawn/native/vulkan/PipelineLayoutVk.h"
+#include "dawn/native/vulkan/PipelineLibraryCache.h"
 #include "dawn/native/vulkan/RenderPassCache.h"
 #include "dawn/native/vulkan/ShaderModuleVk.h"
 #include "dawn/native/vulkan/TextureVk.h"
@@ -320,6 +321,73 @@ VkStencilOp VulkanStencilOp(wgpu::StencilOperation op) {
     DAWN_UNREACHABLE();
 }
 
+// Returns the VkPipeline library for the `part` state subset described by `info`, creating and
+// caching it on the device if needed. `info` must only contain the state of that subset.
+// `objectsKey` is the cache key of the objects referenced by `info` that aren't serialized with it,
+// like the shaders' SPIR-V, the pipeline layout and the render pass.
+ResultOrError<Ref<PipelineLibrary>> GetOrCreatePipelineLibrary(
+    Device* device,
+    VkGraphicsPipelineLibraryFlagsEXT part,
+    VkGraphicsPipelineCreateInfo info,
+    const CacheKey& objectsKey,
+    VkPipelineCache cache) {
+    CacheKey key;
+    StreamIn(&key, part, info, objectsKey);
+
+    PipelineLibraryCache* libraryCache = device->GetPipelineLibraryCache();
+    Ref<PipelineLibrary> cachedLibrary = libraryCache->Find(key);
+    if (cachedLibrary != nullptr) {
+        return cachedLibrary;
+    }
+
+    VkGraphicsPipelineLibraryCreateInfoEXT libraryInfo;
+    libraryInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    libraryInfo.pNext = nullptr;
+    libraryInfo.flags = part;
+
+    // The link-time optimization info is retained so that the pipelines can be optimized in the
+    // background after their fast link.
+    info.pNext = &libraryInfo;
+    info.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                  VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+    VkPipeline library;
+    DAWN_TRY(CheckVkSuccess(
+        device->fn.CreateGraphicsPipelines(device->GetVkDevice(), cache, 1, &info, nullptr,
+                                           &*library),
+        "CreateGraphicsPipelines"));
+    return libraryCache->Insert(key, library);
+}
+
+// Links `libraries` into a complete pipeline. Not passing
+// VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT in `flags` requests a fast link.
+MaybeError LinkPipelineLibraries(Device* device,
+                                 const std::array<Ref<PipelineLibrary>, 4>& libraries,
+                                 VkPipelineLayout layout,
+                                 VkPipelineCache cache,
+                                 VkPipelineCreateFlags flags,
+                                 VkPipeline* pipeline) {
+    std::array<VkPipeline, 4> handles;
+    for (size_t i = 0; i < libraries.size(); ++i) {
+        handles[i] = libraries[i]->GetHandle();
+    }
+
+    VkPipelineLibraryCreateInfoKHR libraryInfo;
+    libraryInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    libraryInfo.pNext = nullptr;
+    libraryInfo.libraryCount = static_cast<uint32_t>(handles.size());
+    libraryInfo.pLibraries = AsVkArray(handles.data());
+
+    VkGraphicsPipelineCreateInfo linkInfo = {};
+    linkInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    linkInfo.pNext = &libraryInfo;
+    linkInfo.flags = flags;
+    linkInfo.layout = layout;
+    linkInfo.basePipelineIndex = -1;
+    return CheckVkSuccess(device->fn.CreateGraphicsPipelines(device->GetVkDevice(), cache, 1,
+                                                             &linkInfo, nullptr, &**pipeline),
+                          "CreateGraphicsPipelines");
+}
+
 }  // anonymous namespace
 
 // static
@@ -339,6 +407,8 @@ MaybeError RenderPipeline::InitializeImpl() {
     // There are at most 2 shader stages in render pipeline, i.e. vertex and fragment
     std::array<VkPipelineShaderStageCreateInfo, 2> shaderStages;
     std::array<std::string, 2> shaderStageEntryPoints;
+    // The SPIR-V of each stage, for the cache keys of the pipeline libraries.
+    std::array<CacheKey, 2> shaderStageCacheKeys;
     uint32_t stageCount = 0;
 
     auto AddShaderStage = [&](SingleShaderStage stage, VkShaderStageFlagBits vkStage,
@@ -352,6 +422,8 @@ MaybeError RenderPipeline::InitializeImpl() {
         mHasInputAttachment = mHasInputAttachment || moduleAndSpirv.hasInputAttachment;
         // Record cache key for each shader since it will become inaccessible later on.
         StreamIn(&mCacheKey, stream::Iterable(moduleAndSpirv.spirv, moduleAndSpirv.wordCount));
+        StreamIn(&shaderStageCacheKeys[stageCount],
+                 stream::Iterable(moduleAndSpirv.spirv, moduleAndSpirv.wordCount));
 
         VkPipelineShaderStageCreateInfo* shaderStage = &shaderStages[stageCount];
         shaderStage->module = moduleAndSpirv.module;
@@ -508,6 +580,7 @@ MaybeError RenderPipeline::InitializeImpl() {
     // irrespective of resolve attachments being used, but for ExpandResolveTexture that uses two
     // subpasses we need to specify which attachments will be resolved.
     RenderPassCache::RenderPassInfo renderPassInfo;
+    CacheKey renderPassCacheKey;
     {
         RenderPassCacheQuery query;
         ColorAttachmentMask resolveMask =
@@ -536,6 +609,7 @@ MaybeError RenderPipeline::InitializeImpl() {
         query.SetSampleCount(GetSampleCount());
 
         StreamIn(&mCacheKey, query);
+        StreamIn(&renderPassCacheKey, query);
         DAWN_TRY_ASSIGN(renderPassInfo, device->GetRenderPassCache()->GetRenderPass(query));
     }
 
@@ -579,18 +653,22 @@ MaybeError RenderPipeline::InitializeImpl() {
     // Try to see if we have anything in the blob cache.
     platform::metrics::DawnHistogramTimer cacheTimer(GetDevice()->GetPlatform());
     Ref<PipelineCache> cache = ToBackend(GetDevice()->GetOrCreatePipelineCache(GetCacheKey()));
-    if (cache->CacheHit()) {
-        DAWN_TRY(CheckVkSuccess(
+    auto CreateHandle = [&]() -> MaybeError {
+        if (device->IsToggleEnabled(Toggle::VulkanUseGraphicsPipelineLibrary)) {
+            return InitializeHandleFromLibraries(createInfo, shaderStageCacheKeys,
+                                                 renderPassCacheKey, cache);
+        }
+        return CheckVkSuccess(
             device->fn.CreateGraphicsPipelines(device->GetVkDevice(), cache->GetHandle(), 1,
                                                &createInfo, nullptr, &*mHandle),
-            "CreateGraphicsPipelines"));
+            "CreateGraphicsPipelines");
+    };
+    if (cache->CacheHit()) {
+        DAWN_TRY(CreateHandle());
         cacheTimer.RecordMicroseconds("Vulkan.CreateGraphicsPipelines.CacheHit");
     } else {
         cacheTimer.Reset();
-        DAWN_TRY(CheckVkSuccess(
-            device->fn.CreateGraphicsPipelines(device->GetVkDevice(), cache->GetHandle(), 1,
-                                               &createInfo, nullptr, &*mHandle),
-            "CreateGraphicsPipelines"));
+        DAWN_TRY(CreateHandle());
         cacheTimer.RecordMicroseconds("Vulkan.CreateGraphicsPipelines.CacheMiss");
     }
 
@@ -602,6 +680,163 @@ MaybeError RenderPipeline::InitializeImpl() {
     return {};
 }
 
+MaybeError RenderPipeline::InitializeHandleFromLibraries(
+    const VkGraphicsPipelineCreateInfo& createInfo,
+    const std::array<CacheKey, 2>& shaderStageCacheKeys,
+    const CacheKey& renderPassCacheKey,
+    Ref<PipelineCache> cache) {
+    Device* device = ToBackend(GetDevice());
+    const CacheKey& layoutCacheKey = ToBackend(GetLayout())->GetCacheKey();
+
+    // Each library is only given the state of its own subset so that its cache key doesn't depend
+    // on the state of the other subsets. The dynamic state is shared, state that isn't part of a
+    // subset is ignored when creating its library.
+    VkGraphicsPipelineCreateInfo emptyInfo = createInfo;
+    emptyInfo.stageCount = 0;
+    emptyInfo.pStages = nullptr;
+    emptyInfo.pVertexInputState = nullptr;
+    emptyInfo.pInputAssemblyState = nullptr;
+    emptyInfo.pTessellationState = nullptr;
+    emptyInfo.pViewportState = nullptr;
+    emptyInfo.pRasterizationState = nullptr;
+    emptyInfo.pMultisampleState = nullptr;
+    emptyInfo.pDepthStencilState = nullptr;
+    emptyInfo.pColorBlendState = nullptr;
+    emptyInfo.layout = VkPipelineLayout{};
+    emptyInfo.renderPass = VkRenderPass{};
+    emptyInfo.subpass = 0;
+
+    std::array<Ref<PipelineLibrary>, 4> libraries;
+
+    // The vertex input interface only depends on the vertex buffer layouts and the topology, which
+    // are the parts of the RenderPipelineDescriptor that vary the most between pipelines.
+    {
+        VkGraphicsPipelineCreateInfo info = emptyInfo;
+        info.pVertexInputState = createInfo.pVertexInputState;
+        info.pInputAssemblyState = createInfo.pInputAssemblyState;
+        DAWN_TRY_ASSIGN(libraries[0],
+                        GetOrCreatePipelineLibrary(
+                            device, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+                            info, CacheKey{}, cache->GetHandle()));
+    }
+
+    // The pre-rasterization shaders subset contains the vertex shader, which is always the first
+    // stage.
+    {
+        VkGraphicsPipelineCreateInfo info = emptyInfo;
+        info.stageCount = 1;
+        info.pStages = createInfo.pStages;
+        info.pViewportState = createInfo.pViewportState;
+        info.pRasterizationState = createInfo.pRasterizationState;
+        info.layout = createInfo.layout;
+        info.renderPass = createInfo.renderPass;
+        info.subpass = createInfo.subpass;
+
+        CacheKey objectsKey;
+        StreamIn(&objectsKey, shaderStageCacheKeys[0], layoutCacheKey, renderPassCacheKey);
+        DAWN_TRY_ASSIGN(libraries[1],
+                        GetOrCreatePipelineLibrary(
+                            device, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+                            info, objectsKey, cache->GetHandle()));
+    }
+
+    // The fragment shader subset also contains the depth-stencil state. It may have no shader for
+    // vertex-only pipelines.
+    {
+        VkGraphicsPipelineCreateInfo info = emptyInfo;
+        info.stageCount = createInfo.stageCount - 1;
+        info.pStages = info.stageCount > 0 ? &createInfo.pStages[1] : nullptr;
+        info.pMultisampleState = createInfo.pMultisampleState;
+        info.pDepthStencilState = createInfo.pDepthStencilState;
+        info.layout = createInfo.layout;
+        info.renderPass = createInfo.renderPass;
+        info.subpass = createInfo.subpass;
+
+        CacheKey objectsKey;
+        if (info.stageCount > 0) {
+            StreamIn(&objectsKey, shaderStageCacheKeys[1]);
+        }
+        StreamIn(&objectsKey, layoutCacheKey, renderPassCacheKey);
+        DAWN_TRY_ASSIGN(libraries[2],
+                        GetOrCreatePipelineLibrary(
+                            device, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, info,
+                            objectsKey, cache->GetHandle()));
+    }
+
+    // The fragment output interface is the blending and multisampling into the attachments.
+    {
+        VkGraphicsPipelineCreateInfo info = emptyInfo;
+        info.pMultisampleState = createInfo.pMultisampleState;
+        info.pColorBlendState = createInfo.pColorBlendState;
+        info.renderPass = createInfo.renderPass;
+        info.subpass = createInfo.subpass;
+
+        CacheKey objectsKey;
+        StreamIn(&objectsKey, renderPassCacheKey);
+        DAWN_TRY_ASSIGN(libraries[3],
+                        GetOrCreatePipelineLibrary(
+                            device, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+                            info, objectsKey, cache->GetHandle()));
+    }
+
+    DAWN_TRY(LinkPipelineLibraries(device, libraries, createInfo.layout, cache->GetHandle(), 0,
+                                   &mHandle));
+
+    // The fast-linked pipeline can be noticeably slower to execute than a monolithic one, so a
+    // link-time optimized pipeline is created in the background and replaces it on a later Tick.
+    // The task keeps references to the libraries in case they get evicted from the cache.
+    device->GetAsyncTaskManager()->PostTask(
+        [pipeline = Ref<RenderPipeline>(this), libraries = std::move(libraries),
+         layout = createInfo.layout, cache = std::move(cache)]() mutable {
+            LinkTimeOptimize(std::move(pipeline), std::move(libraries), layout, std::move(cache));
+        });
+    return {};
+}
+
+// static
+void RenderPipeline::LinkTimeOptimize(Ref<RenderPipeline> pipeline,
+                                      std::array<Ref<PipelineLibrary>, 4> libraries,
+                                      VkPipelineLayout layout,
+                                      Ref<PipelineCache> cache) {
+    Device* device = ToBackend(pipeline->GetDevice());
+
+    // The fast-linked handle stays in use if the optimized one can't be created.
+    VkPipeline optimizedHandle;
+    MaybeError maybeError =
+        LinkPipelineLibraries(device, libraries, layout, cache->GetHandle(),
+                              VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT, &optimizedHandle);
+    if (maybeError.IsError()) {
+        IgnoreErrors(std::move(maybeError));
+        return;
+    }
+    IgnoreErrors(cache->Flush());
+
+    {
+        std::lock_guard<std::mutex> lock(pipeline->mOptimizedHandleMutex);
+        pipeline->mOptimizedHandle = optimizedHandle;
+    }
+    device->GetPipelineLibraryCache()->AddOptimizedPipeline(std::move(pipeline));
+}
+
+void RenderPipeline::SwapInOptimizedHandle() {
+    std::lock_guard<std::mutex> lock(mOptimizedHandleMutex);
+    if (mOptimizedHandle == VK_NULL_HANDLE) {
+        return;
+    }
+    // The pipeline may have been destroyed while its optimized handle was being created.
+    if (mHandle == VK_NULL_HANDLE) {
+        ToBackend(GetDevice())->GetFencedDeleter()->DeleteWhenUnused(mOptimizedHandle);
+        mOptimizedHandle = VK_NULL_HANDLE;
+        return;
+    }
+
+    // Command buffers that were already submitted may still use the fast-linked handle.
+    ToBackend(GetDevice())->GetFencedDeleter()->DeleteWhenUnused(mHandle);
+    mHandle = mOptimizedHandle;
+    mOptimizedHandle = VK_NULL_HANDLE;
+    SetLabelImpl();
+}
+
 void RenderPipeline::SetLabelImpl() {
     SetDebugName(ToBackend(GetDevice()), mHandle, "Dawn_RenderPipeline", GetLabel());
 }
@@ -703,6 +938,12 @@ void RenderPipeline::DestroyImpl() {
         ToBackend(GetDevice())->GetFencedDeleter()->DeleteWhenUnused(mHandle);
         mHandle = VK_NULL_HANDLE;
     }
+
+    std::lock_guard<std::mutex> lock(mOptimizedHandleMutex);
+    if (mOptimizedHandle != VK_NULL_HANDLE) {
+        ToBackend(GetDevice())->GetFencedDeleter()->DeleteWhenUnused(mOptimizedHandle);
+        mOptimizedHandle = VK_NULL_HANDLE;
+    }
 }
 
 VkPipeline RenderPipeline::GetHandle() const {
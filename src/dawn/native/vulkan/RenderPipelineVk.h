@@ -30,13 +30,20 @@
 
 #include "dawn/native/RenderPipeline.h"
 
+#include <array>
+#include <mutex>
+
+#include "dawn/common/Ref.h"
 #include "dawn/common/vulkan_platform.h"
+#include "dawn/native/CacheKey.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/vulkan/PipelineVk.h"
 
 namespace dawn::native::vulkan {
 
 class Device;
+class PipelineCache;
+class PipelineLibrary;
 struct VkPipelineLayoutObject;
 
 class RenderPipeline final : public RenderPipelineBase, public PipelineVk {
@@ -47,6 +54,10 @@ class RenderPipeline final : public RenderPipelineBase, public PipelineVk {
 
     VkPipeline GetHandle() const;
 
+    // Replaces the fast-linked handle with the link-time optimized one once it is ready. Must be
+    // called while no commands are being recorded.
+    void SwapInOptimizedHandle();
+
     MaybeError InitializeImpl() override;
 
     // Dawn API
@@ -65,8 +76,24 @@ class RenderPipeline final : public RenderPipelineBase, public PipelineVk {
         PipelineVertexInputStateCreateInfoTemporaryAllocations* temporaryAllocations);
     VkPipelineDepthStencilStateCreateInfo ComputeDepthStencilDesc();
 
+    // Creates mHandle by fast linking one VkPipeline library per state subset of `createInfo`,
+    // reusing the libraries from the device's PipelineLibraryCache when possible, and starts the
+    // link-time optimization of the pipeline in the background.
+    MaybeError InitializeHandleFromLibraries(const VkGraphicsPipelineCreateInfo& createInfo,
+                                             const std::array<CacheKey, 2>& shaderStageCacheKeys,
+                                             const CacheKey& renderPassCacheKey,
+                                             Ref<PipelineCache> cache);
+    // Runs in a background task to create the link-time optimized version of the pipeline.
+    static void LinkTimeOptimize(Ref<RenderPipeline> pipeline,
+                                 std::array<Ref<PipelineLibrary>, 4> libraries,
+                                 VkPipelineLayout layout,
+                                 Ref<PipelineCache> cache);
+
     VkPipeline mHandle = VK_NULL_HANDLE;
 
+    std::mutex mOptimizedHandleMutex;
+    VkPipeline mOptimizedHandle = VK_NULL_HANDLE;
+
     // Whether the pipeline has any input attachment being used in the frag shader.
     bool mHasInputAttachment = false;
 };
@@ -32,8 +32,10 @@
 
 #include "dawn/common/Math.h"
 #include "dawn/native/BuddyMemoryAllocator.h"
+#include "dawn/native/MetricsCollector.h"
 #include "dawn/native/Queue.h"
 #include "dawn/native/ResourceHeapAllocator.h"
+#include "dawn/native/SlabMemoryAllocator.h"
 #include "dawn/native/vulkan/DeviceVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
 #include "dawn/native/vulkan/ResourceHeapVk.h"
@@ -53,6 +55,10 @@ constexpr uint64_t kMaxSizeForSubAllocation = 4ull * 1024ull * 1024ull;  // 4MiB
 // size
 constexpr uint64_t kBuddyHeapsSize = 2 * kMaxSizeForSubAllocation;
 
+// Small buffers like uniform buffers are rounded up to a slab size class instead of a power of
+// two. Larger allocations waste less in relative terms with the buddy system.
+constexpr uint64_t kMaxSizeForSlabAllocation = 64ull * 1024ull;  // 64KiB
+
 bool IsMemoryKindMappable(MemoryKind memoryKind) {
     switch (memoryKind) {
         case MemoryKind::LinearReadMappable:
@@ -72,11 +78,15 @@ bool IsMemoryKindMappable(MemoryKind memoryKind) {
 }  // anonymous namespace
 
 // SingleTypeAllocator is a combination of a BuddyMemoryAllocator and its client and can
-// service suballocation requests, but for a single Vulkan memory type.
+// service suballocation requests, but for a single Vulkan memory type. Small linear resources are
+// served by a SlabMemoryAllocator whose slabs are suballocated from the buddy system.
 
 class ResourceMemoryAllocator::SingleTypeAllocator : public ResourceHeapAllocator {
   public:
-    SingleTypeAllocator(Device* device, size_t memoryTypeIndex, VkDeviceSize memoryHeapSize)
+    SingleTypeAllocator(Device* device,
+                        size_t memoryTypeIndex,
+                        VkDeviceSize memoryHeapSize,
+                        uint64_t slabAlignment)
         : mDevice(device),
           mMemoryTypeIndex(memoryTypeIndex),
           mMemoryHeapSize(memoryHeapSize),
@@ -87,21 +97,34 @@ class ResourceMemoryAllocator::SingleTypeAllocator : public ResourceHeapAllocato
               uint64_t(1) << Log2(mMemoryHeapSize),
               // Take the min in the very unlikely case the memory heap is tiny.
               std::min(uint64_t(1) << Log2(mMemoryHeapSize), kBuddyHeapsSize),
-              &mPooledMemoryAllocator) {
+              &mPooledMemoryAllocator),
+          mSlabAllocator(&mBuddySystem, kMaxSizeForSlabAllocation, slabAlignment) {
         DAWN_ASSERT(IsPowerOfTwo(kBuddyHeapsSize));
     }
     ~SingleTypeAllocator() override = default;
 
-    void DestroyPool() { mPooledMemoryAllocator.DestroyPool(); }
+    void DestroyPool() {
+        mSlabAllocator.ReleaseEmptySlabs();
+        mPooledMemoryAllocator.DestroyPool();
+    }
 
     ResultOrError<ResourceMemoryAllocation> AllocateMemory(uint64_t size, uint64_t alignment) {
         return mBuddySystem.Allocate(size, alignment);
     }
 
+    ResultOrError<ResourceMemoryAllocation> AllocateSlabMemory(uint64_t size, uint64_t alignment) {
+        return mSlabAllocator.Allocate(size, alignment);
+    }
+
     void DeallocateMemory(const ResourceMemoryAllocation& allocation) {
-        mBuddySystem.Deallocate(allocation);
+        if (!mSlabAllocator.Deallocate(allocation)) {
+            mBuddySystem.Deallocate(allocation);
+        }
     }
 
+    const BuddyMemoryAllocator& GetBuddySystem() const { return mBuddySystem; }
+    const SlabMemoryAllocator& GetSlabAllocator() const { return mSlabAllocator; }
+
     // Implementation of the MemoryAllocator interface to be a client of BuddyMemoryAllocator
 
     ResultOrError<std::unique_ptr<ResourceHeapBase>> AllocateResourceHeap(uint64_t size) override {
@@ -137,17 +160,24 @@ class ResourceMemoryAllocator::SingleTypeAllocator : public ResourceHeapAllocato
     VkDeviceSize mMemoryHeapSize;
     PooledResourceMemoryAllocator mPooledMemoryAllocator;
     BuddyMemoryAllocator mBuddySystem;
+    SlabMemoryAllocator mSlabAllocator;
 };
 
 // Implementation of ResourceMemoryAllocator
 
-ResourceMemoryAllocator::ResourceMemoryAllocator(Device* device) : mDevice(device) {
+ResourceMemoryAllocator::ResourceMemoryAllocator(Device* device)
+    : mDevice(device),
+      mUseSlabSuballocation(device->IsToggleEnabled(Toggle::VulkanUseSlabSuballocation)) {
     const VulkanDeviceInfo& info = mDevice->GetDeviceInfo();
     mAllocatorsPerType.reserve(info.memoryTypes.size());
 
+    // Slabs only contain linear resources, so only the slabs themselves need to be aligned to
+    // bufferImageGranularity to not share a page with opaque resources.
+    uint64_t slabAlignment = info.properties.limits.bufferImageGranularity;
+
     for (size_t i = 0; i < info.memoryTypes.size(); i++) {
         mAllocatorsPerType.emplace_back(std::make_unique<SingleTypeAllocator>(
-            mDevice, i, info.memoryHeaps[info.memoryTypes[i].heapIndex].size));
+            mDevice, i, info.memoryHeaps[info.memoryTypes[i].heapIndex].size, slabAlignment));
     }
 }
 
@@ -169,20 +199,8 @@ ResultOrError<ResourceMemoryAllocation> ResourceMemoryAllocator::Allocate(
     if (!forceDisableSubAllocation && requirements.size < kMaxSizeForSubAllocation &&
         !IsMemoryKindMappable(kind) &&
         !mDevice->IsToggleEnabled(Toggle::DisableResourceSuballocation)) {
-        // When sub-allocating, Vulkan requires that we respect bufferImageGranularity. Some
-        // hardware puts information on the memory's page table entry and allocating a linear
-        // resource in the same page as a non-linear (aka opaque) resource can cause issues.
-        // Probably because some texture compression flags are stored on the page table entry,
-        // and allocating a linear resource removes these flags.
-        //
-        // Anyway, just to be safe we ask that all sub-allocated resources are allocated with at
-        // least this alignment. TODO(crbug.com/dawn/849): this is suboptimal because multiple
-        // linear (resp. opaque) resources can coexist in the same page. In particular Nvidia
-        // GPUs often use a granularity of 64k which will lead to a lot of wasted spec. Revisit
-        // with a more efficient algorithm later.
         const VulkanDeviceInfo& info = mDevice->GetDeviceInfo();
-        uint64_t alignment =
-            std::max(requirements.alignment, info.properties.limits.bufferImageGranularity);
+        uint64_t alignment = requirements.alignment;
 
         if ((info.memoryTypes[memoryType].propertyFlags &
              (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) ==
@@ -193,9 +211,30 @@ ResultOrError<ResourceMemoryAllocation> ResourceMemoryAllocator::Allocate(
         }
 
         ResourceMemoryAllocation subAllocation;
-        DAWN_TRY_ASSIGN(subAllocation, mAllocatorsPerType[memoryType]->AllocateMemory(
-                                           requirements.size, alignment));
+        if (kind == MemoryKind::Linear && mUseSlabSuballocation) {
+            // Slabs are already aligned to bufferImageGranularity.
+            DAWN_TRY_ASSIGN(subAllocation, mAllocatorsPerType[memoryType]->AllocateSlabMemory(
+                                               requirements.size, alignment));
+        }
+        if (subAllocation.GetInfo().mMethod == AllocationMethod::kInvalid) {
+            // When sub-allocating, Vulkan requires that we respect bufferImageGranularity. Some
+            // hardware puts information on the memory's page table entry and allocating a linear
+            // resource in the same page as a non-linear (aka opaque) resource can cause issues.
+            // Probably because some texture compression flags are stored on the page table
+            // entry, and allocating a linear resource removes these flags.
+            //
+            // The buddy allocator mixes linear and opaque resources, so just to be safe we ask
+            // that all of its allocations have at least this alignment.
+            // TODO(crbug.com/dawn/849): this is suboptimal because multiple linear (resp. opaque)
+            // resources can coexist in the same page. In particular Nvidia GPUs often use a
+            // granularity of 64k which will lead to a lot of wasted spec. Revisit with a more
+            // efficient algorithm later.
+            alignment = std::max(alignment, info.properties.limits.bufferImageGranularity);
+            DAWN_TRY_ASSIGN(subAllocation, mAllocatorsPerType[memoryType]->AllocateMemory(
+                                               requirements.size, alignment));
+        }
         if (subAllocation.GetInfo().mMethod != AllocationMethod::kInvalid) {
+            mSuballocationMetricsDirty = true;
             return std::move(subAllocation);
         }
     }
@@ -263,9 +302,29 @@ void ResourceMemoryAllocator::Tick(ExecutionSerial completedSerial) {
         size_t memoryType = ToBackend(allocation.GetResourceHeap())->GetMemoryType();
 
         mAllocatorsPerType[memoryType]->DeallocateMemory(allocation);
+        mSuballocationMetricsDirty = true;
     }
 
     mSubAllocationsToDelete.ClearUpTo(completedSerial);
+
+    // Walking all the allocators is too costly to do on every allocation, so the metrics are only
+    // sampled once per tick, and only if a suballocation changed since the last sample.
+    if (mSuballocationMetricsDirty) {
+        RecordSuballocationMetrics();
+        mSuballocationMetricsDirty = false;
+    }
+}
+
+void ResourceMemoryAllocator::RecordSuballocationMetrics() {
+    uint64_t heapBytes = 0;
+    uint64_t slabBytes = 0;
+    uint64_t slabBytesInUse = 0;
+    for (const auto& allocator : mAllocatorsPerType) {
+        heapBytes += allocator->GetBuddySystem().GetAllocatedHeapBytes();
+        slabBytes += allocator->GetSlabAllocator().GetSlabBytes();
+        slabBytesInUse += allocator->GetSlabAllocator().GetSlabBytesInUse();
+    }
+    mDevice->GetMetrics()->RecordSuballocationMemory(heapBytes, slabBytes, slabBytesInUse);
 }
 
 int ResourceMemoryAllocator::FindBestTypeIndex(VkMemoryRequirements requirements, MemoryKind kind) {
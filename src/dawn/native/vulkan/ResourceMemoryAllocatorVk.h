@@ -70,7 +70,11 @@ class ResourceMemoryAllocator {
     int FindBestTypeIndex(VkMemoryRequirements requirements, MemoryKind kind);
 
   private:
+    void RecordSuballocationMetrics();
+
     raw_ptr<Device> mDevice;
+    bool mUseSlabSuballocation;
+    bool mSuballocationMetricsDirty = false;
 
     class SingleTypeAllocator;
     std::vector<std::unique_ptr<SingleTypeAllocator>> mAllocatorsPerType;
@@ -200,8 +200,10 @@ ShaderModule::~ShaderModule() = default;
 #define SPIRV_COMPILATION_REQUEST_MEMBERS(X)                                                     \
     X(SingleShaderStage, stage)                                                                  \
     X(const tint::Program*, inputProgram)                                                        \
+    X(CacheKey::UnsafeUnkeyedValue<TintProgram*>, tintProgram)                                   \
     X(std::optional<tint::ast::transform::SubstituteOverride::Config>, substituteOverrideConfig) \
     X(LimitsForCompilationRequest, limits)                                                       \
+    X(bool, workgroupSizeValidatedFromReflection)                                                \
     X(std::string_view, entryPointName)                                                          \
     X(bool, disableSymbolRenaming)                                                               \
     X(tint::spirv::writer::Options, tintOptions)                                                 \
@@ -338,12 +340,15 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
         substituteOverrideConfig = BuildSubstituteOverridesTransformConfig(programmableStage);
     }
 
+    const bool disableSymbolRenaming = GetDevice()->IsToggleEnabled(Toggle::DisableSymbolRenaming);
+    auto tintProgram = GetTintProgram();
+
     SpirvCompilationRequest req = {};
     req.stage = stage;
-    auto tintProgram = GetTintProgram();
     req.inputProgram = &(tintProgram->program);
+    req.tintProgram = UnsafeUnkeyedValue(tintProgram.Get());
     req.entryPointName = programmableStage.entryPoint;
-    req.disableSymbolRenaming = GetDevice()->IsToggleEnabled(Toggle::DisableSymbolRenaming);
+    req.disableSymbolRenaming = disableSymbolRenaming;
     req.platform = UnsafeUnkeyedValue(GetDevice()->GetPlatform());
     req.substituteOverrideConfig = std::move(substituteOverrideConfig);
     req.maxSubgroupSizeForFullSubgroups = maxSubgroupSizeForFullSubgroups;
@@ -386,71 +391,93 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
     const CombinedLimits& limits = GetDevice()->GetLimits();
     req.limits = LimitsForCompilationRequest::Create(limits.v1);
 
+    // Entry points whose workgroup size doesn't depend on overrides are validated from the
+    // reflection, so the compilation doesn't need to inspect the program.
+    if (stage == SingleShaderStage::Compute && programmableStage.metadata->workgroupSize) {
+        Extent3D _;
+        DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(
+                               *programmableStage.metadata, req.limits,
+                               maxSubgroupSizeForFullSubgroups));
+        req.workgroupSizeValidatedFromReflection = true;
+    }
+
     CacheResult<CompiledSpirv> compilation;
     DAWN_TRY_LOAD_OR_RUN(
         compilation, GetDevice(), std::move(req), CompiledSpirv::FromBlob,
         [](SpirvCompilationRequest r) -> ResultOrError<CompiledSpirv> {
-            tint::ast::transform::Manager transformManager;
-            tint::ast::transform::DataMap transformInputs;
-
-            // Many Vulkan drivers can't handle multi-entrypoint shader modules.
-            // Run before the renamer so that the entry point name matches `entryPointName` still.
-            transformManager.append(std::make_unique<tint::ast::transform::SingleEntryPoint>());
-            transformInputs.Add<tint::ast::transform::SingleEntryPoint::Config>(
-                std::string(r.entryPointName));
-
-            // Needs to run before all other transforms so that they can use builtin names safely.
-            if (!r.disableSymbolRenaming) {
-                transformManager.Add<tint::ast::transform::Renamer>();
+            // Overrides only exist in the AST and can't be converted to IR, so modules declaring
+            // any are reduced to the entry point and renamed once per entry point on the AST,
+            // which also removes the overrides the entry point doesn't use. Every pipeline then
+            // only specializes the overrides of the resulting program. Other modules are
+            // converted to IR directly and the entry point stripping and renaming run as IR
+            // transforms, which avoids cloning the AST program.
+            TintProgram* tintProgram = r.tintProgram.UnsafeGetValue();
+            const bool reduceToEntryPointInIR = !tintProgram->DeclaresOverrides();
+            const tint::Program* program = r.inputProgram;
+            std::string remappedEntryPoint(r.entryPointName);
+            Ref<SpecializableProgram> specializableProgram;
+            tint::Program specializedProgram;
+            if (!reduceToEntryPointInIR) {
+                DAWN_TRY_ASSIGN(specializableProgram,
+                                tintProgram->GetOrCreateSpecializableProgram(
+                                    std::string(r.entryPointName), r.disableSymbolRenaming));
+                program = &(specializableProgram->program);
+                remappedEntryPoint = specializableProgram->remappedEntryPoint;
             }
-
             if (r.substituteOverrideConfig) {
-                // This needs to run after SingleEntryPoint transform which removes unused overrides
-                // for current entry point.
+                DAWN_ASSERT(!reduceToEntryPointInIR);
+                tint::ast::transform::Manager transformManager;
+                tint::ast::transform::DataMap transformInputs;
                 transformManager.Add<tint::ast::transform::SubstituteOverride>();
                 transformInputs.Add<tint::ast::transform::SubstituteOverride::Config>(
                     std::move(r.substituteOverrideConfig).value());
-            }
 
-            tint::Program program;
-            tint::ast::transform::DataMap transformOutputs;
-            {
                 TRACE_EVENT0(r.platform.UnsafeGetValue(), General, "RunTransforms");
-                DAWN_TRY_ASSIGN(program,
-                                RunTransforms(&transformManager, r.inputProgram, transformInputs,
-                                              &transformOutputs, nullptr));
-            }
-
-            // Get the entry point name after the renamer pass.
-            // TODO(dawn:2180): refactor out.
-            std::string remappedEntryPoint;
-            if (r.disableSymbolRenaming) {
-                remappedEntryPoint = r.entryPointName;
-            } else {
-                auto* data = transformOutputs.Get<tint::ast::transform::Renamer::Data>();
-                DAWN_ASSERT(data != nullptr);
-
-                auto it = data->remappings.find(r.entryPointName.data());
-                DAWN_ASSERT(it != data->remappings.end());
-                remappedEntryPoint = it->second;
+                DAWN_TRY_ASSIGN(specializedProgram,
+                                RunTransforms(&transformManager, &(specializableProgram->program),
+                                              transformInputs, nullptr, nullptr));
+                program = &specializedProgram;
             }
-            DAWN_ASSERT(remappedEntryPoint != "");
 
-            // Validate workgroup size after program runs transforms.
-            if (r.stage == SingleShaderStage::Compute) {
+            // Validate workgroup size after program runs transforms. The entry point is not
+            // renamed yet when the reduction happens on the IR, so `remappedEntryPoint` still
+            // names it in `program`.
+            if (r.stage == SingleShaderStage::Compute && !r.workgroupSizeValidatedFromReflection) {
                 Extent3D _;
                 DAWN_TRY_ASSIGN(_, ValidateComputeStageWorkgroupSize(
-                                       program, remappedEntryPoint.c_str(), r.limits,
+                                       *program, remappedEntryPoint.c_str(), r.limits,
                                        r.maxSubgroupSizeForFullSubgroups));
             }
 
             TRACE_EVENT0(r.platform.UnsafeGetValue(), General, "tint::spirv::writer::Generate()");
+            ScopedTintPassTracer passTracer(r.platform.UnsafeGetValue());
 
             // Convert the AST program to an IR module.
-            auto ir = tint::wgsl::reader::ProgramToLoweredIR(program);
+            auto ir = tint::wgsl::reader::ProgramToLoweredIR(*program);
             DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
                             ir.Failure().reason.Str());
 
+            if (reduceToEntryPointInIR) {
+                // Many drivers can't handle multi-entrypoint shader modules.
+                auto singleEntryPoint =
+                    tint::core::ir::transform::SingleEntryPoint(ir.Get(), remappedEntryPoint);
+                DAWN_INVALID_IF(singleEntryPoint != tint::Success,
+                                "An error occurred while stripping the Tint IR to the entry "
+                                "point\n%s",
+                                singleEntryPoint.Failure().reason.Str());
+
+                if (!r.disableSymbolRenaming) {
+                    auto renamed = tint::core::ir::transform::RenameSymbols(ir.Get());
+                    DAWN_INVALID_IF(renamed != tint::Success,
+                                    "An error occurred while renaming the Tint IR symbols\n%s",
+                                    renamed.Failure().reason.Str());
+
+                    auto it = renamed->find(remappedEntryPoint);
+                    DAWN_ASSERT(it != renamed->end());
+                    remappedEntryPoint = it->second;
+                }
+            }
+
             // Generate SPIR-V from Tint IR.
             auto tintResult = tint::spirv::writer::Generate(ir.Get(), r.tintOptions);
             DAWN_INVALID_IF(tintResult != tint::Success,
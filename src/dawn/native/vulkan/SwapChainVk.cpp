@@ -428,6 +428,9 @@ MaybeError SwapChain::PresentImpl() {
     recordingContext->signalSemaphores.push_back(currentSemaphore);
 
     DAWN_TRY(queue->SubmitPendingCommands());
+    // The semaphore's signal operation must be submitted before the present waits on it, and
+    // presenting uses the VkQueue which the asynchronous submits must be done with.
+    DAWN_TRY(queue->WaitForAsyncSubmits());
 
     VkPresentInfoKHR presentInfo;
     presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
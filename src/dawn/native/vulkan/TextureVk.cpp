@@ -796,8 +796,11 @@ bool IsSampleCountSupported(const dawn::native::vulkan::Device* device,
 Texture::Texture(Device* device, const UnpackedPtr<TextureDescriptor>& descriptor)
     : TextureBase(device, descriptor),
       mCombinedAspect(ComputeCombinedAspect(device, GetFormat())),
+      mIsSingleSubresource(GetArrayLayers() == 1 && GetNumMipLevels() == 1 &&
+                           HasOneBit(GetDisjointVulkanAspects())),
       // A usage of none will make sure the texture is transitioned before its first use as
       // required by the Vulkan spec.
+      mLastSyncInfo{wgpu::TextureUsage::None, wgpu::ShaderStage::None},
       mSubresourceLastSyncInfos(
           mCombinedAspect != Aspect::None ? mCombinedAspect : GetFormat().aspects,
           GetArrayLayers(),
@@ -829,6 +832,33 @@ VkImage Texture::GetHandle() const {
     return mHandle;
 }
 
+bool Texture::HasKnownImageCreateInfo() const {
+    return mHasKnownImageCreateInfo;
+}
+
+VkImageCreateFlags Texture::GetImageCreateFlags() const {
+    DAWN_ASSERT(mHasKnownImageCreateInfo);
+    return mImageCreateFlags;
+}
+
+VkImageUsageFlags Texture::GetImageUsage() const {
+    DAWN_ASSERT(mHasKnownImageCreateInfo);
+    return mImageUsage;
+}
+
+const std::vector<VkFormat>& Texture::GetImageViewFormats() const {
+    DAWN_ASSERT(mHasKnownImageCreateInfo);
+    return mImageViewFormats;
+}
+
+void Texture::SetImageCreateInfo(const VkImageCreateInfo& createInfo,
+                                 std::vector<VkFormat> viewFormats) {
+    mHasKnownImageCreateInfo = true;
+    mImageCreateFlags = createInfo.flags;
+    mImageUsage = createInfo.usage;
+    mImageViewFormats = std::move(viewFormats);
+}
+
 bool Texture::CanReuseWithoutBarrier(wgpu::TextureUsage lastUsage,
                                      wgpu::TextureUsage usage,
                                      wgpu::ShaderStage lastShaderStage,
@@ -907,9 +937,8 @@ void Texture::TransitionUsageForPassImpl(
     wgpu::ShaderStage allNewShaderStages = wgpu::ShaderStage::None;
     wgpu::ShaderStage allLastShaderStages = wgpu::ShaderStage::None;
 
-    mSubresourceLastSyncInfos.Merge(subresourceSyncInfos, [&](const SubresourceRange& range,
-                                                              TextureSyncInfo* lastSyncInfo,
-                                                              const TextureSyncInfo& newSyncInfo) {
+    auto MergeSyncInfo = [&](const SubresourceRange& range, TextureSyncInfo* lastSyncInfo,
+                             const TextureSyncInfo& newSyncInfo) {
         wgpu::TextureUsage newUsage = newSyncInfo.usage;
         if (newSyncInfo.shaderStages == wgpu::ShaderStage::None) {
             // If the image isn't used in any shader stages, ignore shader usages. Eg. ignore a
@@ -942,7 +971,17 @@ void Texture::TransitionUsageForPassImpl(
             lastSyncInfo->shaderStages = newSyncInfo.shaderStages;
         }
         lastSyncInfo->usage = newUsage;
-    });
+    };
+
+    if (mIsSingleSubresource) {
+        // Skip the per-range merging of SubresourceStorage, the only subresource is merged
+        // directly.
+        const Aspect aspect = GetDisjointVulkanAspects();
+        MergeSyncInfo(SubresourceRange::MakeSingle(aspect, 0, 0), &mLastSyncInfo,
+                      subresourceSyncInfos.Get(aspect, 0, 0));
+    } else {
+        mSubresourceLastSyncInfos.Merge(subresourceSyncInfos, MergeSyncInfo);
+    }
 
     TweakTransition(recordingContext, imageBarriers, transitionBarrierStart);
 
@@ -1025,29 +1064,37 @@ void Texture::TransitionUsageAndGetResourceBarrierImpl(
 
     wgpu::TextureUsage allLastUsages = wgpu::TextureUsage::None;
     wgpu::ShaderStage allLastShaderStages = wgpu::ShaderStage::None;
-    mSubresourceLastSyncInfos.Update(
-        range, [&](const SubresourceRange& range, TextureSyncInfo* lastSyncInfo) {
-            if (CanReuseWithoutBarrier(lastSyncInfo->usage, usage, lastSyncInfo->shaderStages,
-                                       shaderStages)) {
-                return;
-            }
+    auto UpdateSyncInfo = [&](const SubresourceRange& range, TextureSyncInfo* lastSyncInfo) {
+        if (CanReuseWithoutBarrier(lastSyncInfo->usage, usage, lastSyncInfo->shaderStages,
+                                   shaderStages)) {
+            return;
+        }
 
-            imageBarriers->push_back(BuildMemoryBarrier(this, lastSyncInfo->usage, usage, range));
+        imageBarriers->push_back(BuildMemoryBarrier(this, lastSyncInfo->usage, usage, range));
 
-            allLastUsages |= lastSyncInfo->usage;
-            allLastShaderStages |= lastSyncInfo->shaderStages;
+        allLastUsages |= lastSyncInfo->usage;
+        allLastShaderStages |= lastSyncInfo->shaderStages;
 
-            if (lastSyncInfo->usage == usage && IsSubset(usage, kReadOnlyTextureUsages)) {
-                // Read only usage and no layout transition. We can keep previous shader stages so
-                // future uses in those stages don't insert barriers.
-                lastSyncInfo->shaderStages |= shaderStages;
-            } else {
-                // Image was altered by write or layout transition. We need to clear previous shader
-                // stages so future uses in those stages will insert barriers.
-                lastSyncInfo->shaderStages = shaderStages;
-            }
-            lastSyncInfo->usage = usage;
-        });
+        if (lastSyncInfo->usage == usage && IsSubset(usage, kReadOnlyTextureUsages)) {
+            // Read only usage and no layout transition. We can keep previous shader stages so
+            // future uses in those stages don't insert barriers.
+            lastSyncInfo->shaderStages |= shaderStages;
+        } else {
+            // Image was altered by write or layout transition. We need to clear previous shader
+            // stages so future uses in those stages will insert barriers.
+            lastSyncInfo->shaderStages = shaderStages;
+        }
+        lastSyncInfo->usage = usage;
+    };
+
+    if (mIsSingleSubresource) {
+        // The range of any transition of a single subresource texture is that subresource.
+        DAWN_ASSERT(range.aspects == GetDisjointVulkanAspects() && range.levelCount == 1 &&
+                    range.layerCount == 1);
+        UpdateSyncInfo(range, &mLastSyncInfo);
+    } else {
+        mSubresourceLastSyncInfos.Update(range, UpdateSyncInfo);
+    }
 
     *srcStages |= VulkanPipelineStage(allLastUsages, allLastShaderStages, format);
     *dstStages |= VulkanPipelineStage(usage, shaderStages, format);
@@ -1246,8 +1293,24 @@ VkImageLayout Texture::GetCurrentLayout(Aspect aspect,
                                         uint32_t arrayLayer,
                                         uint32_t mipLevel) const {
     DAWN_ASSERT(GetFormat().aspects == Aspect::Color);
-    return VulkanImageLayout(GetFormat(),
-                             mSubresourceLastSyncInfos.Get(aspect, arrayLayer, mipLevel).usage);
+    return VulkanImageLayout(GetFormat(), GetLastSyncInfo(aspect, arrayLayer, mipLevel).usage);
+}
+
+TextureSyncInfo Texture::GetLastSyncInfo(Aspect aspect,
+                                         uint32_t arrayLayer,
+                                         uint32_t mipLevel) const {
+    if (mIsSingleSubresource) {
+        return mLastSyncInfo;
+    }
+    return mSubresourceLastSyncInfos.Get(aspect, arrayLayer, mipLevel);
+}
+
+void Texture::FillLastSyncInfos(const TextureSyncInfo& syncInfo) {
+    if (mIsSingleSubresource) {
+        mLastSyncInfo = syncInfo;
+    } else {
+        mSubresourceLastSyncInfos.Fill(syncInfo);
+    }
 }
 
 bool Texture::UseCombinedAspects() const {
@@ -1321,12 +1384,21 @@ MaybeError InternalTexture::Initialize(VkImageUsageFlags extraUsages) {
         createInfo.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
     }
 
+    // Imageless framebuffers need the view format list of their attachments' images, so it is
+    // also added to render attachments even when they only have their own format. Single-format
+    // lists are valid without VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT.
+    bool isRenderAttachment =
+        createInfo.usage &
+        (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+    bool addViewFormatsList =
+        requiresViewFormatsList || (isRenderAttachment && !GetFormat().IsMultiPlanar());
+
     // Add the view format list only when the usage does not have storage. Otherwise, the VVL will
     // say creation of the texture is invalid.
     // See https://github.com/gpuweb/gpuweb/issues/4426.
     VkImageFormatListCreateInfo imageFormatListInfo = {};
     PNextChainBuilder createInfoChain(&createInfo);
-    if (requiresViewFormatsList && device->GetDeviceInfo().HasExt(DeviceExt::ImageFormatList) &&
+    if (addViewFormatsList && device->GetDeviceInfo().HasExt(DeviceExt::ImageFormatList) &&
         !(createInfo.usage & VK_IMAGE_USAGE_STORAGE_BIT)) {
         createInfoChain.Add(&imageFormatListInfo, VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO);
         viewFormats.push_back(VulkanImageFormat(device, GetFormat().format));
@@ -1358,6 +1430,12 @@ MaybeError InternalTexture::Initialize(VkImageUsageFlags extraUsages) {
     DAWN_TRY(CheckVkOOMThenSuccess(
         device->fn.CreateImage(device->GetVkDevice(), &createInfo, nullptr, &*mHandle),
         "CreateImage"));
+    // Only record the view formats that were given to Vulkan. An empty list makes render passes
+    // using this texture fall back to per-pass framebuffers.
+    if (imageFormatListInfo.viewFormatCount == 0) {
+        viewFormats.clear();
+    }
+    SetImageCreateInfo(createInfo, std::move(viewFormats));
 
     // Create the image memory and associate it with the container
     VkMemoryRequirements requirements;
@@ -1444,7 +1522,7 @@ Ref<SwapChainTexture> SwapChainTexture::Create(Device* device,
 
 void SwapChainTexture::Initialize(VkImage nativeImage) {
     mHandle = nativeImage;
-    mSubresourceLastSyncInfos.Fill({kPresentAcquireTextureUsage, wgpu::ShaderStage::None});
+    FillLastSyncInfos({kPresentAcquireTextureUsage, wgpu::ShaderStage::None});
     SetLabelHelper("Dawn_SwapChainTexture");
 }
 
@@ -1470,7 +1548,7 @@ void ImportedTextureBase::TransitionEagerlyForExport(CommandRecordingContext* re
     // Get any usage, ideally the last one to do nothing
     DAWN_ASSERT(GetNumMipLevels() == 1 && GetArrayLayers() == 1);
     const SubresourceRange range = {GetDisjointVulkanAspects(), {0, 1}, {0, 1}};
-    const TextureSyncInfo syncInfo = mSubresourceLastSyncInfos.Get(range.aspects, 0, 0);
+    const TextureSyncInfo syncInfo = GetLastSyncInfo(range.aspects, 0, 0);
 
     std::vector<VkImageMemoryBarrier> barriers;
     VkPipelineStageFlags srcStages = 0;
@@ -1870,6 +1948,7 @@ MaybeError TextureView::Initialize(const UnpackedPtr<TextureViewDescriptor>& des
     usageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO;
     usageInfo.usage = VulkanImageUsage(device, GetInternalUsage(), GetFormat());
     createInfo.pNext = &usageInfo;
+    mHandleUsage = usageInfo.usage;
 
     VkSamplerYcbcrConversionInfo samplerYCbCrInfo = {};
     if (auto* yCbCrVkDescriptor = descriptor.Get<YCbCrVkDescriptor>()) {
@@ -1884,6 +1963,8 @@ MaybeError TextureView::Initialize(const UnpackedPtr<TextureViewDescriptor>& des
         samplerYCbCrInfo.conversion = mSamplerYCbCrConversion;
 
         createInfo.pNext = &samplerYCbCrInfo;
+        // The view inherits the usage of the image, which isn't always known.
+        mHandleUsage = 0;
     }
 
     DAWN_TRY(CheckVkSuccess(
@@ -1941,6 +2022,10 @@ VkImageView TextureView::GetHandleForBGRA8UnormStorage() const {
     return mHandleForBGRA8UnormStorage;
 }
 
+VkImageUsageFlags TextureView::GetHandleUsage() const {
+    return mHandleUsage;
+}
+
 VkImageViewCreateInfo TextureView::GetCreateInfo(wgpu::TextureFormat format,
                                                  wgpu::TextureViewDimension dimension,
                                                  uint32_t depthSlice) const {
@@ -104,12 +104,22 @@ class Texture : public TextureBase {
 
     void SetLabelHelper(const char* prefix);
 
+    // The flags, usage and view formats that the VkImage was created with, which imageless
+    // framebuffers must be created with as well. They are only known for the textures whose
+    // VkImage Dawn creates itself.
+    bool HasKnownImageCreateInfo() const;
+    VkImageCreateFlags GetImageCreateFlags() const;
+    VkImageUsageFlags GetImageUsage() const;
+    const std::vector<VkFormat>& GetImageViewFormats() const;
+
     // Dawn API
     void SetLabelImpl() override;
 
   protected:
     Texture(Device* device, const UnpackedPtr<TextureDescriptor>& descriptor);
 
+    void SetImageCreateInfo(const VkImageCreateInfo& createInfo, std::vector<VkFormat> viewFormats);
+
     void DestroyImpl() override;
     MaybeError ClearTexture(CommandRecordingContext* recordingContext,
                             const SubresourceRange& range,
@@ -156,8 +166,22 @@ class Texture : public TextureBase {
     const Aspect mCombinedAspect;
     bool UseCombinedAspects() const;
 
+    // Most textures have a single mip level, a single array layer and a single aspect to
+    // transition. Their last sync info is stored directly in mLastSyncInfo so that transitions
+    // don't need to go through the range iteration of SubresourceStorage. All other textures
+    // use mSubresourceLastSyncInfos. The accessors below read and write the correct one.
+    const bool mIsSingleSubresource;
+    TextureSyncInfo GetLastSyncInfo(Aspect aspect, uint32_t arrayLayer, uint32_t mipLevel) const;
+    void FillLastSyncInfos(const TextureSyncInfo& syncInfo);
+
+    TextureSyncInfo mLastSyncInfo;
     SubresourceStorage<TextureSyncInfo> mSubresourceLastSyncInfos;
     VkImage mHandle = VK_NULL_HANDLE;
+
+    bool mHasKnownImageCreateInfo = false;
+    VkImageCreateFlags mImageCreateFlags = 0;
+    VkImageUsageFlags mImageUsage = 0;
+    std::vector<VkFormat> mImageViewFormats;
 };
 
 // A texture created and fully owned by Dawn. Typically the result of device.CreateTexture.
@@ -313,6 +337,9 @@ class TextureView final : public TextureViewBase {
 
     ResultOrError<VkImageView> GetOrCreate2DViewOn3D(uint32_t depthSlice = 0u);
 
+    // The usage that GetHandle() inherits from its VkImageViewUsageCreateInfo.
+    VkImageUsageFlags GetHandleUsage() const;
+
   private:
     ~TextureView() override;
     void DestroyImpl() override;
@@ -327,6 +354,7 @@ class TextureView final : public TextureViewBase {
     void SetLabelImpl() override;
 
     VkImageView mHandle = VK_NULL_HANDLE;
+    VkImageUsageFlags mHandleUsage = 0;
     VkImageView mHandleForBGRA8UnormStorage = VK_NULL_HANDLE;
     VkSamplerYcbcrConversion mSamplerYCbCrConversion = VK_NULL_HANDLE;
     YCbCrVkDescriptor mYCbCrVkDescriptor;
@@ -163,6 +163,7 @@ static constexpr std::array<DeviceExtInfo, kDeviceExtCount> sDeviceExtInfos{{
     {DeviceExt::ExternalSemaphore, "VK_KHR_external_semaphore", VulkanVersion_1_1},
     {DeviceExt::_16BitStorage, "VK_KHR_16bit_storage", VulkanVersion_1_1},
     {DeviceExt::SamplerYCbCrConversion, "VK_KHR_sampler_ycbcr_conversion", VulkanVersion_1_1},
+    {DeviceExt::DescriptorUpdateTemplate, "VK_KHR_descriptor_update_template", VulkanVersion_1_1},
 
     {DeviceExt::DriverProperties, "VK_KHR_driver_properties", VulkanVersion_1_2},
     {DeviceExt::ImageFormatList, "VK_KHR_image_format_list", VulkanVersion_1_2},
@@ -170,6 +171,8 @@ static constexpr std::array<DeviceExtInfo, kDeviceExtCount> sDeviceExtInfos{{
     {DeviceExt::ShaderSubgroupExtendedTypes, "VK_KHR_shader_subgroup_extended_types",
      VulkanVersion_1_2},
     {DeviceExt::DrawIndirectCount, "VK_KHR_draw_indirect_count", NeverPromoted},
+    {DeviceExt::TimelineSemaphore, "VK_KHR_timeline_semaphore", VulkanVersion_1_2},
+    {DeviceExt::ImagelessFramebuffer, "VK_KHR_imageless_framebuffer", VulkanVersion_1_2},
 
     {DeviceExt::ShaderIntegerDotProduct, "VK_KHR_shader_integer_dot_product", VulkanVersion_1_3},
     {DeviceExt::ZeroInitializeWorkgroupMemory, "VK_KHR_zero_initialize_workgroup_memory",
@@ -185,6 +188,8 @@ static constexpr std::array<DeviceExtInfo, kDeviceExtCount> sDeviceExtInfos{{
     {DeviceExt::ShaderSubgroupUniformControlFlow, "VK_KHR_shader_subgroup_uniform_control_flow",
      NeverPromoted},
     {DeviceExt::DisplayTiming, "VK_GOOGLE_display_timing", NeverPromoted},
+    {DeviceExt::PipelineLibrary, "VK_KHR_pipeline_library", NeverPromoted},
+    {DeviceExt::GraphicsPipelineLibrary, "VK_EXT_graphics_pipeline_library", NeverPromoted},
 
     {DeviceExt::ExternalMemoryAndroidHardwareBuffer,
      "VK_ANDROID_external_memory_android_hardware_buffer", NeverPromoted},
@@ -236,7 +241,9 @@ DeviceExtSet EnsureDependencies(const DeviceExtSet& advertisedExts,
             case DeviceExt::Maintenance2:
             case DeviceExt::ImageFormatList:
             case DeviceExt::StorageBufferStorageClass:
+            case DeviceExt::DescriptorUpdateTemplate:
             case DeviceExt::DrawIndirectCount:
+            case DeviceExt::PipelineLibrary:
                 hasDependencies = true;
                 break;
 
@@ -272,6 +279,12 @@ DeviceExtSet EnsureDependencies(const DeviceExtSet& advertisedExts,
                 hasDependencies = instanceExts[InstanceExt::Surface];
                 break;
 
+            case DeviceExt::ImagelessFramebuffer:
+                hasDependencies = HasDep(DeviceExt::Maintenance2) &&
+                                  HasDep(DeviceExt::ImageFormatList) &&
+                                  HasDep(DeviceExt::GetPhysicalDeviceProperties2);
+                break;
+
             case DeviceExt::SamplerYCbCrConversion:
                 hasDependencies = HasDep(DeviceExt::Maintenance1) &&
                                   HasDep(DeviceExt::BindMemory2) &&
@@ -289,6 +302,7 @@ DeviceExtSet EnsureDependencies(const DeviceExtSet& advertisedExts,
             case DeviceExt::SubgroupSizeControl:
             case DeviceExt::ShaderSubgroupUniformControlFlow:
             case DeviceExt::ShaderSubgroupExtendedTypes:
+            case DeviceExt::TimelineSemaphore:
                 hasDependencies = HasDep(DeviceExt::GetPhysicalDeviceProperties2);
                 break;
 
@@ -332,6 +346,11 @@ DeviceExtSet EnsureDependencies(const DeviceExtSet& advertisedExts,
                 hasDependencies = HasDep(DeviceExt::Swapchain);
                 break;
 
+            case DeviceExt::GraphicsPipelineLibrary:
+                hasDependencies = HasDep(DeviceExt::PipelineLibrary) &&
+                                  HasDep(DeviceExt::GetPhysicalDeviceProperties2);
+                break;
+
             case DeviceExt::EnumCount:
                 DAWN_UNREACHABLE();
         }
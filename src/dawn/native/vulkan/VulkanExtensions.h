@@ -101,6 +101,7 @@ enum class DeviceExt {
     ExternalSemaphore,
     _16BitStorage,
     SamplerYCbCrConversion,
+    DescriptorUpdateTemplate,
 
     // Promoted to 1.2
     DriverProperties,
@@ -108,6 +109,8 @@ enum class DeviceExt {
     ShaderFloat16Int8,
     ShaderSubgroupExtendedTypes,
     DrawIndirectCount,
+    TimelineSemaphore,
+    ImagelessFramebuffer,
 
     // Promoted to 1.3
     ShaderIntegerDotProduct,
@@ -123,6 +126,8 @@ enum class DeviceExt {
     Robustness2,
     ShaderSubgroupUniformControlFlow,
     DisplayTiming,
+    PipelineLibrary,
+    GraphicsPipelineLibrary,
 
     // External* extensions
     ExternalMemoryAndroidHardwareBuffer,
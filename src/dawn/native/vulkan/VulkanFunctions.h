@@ -354,6 +354,15 @@ struct VulkanFunctions {
     VkFn<PFN_vkCmdDrawIndirectCount> CmdDrawIndirectCountKHR = nullptr;
     VkFn<PFN_vkCmdDrawIndexedIndirectCount> CmdDrawIndexedIndirectCountKHR = nullptr;
 
+    // VK_KHR_timeline_semaphore
+    VkFn<PFN_vkGetSemaphoreCounterValue> GetSemaphoreCounterValue = nullptr;
+    VkFn<PFN_vkWaitSemaphores> WaitSemaphores = nullptr;
+
+    // VK_KHR_descriptor_update_template
+    VkFn<PFN_vkCreateDescriptorUpdateTemplate> CreateDescriptorUpdateTemplate = nullptr;
+    VkFn<PFN_vkDestroyDescriptorUpdateTemplate> DestroyDescriptorUpdateTemplate = nullptr;
+    VkFn<PFN_vkUpdateDescriptorSetWithTemplate> UpdateDescriptorSetWithTemplate = nullptr;
+
 #if VK_USE_PLATFORM_FUCHSIA
     // VK_FUCHSIA_external_memory
     VkFn<PFN_vkGetMemoryZirconHandleFUCHSIA> GetMemoryZirconHandleFUCHSIA = nullptr;
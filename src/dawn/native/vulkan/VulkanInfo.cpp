@@ -327,6 +327,23 @@ ResultOrError<VulkanDeviceInfo> GatherDeviceInfo(const PhysicalDevice& device) {
                 &info.shaderSubgroupExtendedTypes,
                 VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES);
         }
+        if (info.extensions[DeviceExt::TimelineSemaphore]) {
+            featuresChain.Add(&info.timelineSemaphoreFeatures,
+                              VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES);
+        }
+        if (info.extensions[DeviceExt::ImagelessFramebuffer]) {
+            featuresChain.Add(&info.imagelessFramebufferFeatures,
+                              VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES);
+        }
+
+        if (info.extensions[DeviceExt::GraphicsPipelineLibrary]) {
+            featuresChain.Add(
+                &info.graphicsPipelineLibraryFeatures,
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT);
+            propertiesChain.Add(
+                &info.graphicsPipelineLibraryProperties,
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT);
+        }
 
         if (info.extensions[DeviceExt::ExternalMemoryHost]) {
             propertiesChain.Add(
@@ -171,6 +171,11 @@
 #include "dawn/platform/tracing/EventTracer.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
+// Evaluates to true if the category is enabled on the platform. Can be used to skip work that is
+// only needed to produce trace events.
+#define TRACE_EVENT_CATEGORY_ENABLED(platform, category) \
+    (*TRACE_EVENT_API_GET_CATEGORY_ENABLED(platform, ::dawn::platform::TraceCategory::category))
+
 // Records a pair of begin and end events called "name" for the current
 // scope, with 0, 1 or 2 associated arguments. If the category is not
 // enabled, then this does nothing.
@@ -234,6 +234,12 @@ void DawnTestEnvironment::ParseArgs(int argc, char** argv) {
             continue;
         }
 
+        if (strcmp("--use-wire-shared-memory", argv[i]) == 0) {
+            mUseWire = true;
+            mUseWireSharedMemory = true;
+            continue;
+        }
+
         if (strcmp("-s", argv[i]) == 0 || strcmp("--enable-implicit-device-sync", argv[i]) == 0) {
             mEnableImplicitDeviceSync = true;
             continue;
@@ -365,6 +371,8 @@ void DawnTestEnvironment::ParseArgs(int argc, char** argv) {
                    "[--enable-backend-validation[=full,partial,disabled]]\n"
                    "    [--exclusive-device-type-preference=integrated,cpu,discrete]\n\n"
                    "  -w, --use-wire: Run the tests through the wire (defaults to no wire)\n"
+                   "  --use-wire-shared-memory: Run the tests through the wire, transferring "
+                   "mapped and queue write data through shared memory. Implies --use-wire\n"
                    "  -s, --enable-implicit-device-sync: Run the tests with implicit device "
                    "synchronization feature (defaults to false)\n"
                    "  -c, --begin-capture-on-startup: Begin debug capture on startup "
@@ -576,6 +584,9 @@ void DawnTestEnvironment::PrintTestConfigurationAndAdapterInfo(native::Instance*
            "---------------------\n"
            "UseWire: "
         << (mUseWire ? "true" : "false")
+        << "\n"
+           "UseWireSharedMemory: "
+        << (mUseWireSharedMemory ? "true" : "false")
         << "\n"
            "Implicit device synchronization: "
         << (mEnableImplicitDeviceSync ? "enabled" : "disabled")
@@ -665,6 +676,10 @@ bool DawnTestEnvironment::UsesWire() const {
     return mUseWire;
 }
 
+bool DawnTestEnvironment::UsesWireSharedMemory() const {
+    return mUseWireSharedMemory;
+}
+
 bool DawnTestEnvironment::IsImplicitDeviceSyncEnabled() const {
     return mEnableImplicitDeviceSync;
 }
@@ -786,7 +801,8 @@ DawnTestBase::DawnTestBase(const AdapterTestParam& param) : mParam(param) {
         return {0};
     };
 
-    mWireHelper = utils::CreateWireHelper(procs, gTestEnv->UsesWire(), gTestEnv->GetWireTraceDir());
+    mWireHelper = utils::CreateWireHelper(procs, gTestEnv->UsesWire(), gTestEnv->GetWireTraceDir(),
+                                          gTestEnv->UsesWireSharedMemory());
 }
 
 DawnTestBase::~DawnTestBase() {
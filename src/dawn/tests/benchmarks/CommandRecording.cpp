@@ -0,0 +1,90 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <vector>
+
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+// Benchmarks for recording and submitting command buffers in Dawn. These mostly exercise the
+// frontend command allocation and its recycling since the null backend does no work on submit.
+class CommandRecording : public NullDeviceBenchmarkFixture {
+  protected:
+    CommandRecording() {
+        // Queue submission from multiple threads needs to be synchronized.
+        requiredFeatures.push_back(wgpu::FeatureName::ImplicitDeviceSynchronization);
+    }
+
+  private:
+    wgpu::DeviceDescriptor GetDeviceDescriptor() const override {
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.requiredFeatures = requiredFeatures.data();
+        deviceDesc.requiredFeatureCount = requiredFeatures.size();
+        return deviceDesc;
+    }
+
+    std::vector<wgpu::FeatureName> requiredFeatures;
+};
+
+// Records an encoder with a compute pass of state.range(0) dispatches and submits it.
+BENCHMARK_DEFINE_F(CommandRecording, RecordAndSubmitComputePass)
+(benchmark::State& state) {
+    wgpu::ComputePipelineDescriptor computeDesc = {};
+    computeDesc.compute.module = utils::CreateShaderModule(device, R"(
+        @compute @workgroup_size(1) fn main() {}
+    )");
+    computeDesc.layout = utils::MakePipelineLayout(device, {});
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&computeDesc);
+
+    wgpu::Queue queue = device.GetQueue();
+    for (auto _ : state) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            pass.SetPipeline(pipeline);
+            pass.DispatchWorkgroups(1);
+        }
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+}
+BENCHMARK_REGISTER_F(CommandRecording, RecordAndSubmitComputePass)
+    ->Arg(0)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(4096)
+    ->Threads(1)
+    ->Threads(4);
+
+}  // namespace
+}  // namespace dawn
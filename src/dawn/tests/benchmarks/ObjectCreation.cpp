@@ -28,6 +28,8 @@
 #include <benchmark/benchmark.h>
 #include <dawn/webgpu_cpp.h>
 #include <array>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "dawn/common/Log.h"
@@ -195,6 +197,51 @@ BENCHMARK_DEFINE_F(ObjectCreation, UniqueComputePipeline)
 }
 BENCHMARK_REGISTER_F(ObjectCreation, UniqueComputePipeline)->Threads(1)->Threads(4)->Threads(16);
 
+// Creates unique pipelines from a single module with Arg entry points, which measures the work
+// done per pipeline for a shader module that is already parsed and reflected.
+BENCHMARK_DEFINE_F(ObjectCreation, UniqueComputePipelinesFromOneModule)
+(benchmark::State& state) {
+    const uint32_t entryPointCount = state.range(0);
+
+    std::ostringstream shader;
+    shader << "@group(0) @binding(0) var<uniform> u : vec4u;\n";
+    for (uint32_t i = 0; i < entryPointCount; ++i) {
+        shader << "@compute @workgroup_size(64) fn main" << i << "() { _ = u; }\n";
+    }
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, shader.str().c_str());
+
+    // Each thread uses a different sequence of binding sizes so that every pipeline layout, and
+    // hence every pipeline, is unique.
+    uint64_t minBindingSize = 16u * (state.thread_index() + 1);
+
+    std::vector<std::string> entryPoints;
+    for (uint32_t i = 0; i < entryPointCount; ++i) {
+        entryPoints.push_back("main" + std::to_string(i));
+    }
+
+    std::vector<wgpu::ComputePipeline> computePipelines;
+    computePipelines.reserve(40000);
+    uint32_t iteration = 0;
+    for (auto _ : state) {
+        minBindingSize += 16u * state.threads();
+        wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+            device, {{0, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform,
+                      /* hasDynamicOffset */ false, minBindingSize}});
+
+        wgpu::ComputePipelineDescriptor computeDesc = {};
+        computeDesc.compute.module = module;
+        computeDesc.compute.entryPoint = entryPoints[iteration++ % entryPointCount].c_str();
+        computeDesc.layout = utils::MakePipelineLayout(device, {bgl});
+        computePipelines.push_back(device.CreateComputePipeline(&computeDesc));
+    }
+}
+BENCHMARK_REGISTER_F(ObjectCreation, UniqueComputePipelinesFromOneModule)
+    ->Arg(1)
+    ->Arg(64)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16);
+
 BENCHMARK_DEFINE_F(ObjectCreation, SameRenderPipeline)
 (benchmark::State& state) {
     utils::ComboRenderPipelineDescriptor renderDesc;
@@ -1353,7 +1353,8 @@ DAWN_INSTANTIATE_TEST(BufferTests,
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"vulkan_async_queue_submission"}));
 
 class BufferNoSuballocationTests : public DawnTest {};
 
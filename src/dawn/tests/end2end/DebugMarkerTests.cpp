@@ -61,13 +61,45 @@ TEST_P(DebugMarkerTests, NoFailureWithoutDebugToolAttached) {
     queue.Submit(1, &commands);
 }
 
+// Make sure that markers in render bundles executed inside the debug groups of a render pass don't
+// cause a failure.
+TEST_P(DebugMarkerTests, RenderBundleInsideDebugGroup) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 4, 4);
+
+    wgpu::RenderBundleEncoderDescriptor bundleDesc = {};
+    bundleDesc.colorFormatCount = 1;
+    bundleDesc.colorFormats = &renderPass.colorFormat;
+    wgpu::RenderBundleEncoder bundleEncoder = device.CreateRenderBundleEncoder(&bundleDesc);
+    bundleEncoder.PushDebugGroup("Bundle Event Start");
+    bundleEncoder.InsertDebugMarker("Bundle Marker");
+    bundleEncoder.PopDebugGroup();
+    wgpu::RenderBundle bundle = bundleEncoder.Finish();
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    {
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.PushDebugGroup("Event Start");
+        pass.PushDebugGroup("Nested Event Start");
+        pass.ExecuteBundles(1, &bundle);
+        pass.PopDebugGroup();
+        pass.InsertDebugMarker("Marker");
+        pass.ExecuteBundles(1, &bundle);
+        pass.PopDebugGroup();
+        pass.End();
+    }
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+}
+
 DAWN_INSTANTIATE_TEST(DebugMarkerTests,
                       D3D11Backend(),
                       D3D12Backend(),
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"vulkan_record_render_bundles_in_parallel"}));
 
 }  // anonymous namespace
 }  // namespace dawn
@@ -232,7 +232,8 @@ DAWN_INSTANTIATE_TEST(DestroyTest,
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"vulkan_background_deferred_deletion"}));
 
 }  // anonymous namespace
 }  // namespace dawn
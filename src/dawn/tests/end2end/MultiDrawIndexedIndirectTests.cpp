@@ -433,7 +433,9 @@ TEST_P(MultiDrawIndexedIndirectTest, ValidateMultiAndSingleDrawsInSingleRenderPa
 DAWN_INSTANTIATE_TEST(MultiDrawIndexedIndirectTest,
                       VulkanBackend(),
                       D3D12Backend(),
-                      MetalBackend());
+                      MetalBackend(),
+                      OpenGLBackend(),
+                      OpenGLESBackend());
 
 class MultiDrawIndexedIndirectUsingFirstVertexTest : public DawnTest {
   protected:
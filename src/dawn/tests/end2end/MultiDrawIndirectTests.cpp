@@ -167,7 +167,12 @@ TEST_P(MultiDrawIndirectTest, IndirectOffset) {
     Test({3, 1, 0, 0, 3, 1, 3, 0}, kDrawIndirectSize, 1, notFilled, filled);
 }
 
-DAWN_INSTANTIATE_TEST(MultiDrawIndirectTest, VulkanBackend(), D3D12Backend(), MetalBackend());
+DAWN_INSTANTIATE_TEST(MultiDrawIndirectTest,
+                      VulkanBackend(),
+                      D3D12Backend(),
+                      MetalBackend(),
+                      OpenGLBackend(),
+                      OpenGLESBackend());
 
 class MultiDrawIndirectUsingFirstVertexTest : public DawnTest {
   protected:
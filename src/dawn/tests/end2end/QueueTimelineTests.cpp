@@ -98,7 +98,8 @@ DAWN_INSTANTIATE_TEST(QueueTimelineTests,
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"vulkan_async_queue_submission"}));
 
 }  // anonymous namespace
 }  // namespace dawn
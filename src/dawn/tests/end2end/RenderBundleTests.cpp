@@ -209,13 +209,52 @@ TEST_P(RenderBundleTest, BundleAndRenderPassCommands) {
     EXPECT_PIXEL_RGBA8_EQ(kColors[1], renderPass.color, 3, 1);
 }
 
+// Test that bundles use the viewport and scissor set by the render pass before they are executed.
+TEST_P(RenderBundleTest, BundleUsesPassDynamicState) {
+    utils::ComboRenderBundleEncoderDescriptor desc = {};
+    desc.colorFormatCount = 1;
+    desc.cColorFormats[0] = renderPass.colorFormat;
+
+    wgpu::RenderBundle renderBundles[2];
+    for (uint32_t i = 0; i < 2; ++i) {
+        wgpu::RenderBundleEncoder renderBundleEncoder = device.CreateRenderBundleEncoder(&desc);
+
+        renderBundleEncoder.SetPipeline(pipeline);
+        renderBundleEncoder.SetVertexBuffer(0, vertexBuffer);
+        renderBundleEncoder.SetBindGroup(0, bindGroups[i]);
+        renderBundleEncoder.Draw(6);
+
+        renderBundles[i] = renderBundleEncoder.Finish();
+    }
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+
+    // Draw the first bundle in the left half and the second one in the top right quarter.
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.SetViewport(0, 0, kRTSize / 2, kRTSize, 0, 1);
+    pass.ExecuteBundles(1, &renderBundles[0]);
+    pass.SetViewport(0, 0, kRTSize, kRTSize, 0, 1);
+    pass.SetScissorRect(kRTSize / 2, 0, kRTSize / 2, kRTSize / 2);
+    pass.ExecuteBundles(1, &renderBundles[1]);
+    pass.End();
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    EXPECT_PIXEL_RGBA8_EQ(kColors[0], renderPass.color, 1, 1);
+    EXPECT_PIXEL_RGBA8_EQ(kColors[0], renderPass.color, 1, 3);
+    EXPECT_PIXEL_RGBA8_EQ(kColors[1], renderPass.color, 3, 1);
+    EXPECT_PIXEL_RGBA8_EQ(utils::RGBA8::kZero, renderPass.color, 3, 3);
+}
+
 DAWN_INSTANTIATE_TEST(RenderBundleTest,
                       D3D11Backend(),
                       D3D12Backend(),
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"vulkan_record_render_bundles_in_parallel"}));
 
 }  // anonymous namespace
 }  // namespace dawn
@@ -0,0 +1,195 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <array>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumBindGroups = 100;
+constexpr uint32_t kBindingsPerType = 4;
+
+// The kind of bindings in the layout of the bind groups created.
+enum class Bindings {
+    Buffers,
+    Textures,
+    BuffersAndTextures,
+};
+
+std::ostream& operator<<(std::ostream& ostream, const Bindings& bindings) {
+    switch (bindings) {
+        case Bindings::Buffers:
+            ostream << "Buffers";
+            break;
+        case Bindings::Textures:
+            ostream << "Textures";
+            break;
+        case Bindings::BuffersAndTextures:
+            ostream << "BuffersAndTextures";
+            break;
+    }
+    return ostream;
+}
+
+struct BindGroupCreationParams : AdapterTestParam {
+    BindGroupCreationParams(const AdapterTestParam& param, Bindings bindings)
+        : AdapterTestParam(param), bindings(bindings) {}
+    Bindings bindings;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const BindGroupCreationParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.bindings;
+    return ostream;
+}
+
+// Measures the cost of creating bind groups, which is mostly the cost of writing their
+// descriptors in the backend. All the bind groups of a step share the same layout and resources
+// and are released at the end of the step.
+class BindGroupCreationPerf : public DawnPerfTestWithParams<BindGroupCreationParams> {
+  public:
+    BindGroupCreationPerf()
+        : DawnPerfTestWithParams<BindGroupCreationParams>(kNumBindGroups, 1) {}
+    ~BindGroupCreationPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::BindGroupLayout mLayout;
+    std::vector<wgpu::BindGroupEntry> mEntries;
+
+    wgpu::Buffer mBuffer;
+    wgpu::Sampler mSampler;
+    wgpu::TextureView mTextureView;
+};
+
+void BindGroupCreationPerf::SetUp() {
+    DawnPerfTestWithParams<BindGroupCreationParams>::SetUp();
+
+    bool useBuffers = GetParam().bindings != Bindings::Textures;
+    bool useTextures = GetParam().bindings != Bindings::Buffers;
+
+    wgpu::BufferDescriptor bufferDesc;
+    bufferDesc.size = 256 * kBindingsPerType;
+    bufferDesc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::Storage;
+    mBuffer = device.CreateBuffer(&bufferDesc);
+
+    mSampler = device.CreateSampler();
+
+    wgpu::TextureDescriptor textureDesc;
+    textureDesc.size = {4, 4};
+    textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDesc.usage = wgpu::TextureUsage::TextureBinding;
+    mTextureView = device.CreateTexture(&textureDesc).CreateView();
+
+    auto AddBufferEntry = [&](uint32_t entryBinding, uint64_t offset) {
+        wgpu::BindGroupEntry entry = {};
+        entry.binding = entryBinding;
+        entry.buffer = mBuffer;
+        entry.offset = offset;
+        entry.size = 256;
+        mEntries.push_back(entry);
+    };
+
+    std::vector<wgpu::BindGroupLayoutEntry> layoutEntries;
+    uint32_t binding = 0;
+    if (useBuffers) {
+        for (uint32_t i = 0; i < kBindingsPerType; ++i) {
+            wgpu::BindGroupLayoutEntry uniformEntry = {};
+            uniformEntry.binding = binding;
+            uniformEntry.visibility = wgpu::ShaderStage::Compute;
+            uniformEntry.buffer.type = wgpu::BufferBindingType::Uniform;
+            layoutEntries.push_back(uniformEntry);
+            AddBufferEntry(binding++, 256 * i);
+
+            wgpu::BindGroupLayoutEntry storageEntry = {};
+            storageEntry.binding = binding;
+            storageEntry.visibility = wgpu::ShaderStage::Compute;
+            storageEntry.buffer.type = wgpu::BufferBindingType::ReadOnlyStorage;
+            layoutEntries.push_back(storageEntry);
+            AddBufferEntry(binding++, 256 * i);
+        }
+    }
+    if (useTextures) {
+        wgpu::BindGroupLayoutEntry samplerEntry = {};
+        samplerEntry.binding = binding;
+        samplerEntry.visibility = wgpu::ShaderStage::Fragment;
+        samplerEntry.sampler.type = wgpu::SamplerBindingType::Filtering;
+        layoutEntries.push_back(samplerEntry);
+        wgpu::BindGroupEntry entry = {};
+        entry.binding = binding++;
+        entry.sampler = mSampler;
+        mEntries.push_back(entry);
+
+        for (uint32_t i = 0; i < kBindingsPerType; ++i) {
+            wgpu::BindGroupLayoutEntry textureEntry = {};
+            textureEntry.binding = binding;
+            textureEntry.visibility = wgpu::ShaderStage::Fragment;
+            textureEntry.texture.sampleType = wgpu::TextureSampleType::Float;
+            layoutEntries.push_back(textureEntry);
+            wgpu::BindGroupEntry entry = {};
+            entry.binding = binding++;
+            entry.textureView = mTextureView;
+            mEntries.push_back(entry);
+        }
+    }
+
+    wgpu::BindGroupLayoutDescriptor layoutDesc;
+    layoutDesc.entryCount = layoutEntries.size();
+    layoutDesc.entries = layoutEntries.data();
+    mLayout = device.CreateBindGroupLayout(&layoutDesc);
+}
+
+void BindGroupCreationPerf::Step() {
+    wgpu::BindGroupDescriptor descriptor;
+    descriptor.layout = mLayout;
+    descriptor.entryCount = mEntries.size();
+    descriptor.entries = mEntries.data();
+
+    std::array<wgpu::BindGroup, kNumBindGroups> bindGroups;
+    for (wgpu::BindGroup& bindGroup : bindGroups) {
+        bindGroup = device.CreateBindGroup(&descriptor);
+    }
+}
+
+TEST_P(BindGroupCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(BindGroupCreationPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
+                         VulkanBackend({}, {"vulkan_use_descriptor_update_templates"})},
+                        {Bindings::Buffers, Bindings::Textures, Bindings::BuffersAndTextures});
+
+}  // anonymous namespace
+}  // namespace dawn
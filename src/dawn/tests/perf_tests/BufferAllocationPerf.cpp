@@ -0,0 +1,153 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumBuffers = 1024;
+
+// The range of the sizes of the buffers created.
+enum class BufferSizes {
+    // Uniform buffers from 256 bytes to 4KiB.
+    Small,
+    // Uniform and storage buffers from 256 bytes to 64KiB.
+    Mixed,
+};
+
+std::ostream& operator<<(std::ostream& ostream, const BufferSizes& sizes) {
+    switch (sizes) {
+        case BufferSizes::Small:
+            ostream << "Small";
+            break;
+        case BufferSizes::Mixed:
+            ostream << "Mixed";
+            break;
+    }
+    return ostream;
+}
+
+struct BufferAllocationParams : AdapterTestParam {
+    BufferAllocationParams(const AdapterTestParam& param, BufferSizes sizes)
+        : AdapterTestParam(param), sizes(sizes) {}
+    BufferSizes sizes;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const BufferAllocationParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.sizes;
+    return ostream;
+}
+
+// Measures the cost of creating many small buffers of sizes that aren't powers of two, and
+// reports how much memory is committed to suballocate them compared to the requested size.
+class BufferAllocationPerf : public DawnPerfTestWithParams<BufferAllocationParams> {
+  public:
+    BufferAllocationPerf() : DawnPerfTestWithParams<BufferAllocationParams>(kNumBuffers, 1) {}
+    ~BufferAllocationPerf() override = default;
+
+    void SetUp() override;
+
+  protected:
+    void ReportMemoryEfficiency();
+
+  private:
+    void Step() override;
+    void CreateBuffers();
+
+    std::vector<uint64_t> mBufferSizes;
+    std::vector<wgpu::Buffer> mBuffers;
+};
+
+void BufferAllocationPerf::SetUp() {
+    DawnPerfTestWithParams<BufferAllocationParams>::SetUp();
+
+    uint64_t maxSize = GetParam().sizes == BufferSizes::Small ? 4 * 1024 : 64 * 1024;
+
+    // Use a fixed pseudo-random sequence of sizes that are multiples of 16 bytes.
+    uint32_t state = 1;
+    mBufferSizes.reserve(kNumBuffers);
+    for (unsigned int i = 0; i < kNumBuffers; ++i) {
+        state = state * 1664525u + 1013904223u;
+        uint64_t size = 256 + (state >> 8) % (maxSize - 256 + 1);
+        mBufferSizes.push_back(size & ~uint64_t(15));
+    }
+    mBuffers.reserve(kNumBuffers);
+}
+
+void BufferAllocationPerf::CreateBuffers() {
+    mBuffers.clear();
+    for (uint64_t size : mBufferSizes) {
+        wgpu::BufferDescriptor descriptor;
+        descriptor.size = size;
+        descriptor.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::Storage |
+                           wgpu::BufferUsage::CopyDst;
+        mBuffers.push_back(device.CreateBuffer(&descriptor));
+    }
+}
+
+void BufferAllocationPerf::Step() {
+    CreateBuffers();
+}
+
+void BufferAllocationPerf::ReportMemoryEfficiency() {
+    // Let the memory of the buffers of the last step be reclaimed before measuring the memory
+    // used by one set of buffers.
+    mBuffers.clear();
+    WaitForAllOperations();
+    CreateBuffers();
+    // The suballocation metrics are sampled when the device ticks.
+    WaitForAllOperations();
+
+    uint64_t requestedBytes = 0;
+    for (uint64_t size : mBufferSizes) {
+        requestedBytes += size;
+    }
+    native::DeviceMetrics metrics = native::GetDeviceMetrics(backendDevice);
+
+    PrintResult("requested_bytes", static_cast<double>(requestedBytes), "bytes", false);
+    PrintResult("committed_bytes", static_cast<double>(metrics.suballocationHeapBytes), "bytes",
+                true);
+    PrintResult("slab_bytes", static_cast<double>(metrics.slabBytes), "bytes", false);
+    PrintResult("slab_bytes_in_use", static_cast<double>(metrics.slabBytesInUse), "bytes", false);
+}
+
+TEST_P(BufferAllocationPerf, Run) {
+    RunTest();
+    ReportMemoryEfficiency();
+}
+
+// The suballocation memory metrics are only reported by the Vulkan backend.
+DAWN_INSTANTIATE_TEST_P(BufferAllocationPerf,
+                        {VulkanBackend(), VulkanBackend({"vulkan_use_slab_suballocation"})},
+                        {BufferSizes::Small, BufferSizes::Mixed});
+
+}  // anonymous namespace
+}  // namespace dawn
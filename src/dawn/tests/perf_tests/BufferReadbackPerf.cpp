@@ -0,0 +1,141 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumIterations = 10;
+
+enum class ReadbackSize {
+    BufferSize_1KB = 1 * 1024,
+    BufferSize_64KB = 64 * 1024,
+    BufferSize_1MB = 1 * 1024 * 1024,
+    BufferSize_4MB = 4 * 1024 * 1024,
+    BufferSize_16MB = 16 * 1024 * 1024,
+};
+
+struct BufferReadbackParams : AdapterTestParam {
+    BufferReadbackParams(const AdapterTestParam& param, ReadbackSize readbackSize)
+        : AdapterTestParam(param), readbackSize(readbackSize) {}
+
+    ReadbackSize readbackSize;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const BufferReadbackParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.readbackSize) {
+        case ReadbackSize::BufferSize_1KB:
+            ostream << "_BufferSize_1KB";
+            break;
+        case ReadbackSize::BufferSize_64KB:
+            ostream << "_BufferSize_64KB";
+            break;
+        case ReadbackSize::BufferSize_1MB:
+            ostream << "_BufferSize_1MB";
+            break;
+        case ReadbackSize::BufferSize_4MB:
+            ostream << "_BufferSize_4MB";
+            break;
+        case ReadbackSize::BufferSize_16MB:
+            ostream << "_BufferSize_16MB";
+            break;
+    }
+
+    return ostream;
+}
+
+// Test copying a buffer into |kNumIterations| MapRead buffers and reading all of them back. This
+// is dominated by the cost of getting the mapped data to the client when running with the wire.
+class BufferReadbackPerf : public DawnPerfTestWithParams<BufferReadbackParams> {
+  public:
+    BufferReadbackPerf()
+        : DawnPerfTestWithParams(kNumIterations, 1),
+          data(static_cast<size_t>(GetParam().readbackSize)) {}
+    ~BufferReadbackPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::Buffer src;
+    wgpu::Buffer readbackBuffers[kNumIterations];
+    std::vector<uint8_t> data;
+};
+
+void BufferReadbackPerf::SetUp() {
+    DawnPerfTestWithParams<BufferReadbackParams>::SetUp();
+
+    wgpu::BufferDescriptor desc = {};
+    desc.size = data.size();
+    desc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+    src = device.CreateBuffer(&desc);
+
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    queue.WriteBuffer(src, 0, data.data(), data.size());
+
+    desc.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
+    for (auto& buffer : readbackBuffers) {
+        buffer = device.CreateBuffer(&desc);
+    }
+}
+
+void BufferReadbackPerf::Step() {
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    for (auto& buffer : readbackBuffers) {
+        encoder.CopyBufferToBuffer(src, 0, buffer, 0, data.size());
+    }
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    for (auto& buffer : readbackBuffers) {
+        MapAsyncAndWait(buffer, wgpu::MapMode::Read, 0, data.size());
+        memcpy(data.data(), buffer.GetConstMappedRange(0, data.size()), data.size());
+        buffer.Unmap();
+    }
+}
+
+TEST_P(BufferReadbackPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(BufferReadbackPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
+                        {ReadbackSize::BufferSize_1KB, ReadbackSize::BufferSize_64KB,
+                         ReadbackSize::BufferSize_1MB, ReadbackSize::BufferSize_4MB,
+                         ReadbackSize::BufferSize_16MB});
+
+}  // anonymous namespace
+}  // namespace dawn
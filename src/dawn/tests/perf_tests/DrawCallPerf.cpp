@@ -25,6 +25,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <array>
 #include <tuple>
 #include <vector>
 
@@ -33,6 +34,7 @@
 #include "dawn/common/Math.h"
 #include "dawn/tests/perf_tests/DawnPerfTest.h"
 #include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/TestUtils.h"
 #include "dawn/utils/WGPUHelpers.h"
 
 namespace dawn {
@@ -40,6 +42,11 @@ namespace {
 
 constexpr unsigned int kNumDraws = 2000;
 
+// The number of threads encoding render bundles with RenderBundle::Parallel. Each of them encodes
+// kNumDraws / kNumEncodingThreads draws.
+constexpr uint32_t kNumEncodingThreads = 4;
+static_assert(kNumDraws % kNumEncodingThreads == 0);
+
 constexpr uint32_t kTextureSize = 64;
 constexpr size_t kUniformSize = 3 * sizeof(float);
 
@@ -94,8 +101,9 @@ enum class VertexBuffer {
 };
 
 enum class RenderBundle {
-    No,   // Record commands in a render pass
-    Yes,  // Record commands in a render bundle
+    No,        // Record commands in a render pass
+    Yes,       // Record commands in a render bundle
+    Parallel,  // Record commands in render bundles encoded on multiple threads every frame
 };
 
 struct DrawCallParam {
@@ -203,6 +211,9 @@ std::ostream& operator<<(std::ostream& ostream, const DrawCallParamForTest& test
         case RenderBundle::Yes:
             ostream << "_RenderBundle";
             break;
+        case RenderBundle::Parallel:
+            ostream << "_ParallelRenderBundles";
+            break;
     }
 
     return ostream;
@@ -220,6 +231,8 @@ std::ostream& operator<<(std::ostream& ostream, const DrawCallParamForTest& test
 //     layout incurs additional state tracking costs in Dawn.
 //   - With/Without render bundles: All of the above can have lower validation costs if
 //     precomputed in a render bundle.
+//   - Parallel render bundles: Encoding the commands on multiple threads every frame tests how
+//     encoding and recording the pass in the backend scale with the number of threads.
 //   - Static/Dynamic data: Updating data for each draw is a common use case. It also tests
 //     the efficiency of resource transitions.
 class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
@@ -232,8 +245,14 @@ class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
   protected:
     DrawCallParam GetParam() const { return DawnPerfTestWithParams::GetParam().param; }
 
+    std::vector<wgpu::FeatureName> GetRequiredFeatures() override;
+
+    wgpu::RenderBundleEncoder CreateRenderBundleEncoder();
+
     template <typename Encoder>
-    void RecordRenderCommands(Encoder encoder);
+    void RecordRenderCommands(Encoder encoder,
+                              unsigned int firstDraw = 0,
+                              unsigned int drawCount = kNumDraws);
 
   private:
     void Step() override;
@@ -263,11 +282,24 @@ class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
     wgpu::TextureView mDepthStencilAttachment;
 
     wgpu::RenderBundle mRenderBundle;
+    std::array<wgpu::RenderBundle, kNumEncodingThreads> mParallelRenderBundles;
 };
 
+std::vector<wgpu::FeatureName> DrawCallPerf::GetRequiredFeatures() {
+    std::vector<wgpu::FeatureName> requiredFeatures = DawnPerfTestWithParams::GetRequiredFeatures();
+    // Render bundles are encoded and finished on multiple threads.
+    if (!UsesWire() && GetParam().withRenderBundle == RenderBundle::Parallel) {
+        requiredFeatures.push_back(wgpu::FeatureName::ImplicitDeviceSynchronization);
+    }
+    return requiredFeatures;
+}
+
 void DrawCallPerf::SetUp() {
     DawnPerfTestWithParams::SetUp();
 
+    // TODO(crbug.com/dawn/1678): DawnWire doesn't support thread safe API yet.
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire() && GetParam().withRenderBundle == RenderBundle::Parallel);
+
     // Compute aligned uniform / vertex data sizes.
     mAlignedUniformSize =
         Align(kUniformSize, GetSupportedLimits().limits.minUniformBufferOffsetAlignment);
@@ -452,19 +484,27 @@ void DrawCallPerf::SetUp() {
 
     // If using render bundles, record the render commands now.
     if (GetParam().withRenderBundle == RenderBundle::Yes) {
-        wgpu::RenderBundleEncoderDescriptor descriptor = {};
-        descriptor.colorFormatCount = 1;
-        descriptor.colorFormats = &renderPipelineDesc.cTargets[0].format;
-        descriptor.depthStencilFormat = wgpu::TextureFormat::Depth24PlusStencil8;
-
-        wgpu::RenderBundleEncoder encoder = device.CreateRenderBundleEncoder(&descriptor);
+        wgpu::RenderBundleEncoder encoder = CreateRenderBundleEncoder();
         RecordRenderCommands(encoder);
         mRenderBundle = encoder.Finish();
     }
 }
 
+wgpu::RenderBundleEncoder DrawCallPerf::CreateRenderBundleEncoder() {
+    wgpu::TextureFormat colorFormat = wgpu::TextureFormat::RGBA8Unorm;
+
+    wgpu::RenderBundleEncoderDescriptor descriptor = {};
+    descriptor.colorFormatCount = 1;
+    descriptor.colorFormats = &colorFormat;
+    descriptor.depthStencilFormat = wgpu::TextureFormat::Depth24PlusStencil8;
+
+    return device.CreateRenderBundleEncoder(&descriptor);
+}
+
 template <typename Encoder>
-void DrawCallPerf::RecordRenderCommands(Encoder pass) {
+void DrawCallPerf::RecordRenderCommands(Encoder pass,
+                                        unsigned int firstDraw,
+                                        unsigned int drawCount) {
     uint32_t uniformBindGroupIndex = 0;
 
     if (GetParam().pipelineType == Pipeline::Static) {
@@ -485,7 +525,7 @@ void DrawCallPerf::RecordRenderCommands(Encoder pass) {
         pass.SetBindGroup(uniformBindGroupIndex, mUniformBindGroups[0]);
     }
 
-    for (unsigned int i = 0; i < kNumDraws; ++i) {
+    for (unsigned int i = firstDraw; i < firstDraw + drawCount; ++i) {
         switch (GetParam().pipelineType) {
             case Pipeline::Static:
                 break;
@@ -592,6 +632,16 @@ void DrawCallPerf::Step() {
         case RenderBundle::Yes:
             pass.ExecuteBundles(1, &mRenderBundle);
             break;
+        case RenderBundle::Parallel: {
+            constexpr unsigned int kDrawsPerThread = kNumDraws / kNumEncodingThreads;
+            utils::RunInParallel(kNumEncodingThreads, [&](uint32_t index) {
+                wgpu::RenderBundleEncoder encoder = CreateRenderBundleEncoder();
+                RecordRenderCommands(encoder, index * kDrawsPerThread, kDrawsPerThread);
+                mParallelRenderBundles[index] = encoder.Finish();
+            });
+            pass.ExecuteBundles(kNumEncodingThreads, mParallelRenderBundles.data());
+            break;
+        }
         default:
             DAWN_UNREACHABLE();
             break;
@@ -662,5 +712,20 @@ DAWN_INSTANTIATE_TEST_P(
                   UniformData::Dynamic),  // Update per-draw data: Dynamic bind groups
     });
 
+// Encode render bundles on multiple threads every frame, with and without the Vulkan backend
+// recording them in parallel too.
+DAWN_INSTANTIATE_PREFIXED_TEST_P(
+    ParallelEncoding,
+    DrawCallPerf,
+    {D3D12Backend(), MetalBackend(), VulkanBackend(),
+     VulkanBackend({"vulkan_record_render_bundles_in_parallel"})},
+    {
+        MakeParam(RenderBundle::Parallel),
+        MakeParam(VertexBuffer::Multiple, RenderBundle::Parallel),
+        MakeParam(BindGroup::Multiple, RenderBundle::Parallel),
+        MakeParam(BindGroup::Dynamic, RenderBundle::Parallel),
+        MakeParam(Pipeline::Dynamic, BindGroup::Multiple, RenderBundle::Parallel),
+    });
+
 }  // anonymous namespace
 }  // namespace dawn
@@ -0,0 +1,116 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumIterations = 50;
+constexpr uint64_t kCopySize = 256;
+
+// The number of buffer copies recorded in each command buffer. Few copies make the submit cost
+// dominated by vkQueueSubmit, many copies by the recording of the commands.
+enum class CopiesPerSubmit {
+    One = 1,
+    Many = 64,
+};
+
+struct QueueSubmitParams : AdapterTestParam {
+    QueueSubmitParams(const AdapterTestParam& param, CopiesPerSubmit copiesPerSubmit)
+        : AdapterTestParam(param), copiesPerSubmit(copiesPerSubmit) {}
+
+    CopiesPerSubmit copiesPerSubmit;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const QueueSubmitParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+
+    switch (param.copiesPerSubmit) {
+        case CopiesPerSubmit::One:
+            ostream << "_OneCopyPerSubmit";
+            break;
+        case CopiesPerSubmit::Many:
+            ostream << "_ManyCopiesPerSubmit";
+            break;
+    }
+
+    return ostream;
+}
+
+// Test the CPU cost of Queue::Submit by submitting |kNumIterations| small command buffers.
+class QueueSubmitPerf : public DawnPerfTestWithParams<QueueSubmitParams> {
+  public:
+    QueueSubmitPerf() : DawnPerfTestWithParams(kNumIterations, 3) {}
+    ~QueueSubmitPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::Buffer src;
+    wgpu::Buffer dst;
+};
+
+void QueueSubmitPerf::SetUp() {
+    DawnPerfTestWithParams<QueueSubmitParams>::SetUp();
+
+    wgpu::BufferDescriptor desc = {};
+    desc.size = kCopySize;
+    desc.usage = wgpu::BufferUsage::CopySrc;
+    src = device.CreateBuffer(&desc);
+
+    desc.usage = wgpu::BufferUsage::CopyDst;
+    dst = device.CreateBuffer(&desc);
+}
+
+void QueueSubmitPerf::Step() {
+    uint32_t copyCount = static_cast<uint32_t>(GetParam().copiesPerSubmit);
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        for (uint32_t j = 0; j < copyCount; ++j) {
+            encoder.CopyBufferToBuffer(src, 0, dst, 0, kCopySize);
+        }
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+}
+
+TEST_P(QueueSubmitPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(QueueSubmitPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
+                         VulkanBackend({"vulkan_async_queue_submission"})},
+                        {CopiesPerSubmit::One, CopiesPerSubmit::Many});
+
+}  // anonymous namespace
+}  // namespace dawn
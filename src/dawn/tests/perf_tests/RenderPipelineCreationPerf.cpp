@@ -0,0 +1,171 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <array>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+// The vertex buffer strides and depth compare functions used to make permutations of a pipeline.
+constexpr std::array<uint32_t, 4> kArrayStrides = {16, 32, 48, 64};
+constexpr std::array<wgpu::CompareFunction, 8> kDepthCompares = {
+    wgpu::CompareFunction::Never,        wgpu::CompareFunction::Less,
+    wgpu::CompareFunction::Equal,        wgpu::CompareFunction::LessEqual,
+    wgpu::CompareFunction::Greater,      wgpu::CompareFunction::NotEqual,
+    wgpu::CompareFunction::GreaterEqual, wgpu::CompareFunction::Always,
+};
+
+constexpr char kVertexShader[] = R"(
+    @vertex fn main(@location(0) pos : vec4f) -> @builtin(position) vec4f {
+        return pos;
+    })";
+
+constexpr char kFragmentShader[] = R"(
+    @fragment fn main() -> @location(0) vec4f {
+        return vec4f(0.0, 1.0, 0.0, 1.0);
+    })";
+
+// Which part of the pipeline descriptor varies between the pipelines created in a step.
+enum class Permutation {
+    VertexLayout,
+    DepthState,
+    VertexLayoutAndDepthState,
+};
+
+unsigned int GetPipelineCount(Permutation permutation) {
+    switch (permutation) {
+        case Permutation::VertexLayout:
+            return kArrayStrides.size();
+        case Permutation::DepthState:
+            return kDepthCompares.size();
+        case Permutation::VertexLayoutAndDepthState:
+            return kArrayStrides.size() * kDepthCompares.size();
+    }
+    DAWN_UNREACHABLE();
+}
+
+std::ostream& operator<<(std::ostream& ostream, const Permutation& permutation) {
+    switch (permutation) {
+        case Permutation::VertexLayout:
+            ostream << "VertexLayout";
+            break;
+        case Permutation::DepthState:
+            ostream << "DepthState";
+            break;
+        case Permutation::VertexLayoutAndDepthState:
+            ostream << "VertexLayoutAndDepthState";
+            break;
+    }
+    return ostream;
+}
+
+struct RenderPipelineCreationParams : AdapterTestParam {
+    RenderPipelineCreationParams(const AdapterTestParam& param, Permutation permutation)
+        : AdapterTestParam(param), permutation(permutation) {}
+    Permutation permutation;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const RenderPipelineCreationParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.permutation;
+    return ostream;
+}
+
+// Measures the cost of creating render pipelines that share their shaders but differ in their
+// vertex layout and/or depth state, which is the common case for engines that create pipeline
+// variants at load time. Pipelines are released at the end of each step so that the frontend
+// cache can't deduplicate them, but backends are free to reuse work across steps.
+class RenderPipelineCreationPerf : public DawnPerfTestWithParams<RenderPipelineCreationParams> {
+  public:
+    RenderPipelineCreationPerf()
+        : DawnPerfTestWithParams<RenderPipelineCreationParams>(
+              GetPipelineCount(GetParam().permutation),
+              1) {}
+    ~RenderPipelineCreationPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::ShaderModule mVertexModule;
+    wgpu::ShaderModule mFragmentModule;
+};
+
+void RenderPipelineCreationPerf::SetUp() {
+    DawnPerfTestWithParams<RenderPipelineCreationParams>::SetUp();
+
+    mVertexModule = utils::CreateShaderModule(device, kVertexShader);
+    mFragmentModule = utils::CreateShaderModule(device, kFragmentShader);
+}
+
+void RenderPipelineCreationPerf::Step() {
+    bool varyVertexLayout = GetParam().permutation != Permutation::DepthState;
+    bool varyDepthState = GetParam().permutation != Permutation::VertexLayout;
+
+    std::vector<wgpu::RenderPipeline> pipelines;
+    pipelines.reserve(GetPipelineCount(GetParam().permutation));
+    for (size_t strideIndex = 0; strideIndex < (varyVertexLayout ? kArrayStrides.size() : 1);
+         ++strideIndex) {
+        for (size_t compareIndex = 0;
+             compareIndex < (varyDepthState ? kDepthCompares.size() : 1); ++compareIndex) {
+            utils::ComboRenderPipelineDescriptor descriptor;
+            descriptor.vertex.module = mVertexModule;
+            descriptor.vertex.bufferCount = 1;
+            descriptor.cBuffers[0].arrayStride = kArrayStrides[strideIndex];
+            descriptor.cBuffers[0].attributeCount = 1;
+            descriptor.cAttributes[0].format = wgpu::VertexFormat::Float32x4;
+            descriptor.cFragment.module = mFragmentModule;
+
+            wgpu::DepthStencilState* depthStencil =
+                descriptor.EnableDepthStencil(wgpu::TextureFormat::Depth32Float);
+            depthStencil->depthWriteEnabled = wgpu::OptionalBool::True;
+            depthStencil->depthCompare = kDepthCompares[compareIndex];
+
+            pipelines.push_back(device.CreateRenderPipeline(&descriptor));
+        }
+    }
+}
+
+TEST_P(RenderPipelineCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(RenderPipelineCreationPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
+                         VulkanBackend({"vulkan_use_graphics_pipeline_library"})},
+                        {Permutation::VertexLayout, Permutation::DepthState,
+                         Permutation::VertexLayoutAndDepthState});
+
+}  // anonymous namespace
+}  // namespace dawn
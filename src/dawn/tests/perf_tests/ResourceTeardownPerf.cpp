@@ -0,0 +1,149 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumObjects = 1024;
+
+// The kind of objects created and destroyed in each step.
+enum class Resources {
+    Buffers,
+    TexturesAndViews,
+};
+
+std::ostream& operator<<(std::ostream& ostream, const Resources& resources) {
+    switch (resources) {
+        case Resources::Buffers:
+            ostream << "Buffers";
+            break;
+        case Resources::TexturesAndViews:
+            ostream << "TexturesAndViews";
+            break;
+    }
+    return ostream;
+}
+
+struct ResourceTeardownParams : AdapterTestParam {
+    ResourceTeardownParams(const AdapterTestParam& param, Resources resources)
+        : AdapterTestParam(param), resources(resources) {}
+    Resources resources;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const ResourceTeardownParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_" << param.resources;
+    return ostream;
+}
+
+// Measures the API thread cost of creating and destroying many resources, including the device
+// ticks that delete the backend objects once the GPU is done with them.
+class ResourceTeardownPerf : public DawnPerfTestWithParams<ResourceTeardownParams> {
+  public:
+    ResourceTeardownPerf() : DawnPerfTestWithParams<ResourceTeardownParams>(kNumObjects, 3) {}
+    ~ResourceTeardownPerf() override = default;
+
+  protected:
+    void ReportDeletionMetrics();
+
+  private:
+    void Step() override;
+};
+
+void ResourceTeardownPerf::Step() {
+    switch (GetParam().resources) {
+        case Resources::Buffers: {
+            std::vector<wgpu::Buffer> buffers;
+            buffers.reserve(kNumObjects);
+            for (unsigned int i = 0; i < kNumObjects; ++i) {
+                wgpu::BufferDescriptor descriptor;
+                descriptor.size = 256;
+                descriptor.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+                buffers.push_back(device.CreateBuffer(&descriptor));
+            }
+            for (wgpu::Buffer& buffer : buffers) {
+                buffer.Destroy();
+            }
+            break;
+        }
+
+        case Resources::TexturesAndViews: {
+            std::vector<wgpu::Texture> textures;
+            std::vector<wgpu::TextureView> views;
+            textures.reserve(kNumObjects);
+            views.reserve(kNumObjects);
+            for (unsigned int i = 0; i < kNumObjects; ++i) {
+                wgpu::TextureDescriptor descriptor;
+                descriptor.size = {16, 16, 1};
+                descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+                descriptor.usage =
+                    wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::CopyDst;
+                textures.push_back(device.CreateTexture(&descriptor));
+                views.push_back(textures.back().CreateView());
+            }
+            views.clear();
+            for (wgpu::Texture& texture : textures) {
+                texture.Destroy();
+            }
+            break;
+        }
+    }
+
+    // Submit so that the objects' serial completes, then tick to delete the objects of the
+    // earlier steps that the GPU is done with.
+    queue.Submit(0, nullptr);
+    device.Tick();
+}
+
+void ResourceTeardownPerf::ReportDeletionMetrics() {
+    native::DeviceMetrics metrics = native::GetDeviceMetrics(backendDevice);
+
+    PrintResult("peak_deferred_deletion_queue_depth",
+                static_cast<double>(metrics.peakDeferredDeletionQueueDepth), "objects", false);
+    PrintResult("peak_background_deletion_queue_depth",
+                static_cast<double>(metrics.peakBackgroundDeletionQueueDepth), "objects", false);
+    PrintResult("background_deletions", static_cast<double>(metrics.backgroundDeletions),
+                "objects", false);
+}
+
+TEST_P(ResourceTeardownPerf, Run) {
+    RunTest();
+    ReportDeletionMetrics();
+}
+
+DAWN_INSTANTIATE_TEST_P(ResourceTeardownPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
+                         VulkanBackend({"vulkan_background_deferred_deletion"})},
+                        {Resources::Buffers, Resources::TexturesAndViews});
+
+}  // anonymous namespace
+}  // namespace dawn
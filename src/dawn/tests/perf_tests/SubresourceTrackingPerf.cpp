@@ -25,6 +25,9 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <sstream>
+#include <vector>
+
 #include "dawn/tests/perf_tests/DawnPerfTest.h"
 
 #include "dawn/utils/ComboRenderPipelineDescriptor.h"
@@ -164,5 +167,116 @@ DAWN_INSTANTIATE_TEST_P(SubresourceTrackingPerf,
                         {1, 4, 16, 256},
                         {2, 3, 8});
 
+struct SingleSubresourceTrackingParams : AdapterTestParam {
+    SingleSubresourceTrackingParams(const AdapterTestParam& param, uint32_t textureCountIn)
+        : AdapterTestParam(param), textureCount(textureCountIn) {}
+    uint32_t textureCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const SingleSubresourceTrackingParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_textures_" << param.textureCount;
+    return ostream;
+}
+
+// Test the performance of usage and barrier tracking for the common case of many textures with a
+// single mip level and array layer. Each texture is written with a copy and then all of them are
+// sampled in the same render pass, so every step transitions each texture twice and the
+// transitions of all the textures for the render pass are batched together.
+class SingleSubresourceTrackingPerf
+    : public DawnPerfTestWithParams<SingleSubresourceTrackingParams> {
+  public:
+    static constexpr unsigned int kNumIterations = 50;
+    static constexpr uint32_t kTextureSize = 64;
+
+    SingleSubresourceTrackingPerf() : DawnPerfTestWithParams(kNumIterations, 1) {}
+    ~SingleSubresourceTrackingPerf() override = default;
+
+    void SetUp() override {
+        DawnPerfTestWithParams<SingleSubresourceTrackingParams>::SetUp();
+        const SingleSubresourceTrackingParams& params = GetParam();
+
+        wgpu::TextureDescriptor textureDesc;
+        textureDesc.size = {kTextureSize, kTextureSize};
+        textureDesc.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::CopyDst;
+        textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+        for (uint32_t i = 0; i < params.textureCount; i++) {
+            mTextures.push_back(device.CreateTexture(&textureDesc));
+        }
+
+        textureDesc.usage = wgpu::TextureUsage::CopySrc;
+        mUploadTexture = device.CreateTexture(&textureDesc);
+
+        textureDesc.usage = wgpu::TextureUsage::RenderAttachment;
+        mRenderTarget = device.CreateTexture(&textureDesc);
+
+        std::ostringstream fs;
+        for (uint32_t i = 0; i < params.textureCount; i++) {
+            fs << "@group(0) @binding(" << i << ") var t" << i << " : texture_2d<f32>;\n";
+        }
+        fs << "@fragment fn main() -> @location(0) vec4f {\n";
+        for (uint32_t i = 0; i < params.textureCount; i++) {
+            fs << "    _ = t" << i << ";\n";
+        }
+        fs << "    return vec4f(1.0, 0.0, 0.0, 1.0);\n}\n";
+
+        utils::ComboRenderPipelineDescriptor pipelineDesc;
+        pipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+            @vertex fn main() -> @builtin(position) vec4f {
+                return vec4f(1.0, 0.0, 0.0, 1.0);
+            }
+        )");
+        pipelineDesc.cFragment.module = utils::CreateShaderModule(device, fs.str().c_str());
+        mPipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+        std::vector<wgpu::BindGroupEntry> entries(params.textureCount);
+        for (uint32_t i = 0; i < params.textureCount; i++) {
+            entries[i].binding = i;
+            entries[i].textureView = mTextures[i].CreateView();
+        }
+        wgpu::BindGroupDescriptor bindGroupDesc;
+        bindGroupDesc.layout = mPipeline.GetBindGroupLayout(0);
+        bindGroupDesc.entryCount = entries.size();
+        bindGroupDesc.entries = entries.data();
+        mBindGroup = device.CreateBindGroup(&bindGroupDesc);
+    }
+
+  private:
+    void Step() override {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+
+        wgpu::ImageCopyTexture sourceView = utils::CreateImageCopyTexture(mUploadTexture);
+        wgpu::Extent3D copySize = {kTextureSize, kTextureSize, 1};
+        for (const wgpu::Texture& texture : mTextures) {
+            wgpu::ImageCopyTexture destView = utils::CreateImageCopyTexture(texture);
+            encoder.CopyTextureToTexture(&sourceView, &destView, &copySize);
+        }
+
+        utils::ComboRenderPassDescriptor renderPass({mRenderTarget.CreateView()});
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(mPipeline);
+        pass.SetBindGroup(0, mBindGroup);
+        pass.Draw(3);
+        pass.End();
+
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+
+    wgpu::Texture mUploadTexture;
+    wgpu::Texture mRenderTarget;
+    std::vector<wgpu::Texture> mTextures;
+    wgpu::RenderPipeline mPipeline;
+    wgpu::BindGroup mBindGroup;
+};
+
+TEST_P(SingleSubresourceTrackingPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(SingleSubresourceTrackingPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
+                        {1, 4, 16});
+
 }  // anonymous namespace
 }  // namespace dawn
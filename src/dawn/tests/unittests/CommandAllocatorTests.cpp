@@ -26,6 +26,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <limits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -513,4 +514,62 @@ TEST(CommandAllocator, AcquireCommandBlocks) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Test that commands are recorded correctly in blocks recycled from destroyed command lists.
+TEST(CommandAllocator, RecycledBlocks) {
+    // Enough commands to use blocks of all the sizes before reaching the maximum block size.
+    const int kCommandCount = 10000;
+
+    CommandBlockPool pool;
+    std::unordered_set<CommandDraw*> firstIterationDraws;
+    for (int iteration = 0; iteration < 3; iteration++) {
+        CommandAllocator allocator(&pool);
+        size_t reusedDrawCount = 0;
+        for (int i = 0; i < kCommandCount; i++) {
+            CommandDraw* draw = allocator.Allocate<CommandDraw>(CommandType::Draw);
+            draw->first = i;
+            draw->count = iteration;
+
+            if (iteration == 0) {
+                firstIterationDraws.insert(draw);
+            } else if (firstIterationDraws.count(draw) != 0) {
+                reusedDrawCount++;
+            }
+        }
+
+        // The pooled blocks of the first iteration are reused by the next ones.
+        if (iteration != 0) {
+            ASSERT_GT(reusedDrawCount, 0u);
+        }
+
+        CommandIterator iterator(std::move(allocator));
+        CommandType type;
+        int numCommands = 0;
+        while (iterator.NextCommandId(&type)) {
+            ASSERT_EQ(type, CommandType::Draw);
+
+            CommandDraw* draw = iterator.NextCommand<CommandDraw>();
+            ASSERT_EQ(draw->first, static_cast<uint32_t>(numCommands));
+            ASSERT_EQ(draw->count, static_cast<uint32_t>(iteration));
+            numCommands++;
+        }
+        ASSERT_EQ(numCommands, kCommandCount);
+
+        // This returns the blocks to the pool for the allocator of the next iteration to reuse.
+        iterator.MakeEmptyAsDataWasDestroyed();
+    }
+
+    // A released block of a pooled size is returned by the next acquisition of that size.
+    std::unique_ptr<char[]> block = pool.Acquire(CommandBlockPool::kMinPooledBlockSize);
+    ASSERT_NE(block, nullptr);
+    char* blockPointer = block.get();
+
+    CommandBlocks blocks;
+    blocks.push_back({CommandBlockPool::kMinPooledBlockSize, std::move(block)});
+    pool.Release(&blocks);
+    ASSERT_TRUE(blocks.empty());
+
+    std::unique_ptr<char[]> recycledBlock = pool.Acquire(CommandBlockPool::kMinPooledBlockSize);
+    ASSERT_EQ(recycledBlock.get(), blockPointer);
+}
+
 }  // namespace dawn::native
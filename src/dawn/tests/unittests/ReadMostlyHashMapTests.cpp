@@ -0,0 +1,150 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dawn/common/ReadMostlyHashMap.h"
+#include "gtest/gtest.h"
+
+namespace dawn {
+namespace {
+
+using TestMap = ReadMostlyHashMap<uint32_t, uint32_t>;
+
+// Hashes every key to the same value to test that colliding keys are still found.
+struct CollidingHash {
+    size_t operator()(uint32_t) const { return 42; }
+};
+
+// An empty map finds nothing.
+TEST(ReadMostlyHashMapTests, Empty) {
+    TestMap map;
+    EXPECT_EQ(map.Size(), 0u);
+    EXPECT_EQ(map.Find(0), nullptr);
+    EXPECT_EQ(map.Find(1), nullptr);
+}
+
+// Inserted values are found and the returned pointers point to them.
+TEST(ReadMostlyHashMapTests, InsertAndFind) {
+    TestMap map;
+    const uint32_t* one = map.Insert(1, 10);
+    const uint32_t* two = map.Insert(2, 20);
+
+    EXPECT_EQ(*one, 10u);
+    EXPECT_EQ(*two, 20u);
+    EXPECT_EQ(map.Find(1), one);
+    EXPECT_EQ(map.Find(2), two);
+    EXPECT_EQ(map.Find(3), nullptr);
+    EXPECT_EQ(map.Size(), 2u);
+}
+
+// Pointers to values stay valid, and all values are still found, when the table grows.
+TEST(ReadMostlyHashMapTests, Growth) {
+    constexpr uint32_t kCount = 1000;
+    TestMap map;
+    std::vector<const uint32_t*> values;
+    for (uint32_t i = 0; i < kCount; ++i) {
+        values.push_back(map.Insert(i, i * 2));
+    }
+
+    for (uint32_t i = 0; i < kCount; ++i) {
+        EXPECT_EQ(map.Find(i), values[i]);
+        EXPECT_EQ(*values[i], i * 2);
+    }
+    EXPECT_EQ(map.Find(kCount), nullptr);
+}
+
+// Keys with the same hash are told apart by the equality function.
+TEST(ReadMostlyHashMapTests, Collisions) {
+    ReadMostlyHashMap<uint32_t, uint32_t, CollidingHash> map;
+    for (uint32_t i = 0; i < 100; ++i) {
+        map.Insert(i, i + 1);
+    }
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        ASSERT_NE(map.Find(i), nullptr);
+        EXPECT_EQ(*map.Find(i), i + 1);
+    }
+    EXPECT_EQ(map.Find(100), nullptr);
+}
+
+// ForEach visits every entry in insertion order.
+TEST(ReadMostlyHashMapTests, ForEach) {
+    TestMap map;
+    map.Insert(3, 30);
+    map.Insert(1, 10);
+    map.Insert(2, 20);
+
+    std::vector<uint32_t> keys;
+    map.ForEach([&](uint32_t key, uint32_t value) {
+        EXPECT_EQ(value, key * 10);
+        keys.push_back(key);
+    });
+    EXPECT_EQ(keys, (std::vector<uint32_t>{3, 1, 2}));
+}
+
+// Readers find either nothing or the right value while a writer inserts and grows the table.
+TEST(ReadMostlyHashMapTests, ConcurrentFindDuringInsert) {
+    constexpr uint32_t kCount = 10000;
+    constexpr size_t kReaderCount = 4;
+    TestMap map;
+    std::atomic<uint32_t> insertedCount{0};
+
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < kReaderCount; ++r) {
+        readers.emplace_back([&] {
+            uint32_t seen = 0;
+            while (seen < kCount) {
+                seen = insertedCount.load(std::memory_order_acquire);
+                for (uint32_t i = 0; i < seen; ++i) {
+                    const uint32_t* value = map.Find(i);
+                    ASSERT_NE(value, nullptr);
+                    ASSERT_EQ(*value, i + 7);
+                }
+                const uint32_t* value = map.Find(kCount + 1);
+                ASSERT_EQ(value, nullptr);
+            }
+        });
+    }
+
+    std::mutex writerMutex;
+    for (uint32_t i = 0; i < kCount; ++i) {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        map.Insert(i, i + 7);
+        insertedCount.store(i + 1, std::memory_order_release);
+    }
+
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+}
+
+}  // anonymous namespace
+}  // namespace dawn
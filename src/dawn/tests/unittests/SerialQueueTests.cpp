@@ -93,6 +93,23 @@ TEST(SerialQueue, EnqueueVectors) {
     ASSERT_TRUE(expectedValues.empty());
 }
 
+// Test Size counts values rather than serials
+TEST(SerialQueue, Size) {
+    TestSerialQueue queue;
+    EXPECT_EQ(queue.Size(), 0u);
+
+    queue.Enqueue(std::vector<int>{1, 2, 3}, 0);
+    queue.Enqueue(4, 0);
+    queue.Enqueue(5, 1);
+    EXPECT_EQ(queue.Size(), 5u);
+
+    queue.ClearUpTo(0);
+    EXPECT_EQ(queue.Size(), 1u);
+
+    queue.Clear();
+    EXPECT_EQ(queue.Size(), 0u);
+}
+
 // Test IterateUpTo
 TEST(SerialQueue, IterateUpTo) {
     TestSerialQueue queue;
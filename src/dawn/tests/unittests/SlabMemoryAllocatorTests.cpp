@@ -0,0 +1,156 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <memory>
+#include <vector>
+
+#include "dawn/native/BuddyMemoryAllocator.h"
+#include "dawn/native/ResourceHeapAllocator.h"
+#include "dawn/native/SlabMemoryAllocator.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+constexpr uint64_t kHeapSize = 1024 * 1024;
+constexpr uint64_t kMaxBuddySize = 4 * kHeapSize;
+constexpr uint64_t kMaxSlabAllocationSize = 64 * 1024;
+
+// The slabs of the smallest size classes are 64KiB.
+constexpr uint64_t kSmallSlabSize = 64 * 1024;
+
+class PlaceholderSlabHeapAllocator : public ResourceHeapAllocator {
+  public:
+    ResultOrError<std::unique_ptr<ResourceHeapBase>> AllocateResourceHeap(uint64_t size) override {
+        return std::make_unique<ResourceHeapBase>();
+    }
+    void DeallocateResourceHeap(std::unique_ptr<ResourceHeapBase> allocation) override {}
+};
+
+class SlabMemoryAllocatorTests : public testing::Test {
+  protected:
+    ResourceMemoryAllocation Allocate(uint64_t allocationSize, uint64_t alignment = 1) {
+        ResultOrError<ResourceMemoryAllocation> result =
+            mSlabAllocator.Allocate(allocationSize, alignment);
+        return (result.IsSuccess()) ? result.AcquireSuccess() : ResourceMemoryAllocation{};
+    }
+
+    PlaceholderSlabHeapAllocator mHeapAllocator;
+    BuddyMemoryAllocator mBuddyAllocator{kMaxBuddySize, kHeapSize, &mHeapAllocator};
+    SlabMemoryAllocator mSlabAllocator{&mBuddyAllocator, kMaxSlabAllocationSize, 1};
+};
+
+// Allocations are rounded up to the next size class instead of the next power of two.
+TEST_F(SlabMemoryAllocatorTests, RoundsUpToSizeClass) {
+    ResourceMemoryAllocation allocation1 = Allocate(300);
+    ResourceMemoryAllocation allocation2 = Allocate(300);
+    ASSERT_EQ(allocation1.GetInfo().mMethod, AllocationMethod::kSubAllocated);
+    ASSERT_EQ(allocation2.GetInfo().mMethod, AllocationMethod::kSubAllocated);
+
+    // 300 bytes fit in the 320 byte size class.
+    EXPECT_EQ(allocation1.GetResourceHeap(), allocation2.GetResourceHeap());
+    EXPECT_EQ(allocation2.GetOffset() - allocation1.GetOffset(), 320u);
+    EXPECT_EQ(mSlabAllocator.GetSlabBytesInUse(), 640u);
+    EXPECT_EQ(mSlabAllocator.GetSlabBytes(), kSmallSlabSize);
+
+    EXPECT_TRUE(mSlabAllocator.Deallocate(allocation1));
+    EXPECT_TRUE(mSlabAllocator.Deallocate(allocation2));
+    EXPECT_EQ(mSlabAllocator.GetSlabBytesInUse(), 0u);
+}
+
+// Slots of size classes that aren't a multiple of the alignment are skipped.
+TEST_F(SlabMemoryAllocatorTests, SizeClassRespectsAlignment) {
+    ResourceMemoryAllocation allocation1 = Allocate(300, 256);
+    ResourceMemoryAllocation allocation2 = Allocate(300, 256);
+
+    EXPECT_EQ(allocation1.GetOffset() % 256, 0u);
+    EXPECT_EQ(allocation2.GetOffset() - allocation1.GetOffset(), 512u);
+
+    EXPECT_TRUE(mSlabAllocator.Deallocate(allocation1));
+    EXPECT_TRUE(mSlabAllocator.Deallocate(allocation2));
+}
+
+// Freed slots are reused by the next allocation of the same size class.
+TEST_F(SlabMemoryAllocatorTests, ReusesFreedSlots) {
+    ResourceMemoryAllocation allocation1 = Allocate(1000);
+    ResourceMemoryAllocation allocation2 = Allocate(1000);
+    uint64_t offset1 = allocation1.GetOffset();
+
+    EXPECT_TRUE(mSlabAllocator.Deallocate(allocation1));
+    ResourceMemoryAllocation allocation3 = Allocate(1000);
+    EXPECT_EQ(allocation3.GetOffset(), offset1);
+
+    EXPECT_TRUE(mSlabAllocator.Deallocate(allocation2));
+    EXPECT_TRUE(mSlabAllocator.Deallocate(allocation3));
+}
+
+// A new slab is allocated when all the slots of a size class are used, and empty slabs are
+// returned to the buddy allocator except for one per size class.
+TEST_F(SlabMemoryAllocatorTests, SlabLifetime) {
+    constexpr uint64_t kSlotsPerSlab = kSmallSlabSize / SlabMemoryAllocator::kMinSlotSize;
+
+    std::vector<ResourceMemoryAllocation> allocations;
+    for (uint64_t i = 0; i < kSlotsPerSlab; ++i) {
+        allocations.push_back(Allocate(SlabMemoryAllocator::kMinSlotSize));
+    }
+    EXPECT_EQ(mSlabAllocator.GetSlabBytes(), kSmallSlabSize);
+
+    allocations.push_back(Allocate(SlabMemoryAllocator::kMinSlotSize));
+    EXPECT_EQ(mSlabAllocator.GetSlabBytes(), 2 * kSmallSlabSize);
+    EXPECT_EQ(mBuddyAllocator.ComputeTotalNumOfHeapsForTesting(), 1u);
+
+    for (const ResourceMemoryAllocation& allocation : allocations) {
+        EXPECT_TRUE(mSlabAllocator.Deallocate(allocation));
+    }
+    EXPECT_EQ(mSlabAllocator.GetSlabBytes(), kSmallSlabSize);
+    EXPECT_EQ(mSlabAllocator.GetSlabBytesInUse(), 0u);
+
+    mSlabAllocator.ReleaseEmptySlabs();
+    EXPECT_EQ(mSlabAllocator.GetSlabBytes(), 0u);
+    EXPECT_EQ(mBuddyAllocator.ComputeTotalNumOfHeapsForTesting(), 0u);
+}
+
+// Allocations larger than the maximum are left to the buddy allocator, and the slab allocator
+// doesn't claim the buddy allocations.
+TEST_F(SlabMemoryAllocatorTests, LargeAllocationsAreNotServed) {
+    ResourceMemoryAllocation invalidAllocation = Allocate(kMaxSlabAllocationSize + 1);
+    EXPECT_EQ(invalidAllocation.GetInfo().mMethod, AllocationMethod::kInvalid);
+
+    ResourceMemoryAllocation slabAllocation = Allocate(kMaxSlabAllocationSize);
+    ASSERT_EQ(slabAllocation.GetInfo().mMethod, AllocationMethod::kSubAllocated);
+
+    ResultOrError<ResourceMemoryAllocation> buddyResult =
+        mBuddyAllocator.Allocate(kMaxSlabAllocationSize + 1, 1);
+    ASSERT_TRUE(buddyResult.IsSuccess());
+    ResourceMemoryAllocation buddyAllocation = buddyResult.AcquireSuccess();
+    EXPECT_FALSE(mSlabAllocator.Deallocate(buddyAllocation));
+    mBuddyAllocator.Deallocate(buddyAllocation);
+
+    EXPECT_TRUE(mSlabAllocator.Deallocate(slabAllocation));
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
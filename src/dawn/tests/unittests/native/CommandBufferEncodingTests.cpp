@@ -32,6 +32,7 @@
 #include "dawn/native/Commands.h"
 #include "dawn/native/ComputePassEncoder.h"
 #include "dawn/tests/DawnNativeTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
 #include "dawn/utils/WGPUHelpers.h"
 
 namespace dawn::native {
@@ -321,5 +322,85 @@ TEST_F(CommandBufferEncodingTests, StateNotLeakedAfterRestore) {
     EXPECT_FALSE(stateTracker->HasPipeline());
 }
 
+// Test that the indirect draw validation of a render pass is encoded as a single compute pass
+// regardless of the number of indirect buffers used, and that identical indirect draws are only
+// validated once.
+TEST_F(CommandBufferEncodingTests, IndirectDrawValidationIsBatched) {
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main() -> @builtin(position) vec4f {
+            return vec4f();
+        })");
+    pipelineDesc.cFragment.module = utils::CreateShaderModule(device, R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f();
+        })");
+    pipelineDesc.cTargets[0].format = utils::BasicRenderPass::kDefaultColorFormat;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    wgpu::Buffer indexBuffer =
+        utils::CreateBufferFromData<uint32_t>(device, wgpu::BufferUsage::Index, {0, 1, 2});
+    wgpu::Buffer indirectBuffer0 = utils::CreateBufferFromData<uint32_t>(
+        device, wgpu::BufferUsage::Indirect, {3, 1, 0, 0, 0, 3, 1, 0, 0, 0});
+    wgpu::Buffer indirectBuffer1 = utils::CreateBufferFromData<uint32_t>(
+        device, wgpu::BufferUsage::Indirect, {3, 1, 0, 0, 0});
+
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 4, 4);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.SetPipeline(pipeline);
+    pass.SetIndexBuffer(indexBuffer, wgpu::IndexFormat::Uint32);
+    pass.DrawIndexedIndirect(indirectBuffer0, 0);
+    pass.DrawIndexedIndirect(indirectBuffer0, 0);
+    pass.DrawIndexedIndirect(indirectBuffer0, 20);
+    pass.DrawIndexedIndirect(indirectBuffer1, 0);
+    pass.End();
+    wgpu::CommandBuffer commandBuffer = encoder.Finish();
+
+    uint32_t computePassCount = 0;
+    uint32_t setValidationPipelineCount = 0;
+    uint32_t dispatchCount = 0;
+    std::vector<uint64_t> validatedIndirectOffsets;
+
+    CommandIterator* commands = FromAPI(commandBuffer.Get())->GetCommandIteratorForTesting();
+    Command commandId;
+    while (commands->NextCommandId(&commandId)) {
+        switch (commandId) {
+            case Command::BeginComputePass:
+                computePassCount++;
+                SkipCommand(commands, commandId);
+                break;
+            case Command::SetComputePipeline:
+                setValidationPipelineCount++;
+                SkipCommand(commands, commandId);
+                break;
+            case Command::Dispatch:
+                dispatchCount++;
+                SkipCommand(commands, commandId);
+                break;
+            case Command::DrawIndexedIndirect: {
+                auto* cmd = commands->NextCommand<DrawIndexedIndirectCmd>();
+                validatedIndirectOffsets.push_back(cmd->indirectOffset);
+                break;
+            }
+            default:
+                SkipCommand(commands, commandId);
+                break;
+        }
+    }
+
+    // One validation pass, with one dispatch per indirect buffer.
+    EXPECT_EQ(computePassCount, 1u);
+    EXPECT_EQ(setValidationPipelineCount, 1u);
+    EXPECT_EQ(dispatchCount, 2u);
+
+    // The two identical draws share their validated parameters.
+    ASSERT_EQ(validatedIndirectOffsets.size(), 4u);
+    EXPECT_EQ(validatedIndirectOffsets[0], validatedIndirectOffsets[1]);
+    EXPECT_NE(validatedIndirectOffsets[0], validatedIndirectOffsets[2]);
+    EXPECT_NE(validatedIndirectOffsets[2], validatedIndirectOffsets[3]);
+}
+
 }  // anonymous namespace
 }  // namespace dawn::native
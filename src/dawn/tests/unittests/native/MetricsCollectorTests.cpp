@@ -0,0 +1,118 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <memory>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/native/MetricsCollector.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/tests/DawnNativeTest.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+// A platform with a clock that only advances when told to.
+class ManualClockPlatform : public dawn::platform::Platform {
+  public:
+    double MonotonicallyIncreasingTime() override { return mTime; }
+    void Advance(double seconds) { mTime += seconds; }
+
+  private:
+    double mTime = 1.0;
+};
+
+TEST(MetricsCollectorTests, Counters) {
+    ManualClockPlatform platform;
+    MetricsCollector metrics(&platform);
+
+    metrics.RecordPipelineCacheHit();
+    double start = metrics.Now();
+    platform.Advance(0.002);
+    metrics.RecordPipelineCompilation(start);
+
+    metrics.RecordBlobCacheLoad(0);
+    metrics.RecordBlobCacheLoad(100);
+    metrics.RecordBlobCacheStore(40);
+
+    DeviceMetrics result = metrics.GetMetrics();
+    EXPECT_EQ(result.pipelineCacheHits, 1u);
+    EXPECT_EQ(result.pipelineCompilations, 1u);
+    EXPECT_NEAR(static_cast<double>(result.pipelineCompilationMicroseconds), 2000.0, 1.0);
+    EXPECT_EQ(result.blobCacheHits, 1u);
+    EXPECT_EQ(result.blobCacheMisses, 1u);
+    EXPECT_EQ(result.blobCacheBytesLoaded, 100u);
+    EXPECT_EQ(result.blobCacheBytesStored, 40u);
+}
+
+// Gauges report their latest value and keep track of the peak.
+TEST(MetricsCollectorTests, Gauges) {
+    ManualClockPlatform platform;
+    MetricsCollector metrics(&platform);
+
+    metrics.RecordDeferredDeletionQueueDepth(5);
+    metrics.RecordDeferredDeletionQueueDepth(12);
+    metrics.RecordDeferredDeletionQueueDepth(3);
+    metrics.RecordUploaderRingBufferCount(2);
+    metrics.RecordUploaderRingBufferCount(1);
+
+    DeviceMetrics result = metrics.GetMetrics();
+    EXPECT_EQ(result.deferredDeletionQueueDepth, 3u);
+    EXPECT_EQ(result.peakDeferredDeletionQueueDepth, 12u);
+    EXPECT_EQ(result.uploaderRingBufferCount, 1u);
+    EXPECT_EQ(result.uploaderPeakRingBufferCount, 2u);
+}
+
+// Durations are left at 0 when the platform has no clock.
+TEST(MetricsCollectorTests, NoClock) {
+    dawn::platform::Platform platform;
+    MetricsCollector metrics(&platform);
+
+    double start = metrics.Now();
+    metrics.RecordSubmit(start, 3);
+
+    DeviceMetrics result = metrics.GetMetrics();
+    EXPECT_EQ(result.submits, 1u);
+    EXPECT_EQ(result.commandBuffersSubmitted, 3u);
+    EXPECT_EQ(result.submitMicroseconds, 0u);
+}
+
+using DeviceMetricsTests = DawnNativeTest;
+
+// Encoding and submitting work is reported by GetDeviceMetrics.
+TEST_F(DeviceMetricsTests, FinishAndSubmit) {
+    wgpu::CommandBuffer commands = device.CreateCommandEncoder().Finish();
+    device.GetQueue().Submit(1, &commands);
+
+    DeviceMetrics result = GetDeviceMetrics(device.Get());
+    EXPECT_EQ(result.commandBuffersFinished, 1u);
+    EXPECT_EQ(result.submits, 1u);
+    EXPECT_EQ(result.commandBuffersSubmitted, 1u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
@@ -0,0 +1,113 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <memory>
+
+#include "dawn/dawn_proc.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/WGPUHelpers.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+class NullBackendTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        dawnProcSetProcs(&GetProcs());
+
+        WGPUInstanceDescriptor instanceDesc = {};
+        instance = std::make_unique<Instance>(&instanceDesc);
+
+        wgpu::RequestAdapterOptions options = {};
+        options.backendType = wgpu::BackendType::Null;
+        Adapter adapter = instance->EnumerateAdapters(&options)[0];
+        ASSERT_NE(adapter.Get(), nullptr);
+
+        const char* executeCommandsToggle = "null_backend_execute_commands";
+        wgpu::DawnTogglesDescriptor deviceTogglesDesc = {};
+        deviceTogglesDesc.enabledToggleCount = 1;
+        deviceTogglesDesc.enabledToggles = &executeCommandsToggle;
+        wgpu::DeviceDescriptor deviceDesc = {};
+        deviceDesc.nextInChain = &deviceTogglesDesc;
+        device = wgpu::Device::Acquire(adapter.CreateDevice(&deviceDesc));
+        ASSERT_NE(device, nullptr);
+    }
+
+    void TearDown() override {
+        device = nullptr;
+        instance = nullptr;
+        dawnProcSetProcs(nullptr);
+    }
+
+    void WaitForAllOperations() {
+        do {
+            DeviceTick(device.Get());
+        } while (InstanceProcessEvents(instance->Get()));
+    }
+
+    std::unique_ptr<Instance> instance;
+    wgpu::Device device;
+};
+
+// Test that the null backend executes the buffer copies and clears on submit so that their results
+// can be read back.
+TEST_F(NullBackendTest, ExecutesBufferCommands) {
+    wgpu::Buffer source = utils::CreateBufferFromData<uint32_t>(
+        device, wgpu::BufferUsage::CopySrc, {1u, 2u, 3u, 4u});
+
+    wgpu::BufferDescriptor descriptor;
+    descriptor.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
+    descriptor.size = 4 * sizeof(uint32_t);
+    wgpu::Buffer destination = device.CreateBuffer(&descriptor);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    encoder.CopyBufferToBuffer(source, 0, destination, 0, descriptor.size);
+    encoder.ClearBuffer(destination, sizeof(uint32_t), sizeof(uint32_t));
+    wgpu::CommandBuffer commands = encoder.Finish();
+    device.GetQueue().Submit(1, &commands);
+
+    bool done = false;
+    destination.MapAsync(wgpu::MapMode::Read, 0, descriptor.size,
+                         wgpu::CallbackMode::AllowProcessEvents,
+                         [&done](wgpu::MapAsyncStatus status, wgpu::StringView) {
+                             EXPECT_EQ(status, wgpu::MapAsyncStatus::Success);
+                             done = true;
+                         });
+    WaitForAllOperations();
+    ASSERT_TRUE(done);
+
+    const uint32_t* data = static_cast<const uint32_t*>(destination.GetConstMappedRange());
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data[0], 1u);
+    EXPECT_EQ(data[1], 0u);
+    EXPECT_EQ(data[2], 3u);
+    EXPECT_EQ(data[3], 4u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
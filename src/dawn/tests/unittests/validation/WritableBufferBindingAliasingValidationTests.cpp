@@ -642,6 +642,26 @@ TEST_F(WritableBufferBindingAliasingValidationTests, SetBindGroupLazyAspectDynam
         renderPassEncoder.End();
         commandEncoder.Finish();
     }
+
+    // rebinding the same bind group with invalid dynamic offsets after a valid draw is invalid
+    {
+        wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder = commandEncoder.BeginRenderPass(&renderPass);
+        renderPassEncoder.SetPipeline(renderPipeline);
+
+        std::vector<uint32_t> dynamicOffsetsValid = {0, 0};
+        std::vector<uint32_t> dynamicOffsetsInvalid = {0, 256};
+
+        renderPassEncoder.SetBindGroup(0, bindGroups[0], dynamicOffsetsValid.size(),
+                                       dynamicOffsetsValid.data());
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.SetBindGroup(0, bindGroups[0], dynamicOffsetsInvalid.size(),
+                                       dynamicOffsetsInvalid.data());
+        renderPassEncoder.Draw(3);
+
+        renderPassEncoder.End();
+        ASSERT_DEVICE_ERROR(commandEncoder.Finish());
+    }
 }
 
 }  // anonymous namespace
@@ -0,0 +1,208 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/SharedMemoryTransferService.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+constexpr size_t kMinQueueWriteSize = 64;
+constexpr size_t kQueueWriteRingSize = 4 * kMinQueueWriteSize;
+
+class WireSharedMemoryTransferServiceTests : public WireTest {
+  public:
+    WireSharedMemoryTransferServiceTests()
+        : mServices(CreateSharedMemoryTransferServices(kMinQueueWriteSize, kQueueWriteRingSize)) {}
+
+  protected:
+    client::MemoryTransferService* GetClientMemoryTransferService() override {
+        return mServices.client.get();
+    }
+    server::MemoryTransferService* GetServerMemoryTransferService() override {
+        return mServices.server.get();
+    }
+
+    void SetUp() override {
+        WireTest::SetUp();
+
+        WGPUBufferDescriptor descriptor = {};
+        descriptor.size = 4 * kMinQueueWriteSize;
+        descriptor.usage = WGPUBufferUsage_CopyDst;
+        buffer = wgpuDeviceCreateBuffer(cDevice, &descriptor);
+
+        apiBuffer = api.GetNewBuffer();
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+        FlushClient();
+    }
+
+    // Writes |size| bytes to the buffer and checks that the server receives the same data. Returns
+    // the pointer to the data that the server received.
+    const void* TestQueueWriteBuffer(size_t size) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<uint8_t>(i + 1);
+        }
+
+        const void* receivedData = nullptr;
+        wgpuQueueWriteBuffer(cQueue, buffer, 4, data.data(), size);
+        EXPECT_CALL(api, QueueWriteBuffer(apiQueue, apiBuffer, 4, _, size))
+            .WillOnce(Invoke([&](WGPUQueue, WGPUBuffer, uint64_t, const void* serverData,
+                                 size_t serverSize) {
+                EXPECT_EQ(0, memcmp(serverData, data.data(), serverSize));
+                receivedData = serverData;
+            }));
+        FlushClient();
+        return receivedData;
+    }
+
+    SharedMemoryTransferServices mServices;
+    WGPUBuffer buffer;
+    WGPUBuffer apiBuffer;
+};
+
+// Test that small queue writes are still inlined in the command stream.
+TEST_F(WireSharedMemoryTransferServiceTests, SmallQueueWriteBuffer) {
+    EXPECT_FALSE(mServices.client->ShouldUseWriteHandleForQueueWrite(kMinQueueWriteSize - 1));
+    TestQueueWriteBuffer(kMinQueueWriteSize - 1);
+}
+
+// Test that large queue writes go through shared memory and reach the server intact.
+TEST_F(WireSharedMemoryTransferServiceTests, LargeQueueWriteBuffer) {
+    EXPECT_TRUE(mServices.client->ShouldUseWriteHandleForQueueWrite(kMinQueueWriteSize));
+    TestQueueWriteBuffer(kMinQueueWriteSize);
+    TestQueueWriteBuffer(3 * kMinQueueWriteSize);
+}
+
+// Test that the memory of queue writes is reused once the server has read their data.
+TEST_F(WireSharedMemoryTransferServiceTests, QueueWriteMemoryIsReused) {
+    const void* firstData = TestQueueWriteBuffer(kMinQueueWriteSize);
+    EXPECT_EQ(firstData, TestQueueWriteBuffer(kMinQueueWriteSize));
+
+    // Writes larger than the ring still reach the server intact.
+    TestQueueWriteBuffer(3 * kMinQueueWriteSize);
+    for (int i = 0; i < 8; ++i) {
+        TestQueueWriteBuffer(kMinQueueWriteSize + i * 16);
+    }
+}
+
+// Test that queue write handles that are allocated while others are still in flight don't share
+// their memory.
+TEST_F(WireSharedMemoryTransferServiceTests, InFlightQueueWriteHandles) {
+    std::vector<std::unique_ptr<client::MemoryTransferService::WriteHandle>> handles;
+    for (size_t i = 0; i < 6; ++i) {
+        handles.emplace_back(mServices.client->CreateQueueWriteHandle(kMinQueueWriteSize));
+        ASSERT_NE(handles.back(), nullptr);
+        memset(handles.back()->GetData(), static_cast<int>(i), kMinQueueWriteSize);
+    }
+    for (size_t i = 0; i < handles.size(); ++i) {
+        const uint8_t* data = static_cast<const uint8_t*>(handles[i]->GetData());
+        for (size_t j = 0; j < kMinQueueWriteSize; ++j) {
+            ASSERT_EQ(data[j], i);
+        }
+    }
+}
+
+// Test that handles that were sent but not received by the server are released when the client is
+// disconnected.
+TEST_F(WireSharedMemoryTransferServiceTests, UnreceivedHandlesReleasedOnDisconnect) {
+    std::unique_ptr<client::MemoryTransferService::WriteHandle> clientHandle(
+        mServices.client->CreateQueueWriteHandle(kMinQueueWriteSize));
+    ASSERT_NE(clientHandle, nullptr);
+
+    std::vector<char> createInfo(clientHandle->SerializeCreateSize());
+    clientHandle->SerializeCreate(createInfo.data());
+
+    GetWireClient()->Disconnect();
+
+    server::MemoryTransferService::WriteHandle* serverHandle = nullptr;
+    EXPECT_FALSE(mServices.server->DeserializeWriteHandle(createInfo.data(), createInfo.size(),
+                                                          &serverHandle));
+}
+
+// Test that data the server writes in a read handle is visible to the client without any data
+// being serialized.
+TEST_F(WireSharedMemoryTransferServiceTests, ReadHandleRoundTrip) {
+    constexpr size_t kSize = 16;
+    std::unique_ptr<client::MemoryTransferService::ReadHandle> clientHandle(
+        mServices.client->CreateReadHandle(kSize));
+    ASSERT_NE(clientHandle, nullptr);
+
+    std::vector<char> createInfo(clientHandle->SerializeCreateSize());
+    clientHandle->SerializeCreate(createInfo.data());
+
+    server::MemoryTransferService::ReadHandle* serverHandlePtr = nullptr;
+    ASSERT_TRUE(mServices.server->DeserializeReadHandle(createInfo.data(), createInfo.size(),
+                                                        &serverHandlePtr));
+    std::unique_ptr<server::MemoryTransferService::ReadHandle> serverHandle(serverHandlePtr);
+
+    std::array<uint8_t, 8> data = {1, 2, 3, 4, 5, 6, 7, 8};
+    ASSERT_EQ(0u, serverHandle->SizeOfSerializeDataUpdate(4, data.size()));
+    serverHandle->SerializeDataUpdate(data.data(), 4, data.size(), nullptr);
+
+    EXPECT_TRUE(clientHandle->DeserializeDataUpdate(nullptr, 0, 4, data.size()));
+    EXPECT_EQ(0, memcmp(static_cast<const uint8_t*>(clientHandle->GetData()) + 4, data.data(),
+                        data.size()));
+
+    // Out-of-bounds updates are rejected.
+    EXPECT_FALSE(clientHandle->DeserializeDataUpdate(nullptr, 0, kSize - 4, data.size()));
+}
+
+// Test that the server rejects handles that were not exported, or were already imported.
+TEST_F(WireSharedMemoryTransferServiceTests, InvalidHandle) {
+    std::unique_ptr<client::MemoryTransferService::WriteHandle> clientHandle(
+        mServices.client->CreateWriteHandle(16));
+    ASSERT_NE(clientHandle, nullptr);
+
+    std::vector<char> createInfo(clientHandle->SerializeCreateSize());
+    clientHandle->SerializeCreate(createInfo.data());
+
+    server::MemoryTransferService::WriteHandle* serverHandle = nullptr;
+    EXPECT_FALSE(mServices.server->DeserializeWriteHandle(createInfo.data(),
+                                                          createInfo.size() - 1, &serverHandle));
+
+    ASSERT_TRUE(mServices.server->DeserializeWriteHandle(createInfo.data(), createInfo.size(),
+                                                         &serverHandle));
+    delete serverHandle;
+
+    EXPECT_FALSE(mServices.server->DeserializeWriteHandle(createInfo.data(), createInfo.size(),
+                                                          &serverHandle));
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -389,6 +389,95 @@ TEST_P(ShaderModuleTests, CreateComputePipelineAsync) {
     EXPECT_FALSE(shaderModule->GetTintProgramForTesting());
 }
 
+// Check that pipelines which only differ by their override values share the program reduced to
+// their entry point instead of each stripping and renaming the whole module again.
+TEST_P(ShaderModuleTests, OverridePermutationsShareSpecializableProgram) {
+    // Only the Vulkan backend specializes from a shared per-entry-point program.
+    DAWN_TEST_UNSUPPORTED_IF(!IsVulkan());
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
+        override value : u32;
+        struct SSBO {
+            value : u32
+        }
+        @group(0) @binding(0) var<storage, read_write> ssbo : SSBO;
+
+        @compute @workgroup_size(1) fn main() {
+            ssbo.value = value;
+        }
+
+        @compute @workgroup_size(1) fn other() {
+            ssbo.value = value + 1u;
+        }
+
+        @compute @workgroup_size(1) fn noOverrides() {
+            ssbo.value = 0u;
+        })");
+
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+    EXPECT_EQ(shaderModule->GetTintProgram()->GetSpecializableProgramCountForTesting(), 0u);
+
+    auto bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Storage}});
+    wgpu::PipelineLayout layout = utils::MakeBasicPipelineLayout(device, &bgl);
+
+    std::vector<wgpu::ComputePipeline> pipelines;
+    for (uint32_t i = 0; i < 4; ++i) {
+        wgpu::ConstantEntry constant;
+        constant.key = "value";
+        constant.value = i;
+
+        wgpu::ComputePipelineDescriptor csDesc;
+        csDesc.layout = layout;
+        csDesc.compute.module = module;
+        csDesc.compute.entryPoint = "main";
+        csDesc.compute.constantCount = 1;
+        csDesc.compute.constants = &constant;
+        pipelines.push_back(device.CreateComputePipeline(&csDesc));
+    }
+    EXPECT_EQ(shaderModule->GetTintProgram()->GetSpecializableProgramCountForTesting(), 1u);
+
+    wgpu::ConstantEntry constant;
+    constant.key = "value";
+    constant.value = 0;
+
+    wgpu::ComputePipelineDescriptor csDesc;
+    csDesc.layout = layout;
+    csDesc.compute.module = module;
+    csDesc.compute.entryPoint = "other";
+    csDesc.compute.constantCount = 1;
+    csDesc.compute.constants = &constant;
+    pipelines.push_back(device.CreateComputePipeline(&csDesc));
+    EXPECT_EQ(shaderModule->GetTintProgram()->GetSpecializableProgramCountForTesting(), 2u);
+
+    // `noOverrides` doesn't use any override, but the module declares one that can't be converted
+    // to Tint IR, so it is also reduced to its entry point on the AST.
+    csDesc.compute.entryPoint = "noOverrides";
+    csDesc.compute.constantCount = 0;
+    csDesc.compute.constants = nullptr;
+    pipelines.push_back(device.CreateComputePipeline(&csDesc));
+    EXPECT_EQ(shaderModule->GetTintProgram()->GetSpecializableProgramCountForTesting(), 3u);
+
+    // Modules without overrides are reduced to the entry point on the Tint IR instead.
+    wgpu::ShaderModule moduleWithoutOverrides = utils::CreateShaderModule(device, R"(
+        struct SSBO {
+            value : u32
+        }
+        @group(0) @binding(0) var<storage, read_write> ssbo : SSBO;
+
+        @compute @workgroup_size(1) fn main() {
+            ssbo.value = 0u;
+        })");
+    Ref<ShaderModuleBase> shaderModuleWithoutOverrides(FromAPI(moduleWithoutOverrides.Get()));
+
+    csDesc.compute.module = moduleWithoutOverrides;
+    csDesc.compute.entryPoint = "main";
+    pipelines.push_back(device.CreateComputePipeline(&csDesc));
+    EXPECT_EQ(
+        shaderModuleWithoutOverrides->GetTintProgram()->GetSpecializableProgramCountForTesting(),
+        0u);
+}
+
 DAWN_INSTANTIATE_TEST(ShaderModuleTests,
                       D3D11Backend(),
                       D3D12Backend(),
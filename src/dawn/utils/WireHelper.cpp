@@ -40,6 +40,7 @@
 #include "dawn/native/DawnNative.h"
 #include "dawn/utils/TerribleCommandBuffer.h"
 #include "dawn/utils/WireHelper.h"
+#include "dawn/wire/SharedMemoryTransferService.h"
 #include "dawn/wire/WireClient.h"
 #include "dawn/wire/WireServer.h"
 #include "partition_alloc/pointers/raw_ptr.h"
@@ -111,13 +112,18 @@ class WireHelperDirect : public WireHelper {
 
 class WireHelperProxy : public WireHelper {
   public:
-    explicit WireHelperProxy(const char* wireTraceDir, const DawnProcTable& procs) {
+    WireHelperProxy(const char* wireTraceDir, const DawnProcTable& procs, bool useSharedMemory) {
         mC2sBuf = std::make_unique<dawn::utils::TerribleCommandBuffer>();
         mS2cBuf = std::make_unique<dawn::utils::TerribleCommandBuffer>();
 
+        if (useSharedMemory) {
+            mSharedMemoryTransferServices = dawn::wire::CreateSharedMemoryTransferServices();
+        }
+
         dawn::wire::WireServerDescriptor serverDesc = {};
         serverDesc.procs = &procs;
         serverDesc.serializer = mS2cBuf.get();
+        serverDesc.memoryTransferService = mSharedMemoryTransferServices.server.get();
 
         mWireServer.reset(new dawn::wire::WireServer(serverDesc));
         mC2sBuf->SetHandler(mWireServer.get());
@@ -129,6 +135,7 @@ class WireHelperProxy : public WireHelper {
 
         dawn::wire::WireClientDescriptor clientDesc = {};
         clientDesc.serializer = mC2sBuf.get();
+        clientDesc.memoryTransferService = mSharedMemoryTransferServices.client.get();
 
         mWireClient.reset(new dawn::wire::WireClient(clientDesc));
         mS2cBuf->SetHandler(mWireClient.get());
@@ -165,6 +172,8 @@ class WireHelperProxy : public WireHelper {
   private:
     std::unique_ptr<dawn::utils::TerribleCommandBuffer> mC2sBuf;
     std::unique_ptr<dawn::utils::TerribleCommandBuffer> mS2cBuf;
+    // Declared before the wire server and client so that it outlives them.
+    dawn::wire::SharedMemoryTransferServices mSharedMemoryTransferServices;
     std::unique_ptr<dawn::wire::WireServer> mWireServer;
     std::unique_ptr<dawn::wire::WireClient> mWireClient;
     std::unique_ptr<WireServerTraceLayer> mWireServerTraceLayer;
@@ -185,9 +194,11 @@ std::pair<wgpu::Instance, std::unique_ptr<dawn::native::Instance>> WireHelper::C
 
 std::unique_ptr<WireHelper> CreateWireHelper(const DawnProcTable& procs,
                                              bool useWire,
-                                             const char* wireTraceDir) {
+                                             const char* wireTraceDir,
+                                             bool useSharedMemory) {
     if (useWire) {
-        return std::unique_ptr<WireHelper>(new WireHelperProxy(wireTraceDir, procs));
+        return std::unique_ptr<WireHelper>(
+            new WireHelperProxy(wireTraceDir, procs, useSharedMemory));
     } else {
         return std::unique_ptr<WireHelper>(new WireHelperDirect(procs));
     }
@@ -67,9 +67,12 @@ class WireHelper {
     virtual bool IsIdle() = 0;
 };
 
+// When |useSharedMemory| is true, the wire transfers buffer mapping and large queue write data
+// through shared memory instead of the command stream.
 std::unique_ptr<WireHelper> CreateWireHelper(const DawnProcTable& procs,
                                              bool useWire,
-                                             const char* wireTraceDir = nullptr);
+                                             const char* wireTraceDir = nullptr,
+                                             bool useSharedMemory = false);
 
 }  // namespace dawn::utils
 
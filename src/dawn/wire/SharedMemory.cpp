@@ -0,0 +1,209 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/SharedMemory.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+#include "dawn/common/Platform.h"
+
+#if DAWN_PLATFORM_IS(LINUX) && !DAWN_PLATFORM_IS(ANDROID)
+#include <sys/mman.h>
+#include <unistd.h>
+#define DAWN_WIRE_USE_MEMFD 1
+#endif
+
+namespace dawn::wire {
+
+// static
+Ref<SharedMemoryRegion> SharedMemoryRegion::Create(size_t size) {
+    // Zero-sized mappings aren't allowed, always allocate at least a byte.
+    size_t allocationSize = size > 0 ? size : 1;
+
+#if defined(DAWN_WIRE_USE_MEMFD)
+    int fd = memfd_create("dawn_wire_shared_memory", MFD_CLOEXEC);
+    if (fd >= 0) {
+        // Growing the file zero-fills it.
+        if (ftruncate(fd, static_cast<off_t>(allocationSize)) == 0) {
+            void* data =
+                mmap(nullptr, allocationSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (data != MAP_FAILED) {
+                return AcquireRef(new SharedMemoryRegion(data, size, fd));
+            }
+        }
+        close(fd);
+    }
+    // Fall back to the heap if memfds are unavailable, for example in a sandbox.
+#endif
+
+    void* data = calloc(allocationSize, 1);
+    if (data == nullptr) {
+        return nullptr;
+    }
+    return AcquireRef(new SharedMemoryRegion(data, size, -1));
+}
+
+SharedMemoryRegion::SharedMemoryRegion(void* data, size_t size, int fd)
+    : mData(data), mSize(size), mFd(fd) {}
+
+SharedMemoryRegion::SharedMemoryRegion(Ref<SharedMemoryRing> ring, void* data, size_t size)
+    : mData(data), mSize(size), mRing(std::move(ring)) {}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+    if (mRing != nullptr) {
+        mRing->ReleaseAllocation(this);
+        return;
+    }
+#if defined(DAWN_WIRE_USE_MEMFD)
+    if (mFd >= 0) {
+        munmap(mData, mSize > 0 ? mSize : 1);
+        close(mFd);
+        return;
+    }
+#endif
+    DAWN_ASSERT(mFd == -1);
+    free(mData);
+}
+
+namespace {
+
+// Sub-allocations are aligned so that copies to and from them are efficient.
+constexpr size_t kRingAllocationAlignment = 16;
+
+}  // anonymous namespace
+
+// static
+Ref<SharedMemoryRing> SharedMemoryRing::Create(size_t size) {
+    Ref<SharedMemoryRegion> memory = SharedMemoryRegion::Create(size);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    return AcquireRef(new SharedMemoryRing(std::move(memory)));
+}
+
+SharedMemoryRing::SharedMemoryRing(Ref<SharedMemoryRegion> memory) : mMemory(std::move(memory)) {}
+
+SharedMemoryRing::~SharedMemoryRing() {
+    // Each sub-allocated region holds a reference to the ring.
+    DAWN_ASSERT(mAllocations.empty());
+}
+
+Ref<SharedMemoryRegion> SharedMemoryRing::Allocate(size_t size) {
+    size_t capacity = mMemory->GetSize();
+    if (size == 0 || size > capacity) {
+        return nullptr;
+    }
+
+    // Each allocation reserves an aligned amount of space, except at the very end of the ring.
+    size_t alignedSize = Align(size, kRingAllocationAlignment);
+
+    size_t offset;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mAllocations.empty()) {
+            offset = 0;
+        } else {
+            // The allocations in use span [tail, mHead), possibly wrapping around the end.
+            size_t tail = mAllocations.front().offset;
+            if (mHead > tail) {
+                if (capacity - mHead >= size) {
+                    offset = mHead;
+                } else if (tail >= alignedSize) {
+                    // Wrap around, the end of the ring is unused until the allocations before
+                    // it are released.
+                    offset = 0;
+                } else {
+                    return nullptr;
+                }
+            } else if (tail - mHead >= alignedSize) {
+                offset = mHead;
+            } else {
+                return nullptr;
+            }
+        }
+
+        mAllocations.push_back({offset, false});
+        mHead = std::min(offset + alignedSize, capacity);
+    }
+
+    return AcquireRef(new SharedMemoryRegion(
+        this, static_cast<uint8_t*>(mMemory->GetData()) + offset, size));
+}
+
+void SharedMemoryRing::ReleaseAllocation(const SharedMemoryRegion* region) {
+    size_t offset = static_cast<size_t>(static_cast<const uint8_t*>(region->GetData()) -
+                                        static_cast<const uint8_t*>(mMemory->GetData()));
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (Allocation& allocation : mAllocations) {
+        if (allocation.offset == offset && !allocation.released) {
+            allocation.released = true;
+            break;
+        }
+    }
+    while (!mAllocations.empty() && mAllocations.front().released) {
+        mAllocations.pop_front();
+    }
+}
+
+SharedMemoryHandleTable::SharedMemoryHandleTable() = default;
+
+SharedMemoryHandleTable::~SharedMemoryHandleTable() = default;
+
+SharedMemoryHandle SharedMemoryHandleTable::Export(Ref<SharedMemoryRegion> region) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    uint64_t id = mNextId++;
+    uint64_t size = region->GetSize();
+    mExportedRegions.emplace(id, std::move(region));
+    return {id, size};
+}
+
+Ref<SharedMemoryRegion> SharedMemoryHandleTable::Import(const SharedMemoryHandle& handle) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mExportedRegions.find(handle.id);
+    if (it == mExportedRegions.end() || it->second->GetSize() != handle.size) {
+        return nullptr;
+    }
+    Ref<SharedMemoryRegion> region = std::move(it->second);
+    mExportedRegions.erase(it);
+    return region;
+}
+
+void SharedMemoryHandleTable::ReleaseExportedRegions() {
+    absl::flat_hash_map<uint64_t, Ref<SharedMemoryRegion>> exportedRegions;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        exportedRegions.swap(mExportedRegions);
+    }
+    // The regions are destroyed outside of the lock when |exportedRegions| goes out of scope.
+}
+
+}  // namespace dawn::wire
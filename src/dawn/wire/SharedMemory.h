@@ -0,0 +1,143 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_WIRE_SHAREDMEMORY_H_
+#define SRC_DAWN_WIRE_SHAREDMEMORY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "absl/container/flat_hash_map.h"
+#include "dawn/common/Ref.h"
+#include "dawn/common/RefCounted.h"
+
+namespace dawn::wire {
+
+class SharedMemoryRing;
+
+// A region of memory that both the client and the server side of the wire can access. On Linux
+// it is backed by a memfd so that it could be mapped in another process, elsewhere it falls back
+// to a heap allocation. The contents are zero-initialized.
+// A region can also be a sub-allocation of a SharedMemoryRing, in which case its contents are
+// not initialized and it is returned to the ring when it is destroyed.
+class SharedMemoryRegion : public RefCounted {
+  public:
+    // Returns nullptr if the region couldn't be allocated.
+    static Ref<SharedMemoryRegion> Create(size_t size);
+
+    void* GetData() const { return mData; }
+    size_t GetSize() const { return mSize; }
+
+  private:
+    friend class SharedMemoryRing;
+
+    SharedMemoryRegion(void* data, size_t size, int fd);
+    SharedMemoryRegion(Ref<SharedMemoryRing> ring, void* data, size_t size);
+    ~SharedMemoryRegion() override;
+
+    void* mData;
+    size_t mSize;
+    // The memfd backing the region, or -1 if it is a heap allocation or a sub-allocation.
+    int mFd = -1;
+    // The ring the region was sub-allocated from, if any.
+    Ref<SharedMemoryRing> mRing;
+};
+
+// Sub-allocates short-lived SharedMemoryRegions, like the ones for queue writes, from a single
+// larger region so that each of them doesn't need its own mapping. Allocations are made in a ring:
+// they are expected to be released roughly in the order they were made, and the space of an
+// allocation is only reused once it and all the allocations made before it are released. All the
+// operations are thread-safe.
+class SharedMemoryRing : public RefCounted {
+  public:
+    // Returns nullptr if the backing region couldn't be allocated.
+    static Ref<SharedMemoryRing> Create(size_t size);
+
+    // Returns nullptr if the ring doesn't have |size| contiguous bytes available.
+    Ref<SharedMemoryRegion> Allocate(size_t size);
+
+  private:
+    friend class SharedMemoryRegion;
+
+    explicit SharedMemoryRing(Ref<SharedMemoryRegion> memory);
+    ~SharedMemoryRing() override;
+
+    // Called by the sub-allocated regions when they are destroyed.
+    void ReleaseAllocation(const SharedMemoryRegion* region);
+
+    struct Allocation {
+        size_t offset;
+        bool released;
+    };
+
+    Ref<SharedMemoryRegion> mMemory;
+
+    std::mutex mMutex;
+    // The allocations that are not released yet, or that were released after an older one that is
+    // still in use, from oldest to newest.
+    std::deque<Allocation> mAllocations;
+    // The offset at which the next allocation is attempted.
+    size_t mHead = 0;
+};
+
+// The data serialized in the command stream to identify a SharedMemoryRegion.
+struct SharedMemoryHandle {
+    uint64_t id;
+    uint64_t size;
+};
+
+// Hands SharedMemoryRegions from the client to the server. This stands in for the IPC that would
+// send the memfd to the GPU process: the client exports a region to get the handle it serializes,
+// and the server imports the region from the deserialized handle. The table keeps exported regions
+// alive until they are imported, or until the wire is disconnected since they will never be
+// imported then. All the operations are thread-safe.
+class SharedMemoryHandleTable : public RefCounted {
+  public:
+    SharedMemoryHandleTable();
+
+    SharedMemoryHandle Export(Ref<SharedMemoryRegion> region);
+
+    // Returns nullptr if the handle doesn't match an exported region. Each export can only be
+    // imported once.
+    Ref<SharedMemoryRegion> Import(const SharedMemoryHandle& handle);
+
+    // Releases the regions that were exported but not imported yet.
+    void ReleaseExportedRegions();
+
+  private:
+    ~SharedMemoryHandleTable() override;
+
+    std::mutex mMutex;
+    uint64_t mNextId = 1;
+    absl::flat_hash_map<uint64_t, Ref<SharedMemoryRegion>> mExportedRegions;
+};
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_SHAREDMEMORY_H_
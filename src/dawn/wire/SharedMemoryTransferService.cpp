@@ -0,0 +1,59 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/SharedMemoryTransferService.h"
+
+#include <utility>
+
+#include "dawn/wire/SharedMemory.h"
+#include "dawn/wire/client/Client.h"
+#include "dawn/wire/server/Server.h"
+
+namespace dawn::wire {
+
+SharedMemoryTransferServices::SharedMemoryTransferServices() = default;
+
+SharedMemoryTransferServices::SharedMemoryTransferServices(SharedMemoryTransferServices&&) =
+    default;
+
+SharedMemoryTransferServices& SharedMemoryTransferServices::operator=(
+    SharedMemoryTransferServices&&) = default;
+
+SharedMemoryTransferServices::~SharedMemoryTransferServices() = default;
+
+SharedMemoryTransferServices CreateSharedMemoryTransferServices(size_t minQueueWriteSize,
+                                                                size_t queueWriteRingSize) {
+    Ref<SharedMemoryHandleTable> table = AcquireRef(new SharedMemoryHandleTable());
+
+    SharedMemoryTransferServices services;
+    services.client =
+        client::CreateSharedMemoryTransferService(table, minQueueWriteSize, queueWriteRingSize);
+    services.server = server::CreateSharedMemoryTransferService(std::move(table));
+    return services;
+}
+
+}  // namespace dawn::wire
@@ -85,6 +85,16 @@ MemoryTransferService::MemoryTransferService() = default;
 
 MemoryTransferService::~MemoryTransferService() = default;
 
+bool MemoryTransferService::ShouldUseWriteHandleForQueueWrite(size_t size) {
+    return false;
+}
+
+MemoryTransferService::WriteHandle* MemoryTransferService::CreateQueueWriteHandle(size_t size) {
+    return CreateWriteHandle(size);
+}
+
+void MemoryTransferService::OnDisconnect() {}
+
 MemoryTransferService::ReadHandle::ReadHandle() = default;
 
 MemoryTransferService::ReadHandle::~ReadHandle() = default;
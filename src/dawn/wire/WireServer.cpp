@@ -40,7 +40,12 @@ WireServer::~WireServer() {
 }
 
 const volatile char* WireServer::HandleCommands(const volatile char* commands, size_t size) {
-    return mImpl->HandleCommands(commands, size);
+    const volatile char* result = mImpl->HandleCommands(commands, size);
+    if (result == nullptr) {
+        // The server can't recover from failing to handle commands.
+        mImpl->GetMemoryTransferService()->OnDisconnect();
+    }
+    return result;
 }
 
 bool WireServer::InjectBuffer(WGPUBuffer buffer, const Handle& handle, const Handle& deviceHandle) {
@@ -76,6 +81,8 @@ MemoryTransferService::MemoryTransferService() = default;
 
 MemoryTransferService::~MemoryTransferService() = default;
 
+void MemoryTransferService::OnDisconnect() {}
+
 MemoryTransferService::ReadHandle::ReadHandle() = default;
 
 MemoryTransferService::ReadHandle::~ReadHandle() = default;
@@ -90,6 +97,10 @@ void MemoryTransferService::WriteHandle::SetTarget(void* data) {
 void MemoryTransferService::WriteHandle::SetDataLength(size_t dataLength) {
     mDataLength = dataLength;
 }
+
+const void* MemoryTransferService::WriteHandle::GetSourceData(size_t offset, size_t size) {
+    return nullptr;
+}
 }  // namespace server
 
 }  // namespace dawn::wire
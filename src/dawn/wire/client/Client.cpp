@@ -152,6 +152,7 @@ EventManager& Client::GetEventManager(const ObjectHandle& instance) {
 void Client::Disconnect() {
     mDisconnected = true;
     mSerializer = ChunkedCommandSerializer(NoopCommandSerializer::GetInstance());
+    mMemoryTransferService->OnDisconnect();
 
     // Transition all event managers to ClientDropped state.
     for (auto& [_, eventManager] : mEventManagers) {
@@ -37,6 +37,7 @@
 #include "dawn/common/LinkedList.h"
 #include "dawn/common/NonCopyable.h"
 #include "dawn/wire/ChunkedCommandSerializer.h"
+#include "dawn/wire/SharedMemory.h"
 #include "dawn/wire/Wire.h"
 #include "dawn/wire/WireClient.h"
 #include "dawn/wire/WireCmd_autogen.h"
@@ -138,6 +139,10 @@ class Client : public ClientBase {
 };
 
 std::unique_ptr<MemoryTransferService> CreateInlineMemoryTransferService();
+std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(
+    Ref<SharedMemoryHandleTable> table,
+    size_t minQueueWriteSize,
+    size_t queueWriteRingSize);
 
 }  // namespace dawn::wire::client
 
@@ -0,0 +1,175 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Ref.h"
+#include "dawn/wire/SharedMemory.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/client/Client.h"
+
+namespace dawn::wire::client {
+
+// A MemoryTransferService that allocates the handles in SharedMemoryRegions that the server maps
+// directly, so that map data updates are not copied through the command stream.
+class SharedMemoryTransferService : public MemoryTransferService {
+    class ReadHandleImpl : public ReadHandle {
+      public:
+        ReadHandleImpl(Ref<SharedMemoryHandleTable> table, Ref<SharedMemoryRegion> region)
+            : mTable(std::move(table)), mRegion(std::move(region)) {}
+
+        ~ReadHandleImpl() override = default;
+
+        size_t SerializeCreateSize() override { return sizeof(SharedMemoryHandle); }
+
+        void SerializeCreate(void* serializePointer) override {
+            SharedMemoryHandle handle = mTable->Export(mRegion);
+            memcpy(serializePointer, &handle, sizeof(handle));
+        }
+
+        const void* GetData() override { return mRegion->GetData(); }
+
+        bool DeserializeDataUpdate(const void* deserializePointer,
+                                   size_t deserializeSize,
+                                   size_t offset,
+                                   size_t size) override {
+            // The server wrote the data directly into the region.
+            if (deserializeSize != 0) {
+                return false;
+            }
+            return offset <= mRegion->GetSize() && size <= mRegion->GetSize() - offset;
+        }
+
+      private:
+        Ref<SharedMemoryHandleTable> mTable;
+        Ref<SharedMemoryRegion> mRegion;
+    };
+
+    class WriteHandleImpl : public WriteHandle {
+      public:
+        WriteHandleImpl(Ref<SharedMemoryHandleTable> table, Ref<SharedMemoryRegion> region)
+            : mTable(std::move(table)), mRegion(std::move(region)) {}
+
+        ~WriteHandleImpl() override = default;
+
+        size_t SerializeCreateSize() override { return sizeof(SharedMemoryHandle); }
+
+        void SerializeCreate(void* serializePointer) override {
+            SharedMemoryHandle handle = mTable->Export(mRegion);
+            memcpy(serializePointer, &handle, sizeof(handle));
+        }
+
+        void* GetData() override { return mRegion->GetData(); }
+
+        size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override {
+            DAWN_ASSERT(offset <= mRegion->GetSize());
+            DAWN_ASSERT(size <= mRegion->GetSize() - offset);
+            return 0;
+        }
+
+        void SerializeDataUpdate(void* serializePointer, size_t offset, size_t size) override {
+            // The server reads the data directly from the region.
+        }
+
+      private:
+        Ref<SharedMemoryHandleTable> mTable;
+        Ref<SharedMemoryRegion> mRegion;
+    };
+
+  public:
+    SharedMemoryTransferService(Ref<SharedMemoryHandleTable> table,
+                                size_t minQueueWriteSize,
+                                size_t queueWriteRingSize)
+        : mTable(std::move(table)),
+          mMinQueueWriteSize(minQueueWriteSize),
+          mQueueWriteRingSize(queueWriteRingSize) {}
+    ~SharedMemoryTransferService() override = default;
+
+    ReadHandle* CreateReadHandle(size_t size) override {
+        Ref<SharedMemoryRegion> region = SharedMemoryRegion::Create(size);
+        if (region == nullptr) {
+            return nullptr;
+        }
+        return new ReadHandleImpl(mTable, std::move(region));
+    }
+
+    WriteHandle* CreateWriteHandle(size_t size) override {
+        Ref<SharedMemoryRegion> region = SharedMemoryRegion::Create(size);
+        if (region == nullptr) {
+            return nullptr;
+        }
+        return new WriteHandleImpl(mTable, std::move(region));
+    }
+
+    bool ShouldUseWriteHandleForQueueWrite(size_t size) override {
+        return size >= mMinQueueWriteSize;
+    }
+
+    WriteHandle* CreateQueueWriteHandle(size_t size) override {
+        // Queue write data is only alive until the server has read it, so it is sub-allocated in
+        // a ring instead of getting its own mapping. Writes that don't fit in the ring right now
+        // fall back to a dedicated region.
+        Ref<SharedMemoryRegion> region;
+        {
+            std::lock_guard<std::mutex> lock(mQueueWriteRingMutex);
+            if (mQueueWriteRing == nullptr && mQueueWriteRingSize > 0) {
+                mQueueWriteRing = SharedMemoryRing::Create(mQueueWriteRingSize);
+            }
+            if (mQueueWriteRing != nullptr) {
+                region = mQueueWriteRing->Allocate(size);
+            }
+        }
+        if (region == nullptr) {
+            return CreateWriteHandle(size);
+        }
+        return new WriteHandleImpl(mTable, std::move(region));
+    }
+
+    void OnDisconnect() override { mTable->ReleaseExportedRegions(); }
+
+  private:
+    Ref<SharedMemoryHandleTable> mTable;
+    size_t mMinQueueWriteSize;
+
+    size_t mQueueWriteRingSize;
+    std::mutex mQueueWriteRingMutex;
+    Ref<SharedMemoryRing> mQueueWriteRing;
+};
+
+std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(
+    Ref<SharedMemoryHandleTable> table,
+    size_t minQueueWriteSize,
+    size_t queueWriteRingSize) {
+    return std::make_unique<SharedMemoryTransferService>(std::move(table), minQueueWriteSize,
+                                                         queueWriteRingSize);
+}
+
+}  // namespace dawn::wire::client
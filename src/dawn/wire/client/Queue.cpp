@@ -27,6 +27,7 @@
 
 #include "dawn/wire/client/Queue.h"
 
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -149,6 +150,19 @@ WGPUFuture Queue::OnSubmittedWorkDone2(const WGPUQueueWorkDoneCallbackInfo2& cal
 void Queue::WriteBuffer(WGPUBuffer cBuffer, uint64_t bufferOffset, const void* data, size_t size) {
     Buffer* buffer = FromAPI(cBuffer);
 
+    // Large writes go through a WriteHandle when the MemoryTransferService can hand the data to
+    // the server without copying it into the command stream.
+    if (std::unique_ptr<MemoryTransferService::WriteHandle> writeHandle =
+            CreateQueueWriteHandle(data, size)) {
+        QueueWriteBufferWithHandleCmd cmd;
+        cmd.queueId = GetWireId();
+        cmd.bufferId = buffer->GetWireId();
+        cmd.bufferOffset = bufferOffset;
+        cmd.size = size;
+        SerializeWithWriteHandle(&cmd, writeHandle.get(), size);
+        return;
+    }
+
     QueueWriteBufferCmd cmd;
     cmd.queueId = GetWireId();
     cmd.bufferId = buffer->GetWireId();
@@ -164,6 +178,18 @@ void Queue::WriteTexture(const WGPUImageCopyTexture* destination,
                          size_t dataSize,
                          const WGPUTextureDataLayout* dataLayout,
                          const WGPUExtent3D* writeSize) {
+    if (std::unique_ptr<MemoryTransferService::WriteHandle> writeHandle =
+            CreateQueueWriteHandle(data, dataSize)) {
+        QueueWriteTextureWithHandleCmd cmd;
+        cmd.queueId = GetWireId();
+        cmd.destination = destination;
+        cmd.dataSize = dataSize;
+        cmd.dataLayout = dataLayout;
+        cmd.writeSize = writeSize;
+        SerializeWithWriteHandle(&cmd, writeHandle.get(), dataSize);
+        return;
+    }
+
     QueueWriteTextureCmd cmd;
     cmd.queueId = GetWireId();
     cmd.destination = destination;
@@ -175,4 +201,41 @@ void Queue::WriteTexture(const WGPUImageCopyTexture* destination,
     GetClient()->SerializeCommand(cmd);
 }
 
+std::unique_ptr<MemoryTransferService::WriteHandle> Queue::CreateQueueWriteHandle(const void* data,
+                                                                                  size_t size) {
+    MemoryTransferService* service = GetClient()->GetMemoryTransferService();
+    if (size == 0 || !service->ShouldUseWriteHandleForQueueWrite(size)) {
+        return nullptr;
+    }
+
+    // Fall back to inlining the data if the handle can't be created.
+    std::unique_ptr<MemoryTransferService::WriteHandle> writeHandle(
+        service->CreateQueueWriteHandle(size));
+    if (writeHandle == nullptr || writeHandle->GetData() == nullptr) {
+        return nullptr;
+    }
+    memcpy(writeHandle->GetData(), data, size);
+    return writeHandle;
+}
+
+template <typename Cmd>
+void Queue::SerializeWithWriteHandle(Cmd* cmd,
+                                     MemoryTransferService::WriteHandle* writeHandle,
+                                     size_t size) {
+    size_t writeHandleCreateInfoLength = writeHandle->SerializeCreateSize();
+    size_t writeDataUpdateInfoLength = writeHandle->SizeOfSerializeDataUpdate(0, size);
+    cmd->writeHandleCreateInfoLength = writeHandleCreateInfoLength;
+    cmd->writeDataUpdateInfoLength = writeDataUpdateInfoLength;
+
+    GetClient()->SerializeCommand(
+        *cmd,
+        CommandExtension{writeHandleCreateInfoLength,
+                         [&](char* writeHandleBuffer) {
+                             writeHandle->SerializeCreate(writeHandleBuffer);
+                         }},
+        CommandExtension{writeDataUpdateInfoLength, [&](char* writeDataUpdateBuffer) {
+                             writeHandle->SerializeDataUpdate(writeDataUpdateBuffer, 0, size);
+                         }});
+}
+
 }  // namespace dawn::wire::client
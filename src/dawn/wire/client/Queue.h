@@ -30,6 +30,8 @@
 
 #include <webgpu/webgpu.h>
 
+#include <memory>
+
 #include "dawn/wire/WireClient.h"
 #include "dawn/wire/client/ObjectBase.h"
 
@@ -52,6 +54,16 @@ class Queue final : public ObjectWithEventsBase {
                       size_t dataSize,
                       const WGPUTextureDataLayout* dataLayout,
                       const WGPUExtent3D* writeSize);
+
+  private:
+    // Returns a WriteHandle filled with |data| if the MemoryTransferService prefers sending queue
+    // writes of |size| bytes through one, nullptr otherwise.
+    std::unique_ptr<MemoryTransferService::WriteHandle> CreateQueueWriteHandle(const void* data,
+                                                                               size_t size);
+    template <typename Cmd>
+    void SerializeWithWriteHandle(Cmd* cmd,
+                                  MemoryTransferService::WriteHandle* writeHandle,
+                                  size_t size);
 };
 
 }  // namespace dawn::wire::client
@@ -59,6 +59,7 @@ Server::~Server() {
         ClearDeviceCallbacks(device);
     }
     DestroyAllObjects(mProcs);
+    mMemoryTransferService->OnDisconnect();
 }
 
 WireResult Server::InjectBuffer(WGPUBuffer buffer,
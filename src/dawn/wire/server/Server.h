@@ -33,6 +33,7 @@
 
 #include "dawn/common/MutexProtected.h"
 #include "dawn/wire/ChunkedCommandSerializer.h"
+#include "dawn/wire/SharedMemory.h"
 #include "dawn/wire/server/ServerBase_autogen.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
@@ -208,6 +209,8 @@ class Server : public ServerBase {
     WGPUDevice GetDevice(uint32_t id, uint32_t generation);
     bool IsDeviceKnown(WGPUDevice device) const;
 
+    MemoryTransferService* GetMemoryTransferService() const { return mMemoryTransferService; }
+
     template <typename T,
               typename Enable = std::enable_if<std::is_base_of<CallbackUserdata, T>::value>>
     std::unique_ptr<T> MakeUserdata() {
@@ -279,6 +282,23 @@ class Server : public ServerBase {
                                  WGPUDevice device,
                                  WGPUStringView message);
 
+    // The data of a queue write command sent through a WriteHandle. |data| points either directly
+    // into the memory of |writeHandle|, or into |stagingData| if the handle can't expose it.
+    struct QueueWriteData {
+        std::unique_ptr<MemoryTransferService::WriteHandle> writeHandle;
+        std::unique_ptr<uint8_t[]> stagingData;
+        const void* data = nullptr;
+    };
+
+    // Deserializes the WriteHandle of a queue write command and gets the |size| bytes of data the
+    // client wrote in it.
+    WireResult ReadQueueWriteHandleData(uint64_t size,
+                                        uint64_t writeHandleCreateInfoLength,
+                                        const uint8_t* writeHandleCreateInfo,
+                                        uint64_t writeDataUpdateInfoLength,
+                                        const uint8_t* writeDataUpdateInfo,
+                                        QueueWriteData* data);
+
 #include "dawn/wire/server/ServerPrototypes_autogen.inc"
 
     WireDeserializeAllocator mAllocator;
@@ -292,6 +312,8 @@ class Server : public ServerBase {
 };
 
 std::unique_ptr<MemoryTransferService> CreateInlineMemoryTransferService();
+std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(
+    Ref<SharedMemoryHandleTable> table);
 
 }  // namespace dawn::wire::server
 
@@ -26,7 +26,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <limits>
+#include <memory>
 
+#include "dawn/common/Alloc.h"
 #include "dawn/common/Assert.h"
 #include "dawn/wire/server/Server.h"
 
@@ -91,4 +93,88 @@ WireResult Server::DoQueueWriteTexture(Known<WGPUQueue> queue,
     return WireResult::Success;
 }
 
+WireResult Server::DoQueueWriteBufferWithHandle(Known<WGPUQueue> queue,
+                                                Known<WGPUBuffer> buffer,
+                                                uint64_t bufferOffset,
+                                                uint64_t size,
+                                                uint64_t writeHandleCreateInfoLength,
+                                                const uint8_t* writeHandleCreateInfo,
+                                                uint64_t writeDataUpdateInfoLength,
+                                                const uint8_t* writeDataUpdateInfo) {
+    QueueWriteData data;
+    WIRE_TRY(ReadQueueWriteHandleData(size, writeHandleCreateInfoLength, writeHandleCreateInfo,
+                                      writeDataUpdateInfoLength, writeDataUpdateInfo, &data));
+
+    mProcs.queueWriteBuffer(queue->handle, buffer->handle, bufferOffset, data.data,
+                            static_cast<size_t>(size));
+    return WireResult::Success;
+}
+
+WireResult Server::DoQueueWriteTextureWithHandle(Known<WGPUQueue> queue,
+                                                 const WGPUImageCopyTexture* destination,
+                                                 uint64_t dataSize,
+                                                 const WGPUTextureDataLayout* dataLayout,
+                                                 const WGPUExtent3D* writeSize,
+                                                 uint64_t writeHandleCreateInfoLength,
+                                                 const uint8_t* writeHandleCreateInfo,
+                                                 uint64_t writeDataUpdateInfoLength,
+                                                 const uint8_t* writeDataUpdateInfo) {
+    QueueWriteData data;
+    WIRE_TRY(ReadQueueWriteHandleData(dataSize, writeHandleCreateInfoLength,
+                                      writeHandleCreateInfo, writeDataUpdateInfoLength,
+                                      writeDataUpdateInfo, &data));
+
+    mProcs.queueWriteTexture(queue->handle, destination, data.data, static_cast<size_t>(dataSize),
+                             dataLayout, writeSize);
+    return WireResult::Success;
+}
+
+WireResult Server::ReadQueueWriteHandleData(uint64_t size,
+                                            uint64_t writeHandleCreateInfoLength,
+                                            const uint8_t* writeHandleCreateInfo,
+                                            uint64_t writeDataUpdateInfoLength,
+                                            const uint8_t* writeDataUpdateInfo,
+                                            QueueWriteData* data) {
+    if (size > std::numeric_limits<size_t>::max() ||
+        writeHandleCreateInfoLength > std::numeric_limits<size_t>::max() ||
+        writeDataUpdateInfoLength > std::numeric_limits<size_t>::max()) {
+        return WireResult::FatalError;
+    }
+
+    MemoryTransferService::WriteHandle* writeHandle = nullptr;
+    if (!mMemoryTransferService->DeserializeWriteHandle(
+            writeHandleCreateInfo, static_cast<size_t>(writeHandleCreateInfoLength),
+            &writeHandle)) {
+        return WireResult::FatalError;
+    }
+    DAWN_ASSERT(writeHandle != nullptr);
+    data->writeHandle.reset(writeHandle);
+
+    // Pass the handle's memory directly to the queue write procs when it is shared with the
+    // client, since they copy the data anyway.
+    if (writeDataUpdateInfoLength == 0) {
+        data->data = writeHandle->GetSourceData(0, static_cast<size_t>(size));
+        if (data->data != nullptr) {
+            return WireResult::Success;
+        }
+    }
+
+    // Otherwise the data is staged in a server-side allocation that the handle's data update is
+    // applied to.
+    data->stagingData.reset(AllocNoThrow<uint8_t>(static_cast<size_t>(size)));
+    if (data->stagingData == nullptr) {
+        return WireResult::FatalError;
+    }
+    writeHandle->SetTarget(data->stagingData.get());
+    writeHandle->SetDataLength(static_cast<size_t>(size));
+
+    if (!writeHandle->DeserializeDataUpdate(writeDataUpdateInfo,
+                                            static_cast<size_t>(writeDataUpdateInfoLength), 0,
+                                            static_cast<size_t>(size))) {
+        return WireResult::FatalError;
+    }
+    data->data = data->stagingData.get();
+    return WireResult::Success;
+}
+
 }  // namespace dawn::wire::server
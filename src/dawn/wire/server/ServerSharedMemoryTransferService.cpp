@@ -0,0 +1,148 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Ref.h"
+#include "dawn/wire/SharedMemory.h"
+#include "dawn/wire/WireServer.h"
+#include "dawn/wire/server/Server.h"
+
+namespace dawn::wire::server {
+
+class SharedMemoryTransferService : public MemoryTransferService {
+  public:
+    class ReadHandleImpl : public ReadHandle {
+      public:
+        explicit ReadHandleImpl(Ref<SharedMemoryRegion> region) : mRegion(std::move(region)) {}
+        ~ReadHandleImpl() override = default;
+
+        size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override { return 0; }
+
+        void SerializeDataUpdate(const void* data,
+                                 size_t offset,
+                                 size_t size,
+                                 void* serializePointer) override {
+            // Write directly into the region. The client validates the range again when it
+            // receives the (empty) data update, so an out-of-bounds range is simply dropped here.
+            if (size == 0 || offset > mRegion->GetSize() || size > mRegion->GetSize() - offset) {
+                return;
+            }
+            DAWN_ASSERT(data != nullptr);
+            memcpy(static_cast<uint8_t*>(mRegion->GetData()) + offset, data, size);
+        }
+
+      private:
+        Ref<SharedMemoryRegion> mRegion;
+    };
+
+    class WriteHandleImpl : public WriteHandle {
+      public:
+        explicit WriteHandleImpl(Ref<SharedMemoryRegion> region) : mRegion(std::move(region)) {}
+        ~WriteHandleImpl() override = default;
+
+        bool DeserializeDataUpdate(const void* deserializePointer,
+                                   size_t deserializeSize,
+                                   size_t offset,
+                                   size_t size) override {
+            if (deserializeSize != 0 || mTargetData == nullptr) {
+                return false;
+            }
+            if (offset > mDataLength || size > mDataLength - offset) {
+                return false;
+            }
+            if (offset > mRegion->GetSize() || size > mRegion->GetSize() - offset) {
+                return false;
+            }
+            memcpy(static_cast<uint8_t*>(mTargetData) + offset,
+                   static_cast<const uint8_t*>(mRegion->GetData()) + offset, size);
+            return true;
+        }
+
+        const void* GetSourceData(size_t offset, size_t size) override {
+            if (offset > mRegion->GetSize() || size > mRegion->GetSize() - offset) {
+                return nullptr;
+            }
+            return static_cast<const uint8_t*>(mRegion->GetData()) + offset;
+        }
+
+      private:
+        Ref<SharedMemoryRegion> mRegion;
+    };
+
+    explicit SharedMemoryTransferService(Ref<SharedMemoryHandleTable> table)
+        : mTable(std::move(table)) {}
+    ~SharedMemoryTransferService() override = default;
+
+    bool DeserializeReadHandle(const void* deserializePointer,
+                               size_t deserializeSize,
+                               ReadHandle** readHandle) override {
+        DAWN_ASSERT(readHandle != nullptr);
+        Ref<SharedMemoryRegion> region = Import(deserializePointer, deserializeSize);
+        if (region == nullptr) {
+            return false;
+        }
+        *readHandle = new ReadHandleImpl(std::move(region));
+        return true;
+    }
+
+    bool DeserializeWriteHandle(const void* deserializePointer,
+                                size_t deserializeSize,
+                                WriteHandle** writeHandle) override {
+        DAWN_ASSERT(writeHandle != nullptr);
+        Ref<SharedMemoryRegion> region = Import(deserializePointer, deserializeSize);
+        if (region == nullptr) {
+            return false;
+        }
+        *writeHandle = new WriteHandleImpl(std::move(region));
+        return true;
+    }
+
+    void OnDisconnect() override { mTable->ReleaseExportedRegions(); }
+
+  private:
+    Ref<SharedMemoryRegion> Import(const void* deserializePointer, size_t deserializeSize) {
+        if (deserializeSize != sizeof(SharedMemoryHandle) || deserializePointer == nullptr) {
+            return nullptr;
+        }
+        SharedMemoryHandle handle;
+        memcpy(&handle, deserializePointer, sizeof(handle));
+        return mTable->Import(handle);
+    }
+
+    Ref<SharedMemoryHandleTable> mTable;
+};
+
+std::unique_ptr<MemoryTransferService> CreateSharedMemoryTransferService(
+    Ref<SharedMemoryHandleTable> table) {
+    return std::make_unique<SharedMemoryTransferService>(std::move(table));
+}
+
+}  // namespace dawn::wire::server
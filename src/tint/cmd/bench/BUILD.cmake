@@ -93,6 +93,12 @@ if(TINT_BUILD_MSL_WRITER AND TINT_BUILD_WGSL_READER)
   )
 endif(TINT_BUILD_MSL_WRITER AND TINT_BUILD_WGSL_READER)
 
+if(TINT_BUILD_SPV_READER AND TINT_BUILD_SPV_WRITER AND TINT_BUILD_WGSL_READER)
+  tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
+    tint_lang_spirv_reader_bench
+  )
+endif(TINT_BUILD_SPV_READER AND TINT_BUILD_SPV_WRITER AND TINT_BUILD_WGSL_READER)
+
 if(TINT_BUILD_SPV_WRITER AND TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
     tint_lang_spirv_writer_bench
@@ -125,6 +131,8 @@ if(TINT_BUILD_WGSL_READER)
 tint_add_target(tint_cmd_bench_bench bench
   cmd/bench/bench.cc
   cmd/bench/bench.h
+  cmd/bench/corpus.cc
+  cmd/bench/corpus.h
 )
 
 tint_target_add_dependencies(tint_cmd_bench_bench bench
@@ -159,6 +167,12 @@ tint_target_add_external_dependencies(tint_cmd_bench_bench bench
   "src_utils"
 )
 
+if(TINT_BUILD_SPV_READER AND TINT_BUILD_WGSL_READER)
+  tint_target_add_dependencies(tint_cmd_bench_bench bench
+    tint_lang_spirv_reader
+  )
+endif(TINT_BUILD_SPV_READER AND TINT_BUILD_WGSL_READER)
+
 if(TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_cmd_bench_bench bench
     tint_lang_wgsl_reader
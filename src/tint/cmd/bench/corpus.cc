@@ -0,0 +1,262 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/cmd/bench/corpus.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "src/tint/lang/wgsl/reader/reader.h"
+#include "src/tint/utils/containers/vector.h"
+
+#if TINT_BUILD_SPV_READER
+#include "src/tint/lang/spirv/reader/reader.h"
+#endif
+
+#if TINT_BUILD_IS_LINUX || TINT_BUILD_IS_MAC
+#include <sys/resource.h>
+#endif
+
+namespace tint::bench {
+namespace {
+
+/// A backend registered with RegisterCorpusCompiler()
+struct CorpusCompiler {
+    /// The name of the backend
+    std::string backend;
+    /// The function that compiles a shader with the backend
+    CorpusCompileFn compile = nullptr;
+};
+
+/// A shader of the corpus
+struct CorpusShader {
+    /// The path of the shader file
+    std::string path;
+    /// The WGSL source, if the shader is a `.wgsl` file
+    std::unique_ptr<Source::File> wgsl;
+    /// The SPIR-V binary, if the shader is a `.spv` file
+    std::vector<uint32_t> spirv;
+};
+
+Vector<CorpusCompiler, 8>& Compilers() {
+    static Vector<CorpusCompiler, 8> compilers;
+    return compilers;
+}
+
+std::vector<CorpusShader>& Corpus() {
+    static std::vector<CorpusShader> corpus;
+    return corpus;
+}
+
+/// The single thread throughput of each backend, in shaders per second. Only written by the first
+/// thread of a benchmark, and benchmarks are run one after the other.
+std::unordered_map<std::string, double>& SingleThreadThroughput() {
+    static std::unordered_map<std::string, double> throughput;
+    return throughput;
+}
+
+Program Parse(const CorpusShader& shader) {
+#if TINT_BUILD_SPV_READER
+    if (!shader.wgsl) {
+        return spirv::reader::Read(shader.spirv);
+    }
+#endif
+    return wgsl::reader::Parse(shader.wgsl.get());
+}
+
+/// @returns the @p percentile (in [0, 1]) of @p samples, or 0 if there are no samples
+double Percentile(std::vector<double>& samples, double percentile) {
+    if (samples.empty()) {
+        return 0;
+    }
+    auto index = static_cast<size_t>(percentile * static_cast<double>(samples.size() - 1) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + static_cast<ptrdiff_t>(index),
+                     samples.end());
+    return samples[index];
+}
+
+/// @returns the peak resident set size of the process in bytes, or 0 if it is not known
+double PeakResidentSetBytes() {
+#if TINT_BUILD_IS_LINUX || TINT_BUILD_IS_MAC
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if TINT_BUILD_IS_MAC
+    return static_cast<double>(usage.ru_maxrss);
+#else
+    return static_cast<double>(usage.ru_maxrss) * 1024.0;
+#endif
+#else
+    return 0;
+#endif
+}
+
+void CompileCorpus(benchmark::State& state, const CorpusCompiler& compiler) {
+    using Clock = std::chrono::steady_clock;
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    const auto& corpus = Corpus();
+    const auto first = static_cast<size_t>(state.thread_index());
+    const auto stride = static_cast<size_t>(state.threads());
+
+    std::vector<double> parse_us;
+    std::vector<double> compile_us;
+    int64_t shaders = 0;
+
+    auto start = Clock::now();
+    for (auto _ : state) {
+        // Each thread compiles every `stride`th shader of the corpus.
+        for (size_t i = first; i < corpus.size(); i += stride) {
+            auto parse_start = Clock::now();
+            auto program = Parse(corpus[i]);
+            auto compile_start = Clock::now();
+            if (!program.IsValid()) {
+                state.SkipWithError(corpus[i].path + ": " + program.Diagnostics().Str());
+                return;
+            }
+            auto res = compiler.compile(program);
+            auto compile_end = Clock::now();
+            if (res != Success) {
+                state.SkipWithError(corpus[i].path + ": " + res.Failure().reason.Str());
+                return;
+            }
+            parse_us.push_back(Microseconds(compile_start - parse_start).count());
+            compile_us.push_back(Microseconds(compile_end - compile_start).count());
+            shaders++;
+        }
+    }
+    std::chrono::duration<double> elapsed = Clock::now() - start;
+
+    using Counter = benchmark::Counter;
+    state.SetItemsProcessed(shaders);
+    state.counters["parse_p50_us"] = Counter(Percentile(parse_us, 0.5), Counter::kAvgThreads);
+    state.counters["parse_p90_us"] = Counter(Percentile(parse_us, 0.9), Counter::kAvgThreads);
+    state.counters["parse_p99_us"] = Counter(Percentile(parse_us, 0.99), Counter::kAvgThreads);
+    state.counters["compile_p50_us"] = Counter(Percentile(compile_us, 0.5), Counter::kAvgThreads);
+    state.counters["compile_p90_us"] = Counter(Percentile(compile_us, 0.9), Counter::kAvgThreads);
+    state.counters["compile_p99_us"] = Counter(Percentile(compile_us, 0.99), Counter::kAvgThreads);
+    state.counters["peak_rss_MB"] =
+        Counter(PeakResidentSetBytes() / (1024.0 * 1024.0), Counter::kAvgThreads);
+
+    if (state.thread_index() == 0 && elapsed.count() > 0) {
+        // All the threads run the same number of iterations, each over the whole corpus.
+        double throughput =
+            static_cast<double>(state.iterations()) * static_cast<double>(corpus.size()) /
+            elapsed.count();
+        auto& single_thread = SingleThreadThroughput();
+        if (state.threads() == 1) {
+            single_thread[compiler.backend] = throughput;
+        } else if (auto it = single_thread.find(compiler.backend); it != single_thread.end()) {
+            state.counters["scaling_efficiency"] =
+                throughput / (static_cast<double>(state.threads()) * it->second);
+        }
+    }
+}
+
+Result<std::string> ReadFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return Failure{"failed to open '" + path.string() + "'"};
+    }
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+void RegisterCorpusCompiler(std::string_view backend, CorpusCompileFn compile) {
+    Compilers().Push(CorpusCompiler{std::string(backend), compile});
+}
+
+Result<SuccessType> RegisterCorpusBenchmarks(const std::string& directory, int max_threads) {
+    auto& corpus = Corpus();
+
+    std::error_code error;
+    for (auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        auto extension = entry.path().extension();
+        bool is_spirv = extension == ".spv";
+        if (extension != ".wgsl" && !is_spirv) {
+            continue;
+        }
+#if !TINT_BUILD_SPV_READER
+        if (is_spirv) {
+            continue;
+        }
+#endif
+
+        auto content = ReadFile(entry.path());
+        if (content != Success) {
+            return content.Failure();
+        }
+
+        CorpusShader shader;
+        shader.path = entry.path().string();
+        if (is_spirv) {
+            if (content->size() % sizeof(uint32_t) != 0) {
+                return Failure{"'" + shader.path + "' is not a valid SPIR-V binary"};
+            }
+            shader.spirv.resize(content->size() / sizeof(uint32_t));
+            std::copy(content->begin(), content->end(),
+                      reinterpret_cast<char*>(shader.spirv.data()));
+        } else {
+            shader.wgsl = std::make_unique<Source::File>(shader.path, content.Get());
+        }
+        corpus.push_back(std::move(shader));
+    }
+    if (error) {
+        return Failure{"failed to read the corpus directory '" + directory +
+                       "': " + error.message()};
+    }
+    if (corpus.empty()) {
+        return Failure{"no shaders found in the corpus directory '" + directory + "'"};
+    }
+
+    // Sort the corpus so that the shaders are split across the threads deterministically.
+    std::sort(corpus.begin(), corpus.end(),
+              [](const CorpusShader& a, const CorpusShader& b) { return a.path < b.path; });
+
+    for (auto& compiler : Compilers()) {
+        std::string name = "Corpus/" + compiler.backend;
+        benchmark::RegisterBenchmark(name.c_str(),
+                                     [&compiler](benchmark::State& state) {
+                                         CompileCorpus(state, compiler);
+                                     })
+            ->ThreadRange(1, std::max(max_threads, 1))
+            ->UseRealTime();
+    }
+    return Success;
+}
+
+}  // namespace tint::bench
@@ -0,0 +1,69 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_CMD_BENCH_CORPUS_H_
+#define SRC_TINT_CMD_BENCH_CORPUS_H_
+
+#include <string>
+#include <string_view>
+
+#include "src/tint/lang/wgsl/program/program.h"
+#include "src/tint/utils/macros/static_init.h"
+#include "src/tint/utils/result/result.h"
+
+namespace tint::bench {
+
+/// CorpusCompileFn is the signature of the function that compiles a shader of the corpus with a
+/// single backend.
+using CorpusCompileFn = Result<SuccessType> (*)(const Program& program);
+
+/// Registers a backend compiler with the corpus benchmarks.
+/// @param backend the name of the backend, used to name the benchmark
+/// @param compile the function that compiles a shader with the backend
+void RegisterCorpusCompiler(std::string_view backend, CorpusCompileFn compile);
+
+/// Loads the `.wgsl` and `.spv` shaders found in @p directory, and registers a `Corpus/<backend>`
+/// benchmark for each registered compiler. Each iteration of a benchmark parses and compiles the
+/// whole corpus, split across 1, 2, 4, ..., @p max_threads threads. The benchmarks report:
+/// • `items_per_second`: the number of shaders compiled per second.
+/// • `{parse,compile}_p{50,90,99}_us`: the percentiles of the per-shader duration of each stage,
+///   averaged across the threads.
+/// • `peak_rss_MB`: the peak resident set size of the process so far, where it is known.
+/// • `scaling_efficiency`: the throughput relative to `threads` times the single thread throughput.
+/// @param directory the path to the corpus directory
+/// @param max_threads the maximum number of threads to compile the corpus with
+/// @returns success, or a failure if the corpus could not be loaded
+Result<SuccessType> RegisterCorpusBenchmarks(const std::string& directory, int max_threads);
+
+/// TINT_BENCHMARK_CORPUS_COMPILER registers FUNCTION to compile the shaders of the corpus for the
+/// backend BACKEND. FUNCTION must have the signature CorpusCompileFn.
+#define TINT_BENCHMARK_CORPUS_COMPILER(BACKEND, FUNCTION) \
+    TINT_STATIC_INIT(::tint::bench::RegisterCorpusCompiler(BACKEND, FUNCTION))
+
+}  // namespace tint::bench
+
+#endif  // SRC_TINT_CMD_BENCH_CORPUS_H_
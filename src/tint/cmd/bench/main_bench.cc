@@ -25,16 +25,55 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <new>
+#include <string>
+#include <thread>
 
 #include "src/tint/cmd/bench/bench.h"
-#include "src/tint/utils/text/string.h"
+#include "src/tint/cmd/bench/corpus.h"
 
 namespace {
 
 // Toggle to use the Google Benchmark output format instead of the Chromium Perf format.
 static bool use_chrome_perf_format = false;
 
+// The directory of shaders to benchmark with the corpus benchmarks. Empty if not set.
+static std::string corpus_directory;
+
+// The maximum number of threads used to compile the corpus.
+static int corpus_max_threads = static_cast<int>(std::thread::hardware_concurrency());
+
+#ifdef TINT_BENCHMARK_COUNT_ALLOCATIONS
+// Toggle to report the number of heap allocations made by each benchmark.
+static bool count_allocations = false;
+
+/// The heap allocation counters, only updated while `allocation_counting_enabled` is true.
+std::atomic<bool> allocation_counting_enabled{false};
+std::atomic<int64_t> allocation_count{0};
+std::atomic<int64_t> allocation_bytes{0};
+
+/// AllocationCounter is a benchmark memory manager that reports the number of calls to the global
+/// operator new, and the number of bytes they requested, made while running a benchmark.
+class AllocationCounter final : public benchmark::MemoryManager {
+  public:
+    void Start() override {
+        allocation_count = 0;
+        allocation_bytes = 0;
+        allocation_counting_enabled = true;
+    }
+
+    void Stop(Result& result) override {
+        allocation_counting_enabled = false;
+        result.num_allocs = allocation_count;
+        result.total_allocated_bytes = allocation_bytes;
+    }
+};
+#endif  // TINT_BENCHMARK_COUNT_ALLOCATIONS
+
 /// ChromePerfReporter is a custom benchmark reporter used to output benchmark results in the format
 /// required for the Chrome Perf waterfall, as described here:
 /// [chromium]//src/tools/perf/generate_legacy_perf_dashboard_json.py
@@ -55,14 +94,16 @@ class ChromePerfReporter final : public benchmark::BenchmarkReporter {
                 continue;
             }
 
-            auto graph_and_trace = tint::Split(fullname, "/");
-            TINT_ASSERT(graph_and_trace.Length() <= 2u);
-            if (graph_and_trace.Length() == 1u) {
-                graph_and_trace.Push(graph_and_trace[0]);
-                graph_and_trace[0] = "TintInternals";
+            // The graph is the part of the name before the first '/', and the trace the rest of
+            // the name, which includes the benchmark arguments such as `threads:4`.
+            std::string graph = "TintInternals";
+            std::string trace = fullname;
+            if (auto slash = fullname.find('/'); slash != std::string::npos) {
+                graph = fullname.substr(0, slash);
+                trace = fullname.substr(slash + 1);
             }
 
-            std::cout << "*RESULT " << graph_and_trace[0] << ": " << graph_and_trace[1] << "= "
+            std::cout << "*RESULT " << graph << ": " << trace << "= "
                       << std::fixed << run.GetAdjustedRealTime() << " ";
             switch (run.time_unit) {
                 case benchmark::kNanosecond:
@@ -89,6 +130,18 @@ bool ParseExtraCommandLineArgs(int argc, char** argv) {
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "--use-chrome-perf-format") == 0) {
             use_chrome_perf_format = true;
+        } else if (strcmp(argv[i], "--count-allocations") == 0) {
+#ifdef TINT_BENCHMARK_COUNT_ALLOCATIONS
+            count_allocations = true;
+#else
+            std::cerr << "--count-allocations requires building with "
+                         "TINT_BENCHMARK_COUNT_ALLOCATIONS\n";
+            return false;
+#endif
+        } else if (strncmp(argv[i], "--corpus=", 9) == 0) {
+            corpus_directory = argv[i] + 9;
+        } else if (strncmp(argv[i], "--corpus-threads=", 17) == 0) {
+            corpus_max_threads = atoi(argv[i] + 17);
         } else {
             // Accept the flags that are passed by the Chromium perf waterfall, which treats this
             // executable as a GoogleTest binary.
@@ -106,11 +159,48 @@ bool ParseExtraCommandLineArgs(int argc, char** argv) {
 
 }  // namespace
 
+#ifdef TINT_BENCHMARK_COUNT_ALLOCATIONS
+// Replace the global operator new and delete so that the allocations can be counted. The array
+// forms are implemented in terms of these by the standard library.
+void* operator new(size_t size) {
+    if (allocation_counting_enabled.load(std::memory_order_relaxed)) {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        allocation_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+    }
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+#endif  // TINT_BENCHMARK_COUNT_ALLOCATIONS
+
 int main(int argc, char** argv) {
     benchmark::Initialize(&argc, argv);
     if (!ParseExtraCommandLineArgs(argc, argv)) {
         return 1;
     }
+    if (!corpus_directory.empty()) {
+        auto res = tint::bench::RegisterCorpusBenchmarks(corpus_directory, corpus_max_threads);
+        if (res != tint::Success) {
+            std::cerr << res.Failure().reason.Str() << "\n";
+            return 1;
+        }
+    }
+#ifdef TINT_BENCHMARK_COUNT_ALLOCATIONS
+    AllocationCounter allocation_counter;
+    if (count_allocations) {
+        benchmark::RegisterMemoryManager(&allocation_counter);
+    }
+#endif  // TINT_BENCHMARK_COUNT_ALLOCATIONS
     if (use_chrome_perf_format) {
         benchmark::RunSpecifiedBenchmarks(new ChromePerfReporter);
     } else {
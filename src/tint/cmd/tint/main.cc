@@ -26,7 +26,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <charconv>
+#include <chrono>
 #include <cstdio>
+#include <iomanip>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -43,6 +45,7 @@
 #include "src/tint/api/tint.h"
 #include "src/tint/cmd/common/helper.h"
 #include "src/tint/lang/core/ir/disassembler.h"
+#include "src/tint/lang/core/ir/pass_profiler.h"
 #include "src/tint/lang/wgsl/ast/module.h"
 #include "src/tint/lang/wgsl/ast/transform/first_index_offset.h"
 #include "src/tint/lang/wgsl/ast/transform/manager.h"
@@ -191,6 +194,7 @@ struct Options {
     bool dump_ir = false;
     bool use_ir = false;
     bool use_ir_reader = false;
+    bool time_passes = false;
 
 #if TINT_BUILD_SYNTAX_TREE_WRITER
     bool dump_ast = false;
@@ -227,6 +231,43 @@ struct Options {
 #endif  // TINT_BULD_MSL_WRITER
 };
 
+/// PassTimingPrinter collects the profile of each IR pass and prints them to stderr when destroyed.
+class PassTimingPrinter final : public tint::core::ir::PassProfiler {
+  public:
+    ~PassTimingPrinter() override {
+        if (passes_.empty()) {
+            return;
+        }
+
+        std::chrono::nanoseconds total{};
+        std::cerr << "IR pass timings:\n";
+        for (auto& pass : passes_) {
+            total += pass.duration;
+            std::cerr << "  " << std::fixed << std::setprecision(3) << std::setw(10)
+                      << std::chrono::duration<double, std::milli>(pass.duration).count()
+                      << " ms  " << std::setw(8) << pass.instructions_before << " -> "
+                      << std::setw(8) << pass.instructions_after << " instructions  " << pass.name
+                      << "\n";
+        }
+        std::cerr << "  " << std::fixed << std::setprecision(3) << std::setw(10)
+                  << std::chrono::duration<double, std::milli>(total).count() << " ms  total\n";
+    }
+
+    void OnPass(const tint::core::ir::PassProfile& profile) override {
+        passes_.push_back({std::string(profile.name), profile.duration,
+                           profile.instructions_before, profile.instructions_after});
+    }
+
+  private:
+    struct Pass {
+        std::string name;
+        std::chrono::nanoseconds duration;
+        size_t instructions_before;
+        size_t instructions_after;
+    };
+    std::vector<Pass> passes_;
+};
+
 /// @param filename the filename to inspect
 /// @returns the inferred format for the filename suffix
 Format InferFormat(const std::string& filename) {
@@ -360,6 +401,10 @@ When specified, automatically enables MSL validation)",
         "use-ir-reader", "Use the IR for the SPIR-V reader", Default{false});
     TINT_DEFER(opts->use_ir_reader = *use_ir_reader.value);
 
+    auto& time_passes = options.Add<BoolOption>(
+        "time-passes", "Prints the time taken by each IR pass to stderr", Default{false});
+    TINT_DEFER(opts->time_passes = *time_passes.value);
+
     auto& verbose =
         options.Add<BoolOption>("verbose", "Verbose output", ShortName{"v"}, Default{false});
     TINT_DEFER(opts->verbose = *verbose.value);
@@ -1295,6 +1340,12 @@ int main(int argc, const char** argv) {
         return 1;
     }
 
+    PassTimingPrinter pass_timing_printer;
+    std::optional<tint::core::ir::ScopedPassProfiler> pass_profiler;
+    if (options.time_passes) {
+        pass_profiler.emplace(&pass_timing_printer);
+    }
+
     // Implement output format defaults.
     if (options.format == Format::kUnknown) {
         // Try inferring from filename.
@@ -93,4 +93,7 @@ COPTS = [
 }) + select({
     "//src/tint:tint_build_wgsl_writer_true": [ "-DTINT_BUILD_WGSL_WRITER" ],
     "//conditions:default": [],
+}) + select({
+    "//src/tint:tint_benchmark_count_allocations_true": [ "-DTINT_BENCHMARK_COUNT_ALLOCATIONS" ],
+    "//conditions:default": [],
 })
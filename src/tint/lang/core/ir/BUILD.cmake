@@ -119,6 +119,8 @@ tint_add_target(tint_lang_core_ir lib
   lang/core/ir/next_iteration.h
   lang/core/ir/operand_instruction.cc
   lang/core/ir/operand_instruction.h
+  lang/core/ir/pass_profiler.cc
+  lang/core/ir/pass_profiler.h
   lang/core/ir/referenced_functions.h
   lang/core/ir/referenced_module_vars.h
   lang/core/ir/return.cc
@@ -213,6 +215,7 @@ tint_add_target(tint_lang_core_ir_test test
   lang/core/ir/multi_in_block_test.cc
   lang/core/ir/next_iteration_test.cc
   lang/core/ir/operand_instruction_test.cc
+  lang/core/ir/pass_profiler_test.cc
   lang/core/ir/referenced_functions_test.cc
   lang/core/ir/referenced_module_vars_test.cc
   lang/core/ir/return_test.cc
@@ -49,6 +49,10 @@ class BlockParam : public Castable<BlockParam, Value> {
     /// @returns the type of the parameter
     const core::type::Type* Type() const override { return type_; }
 
+    /// Sets the type of the parameter to @p type
+    /// @param type the new type of the parameter
+    void SetType(const core::type::Type* type) { type_ = type; }
+
     /// Sets the block that this parameter belongs to.
     /// @param block the block
     void SetBlock(MultiInBlock* block) { block_ = block; }
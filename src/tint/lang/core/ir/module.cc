@@ -112,7 +112,9 @@ struct FunctionSorter {
 
 }  // namespace
 
-Module::Module() : root_block(blocks.Create<ir::Block>()) {}
+Module::Module() : root_block(blocks.Create<ir::Block>()) {
+    constant_values.types.UseSharedTypes();
+}
 
 Module::Module(Module&&) = default;
 
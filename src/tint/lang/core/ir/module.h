@@ -94,7 +94,9 @@ class Module {
     /// @returns the pointer to the value
     template <typename TYPE, typename... ARGS>
     TYPE* CreateValue(ARGS&&... args) {
-        return allocators_.values.Create<TYPE>(std::forward<ARGS>(args)...);
+        TYPE* value = allocators_.values.Create<TYPE>(std::forward<ARGS>(args)...);
+        static_cast<Value*>(value)->uses_.SetArena(allocators_.usages.get());
+        return value;
     }
 
     /// @param inst the instruction
@@ -183,6 +185,10 @@ class Module {
 
         /// The value allocator
         BlockAllocator<Value> values;
+
+        /// The allocator of the usage sets of the values. Held by pointer so that the values
+        /// keep pointing at it when the module is moved.
+        std::unique_ptr<UsageArena> usages = std::make_unique<UsageArena>();
     } allocators_;
 
     Instruction::Id next_instruction_id_ = 0;
@@ -0,0 +1,79 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/pass_profiler.h"
+
+#include "src/tint/lang/core/ir/module.h"
+
+namespace tint::core::ir {
+
+namespace {
+
+/// The profiler activated on this thread, if any.
+thread_local PassProfiler* tl_profiler = nullptr;
+
+/// @returns the number of alive instructions in @p module
+size_t CountInstructions(const Module& module) {
+    size_t count = 0;
+    for ([[maybe_unused]] auto* inst : module.Instructions()) {
+        count++;
+    }
+    return count;
+}
+
+}  // namespace
+
+PassProfiler::~PassProfiler() = default;
+
+ScopedPassProfiler::ScopedPassProfiler(PassProfiler* profiler) : previous_(tl_profiler) {
+    tl_profiler = profiler;
+}
+
+ScopedPassProfiler::~ScopedPassProfiler() {
+    tl_profiler = previous_;
+}
+
+PassTimer::PassTimer(std::string_view name, const Module& module)
+    : profiler_(tl_profiler), module_(module) {
+    if (!profiler_) {
+        return;
+    }
+    profile_.name = name;
+    profile_.instructions_before = CountInstructions(module_);
+    start_ = std::chrono::steady_clock::now();
+}
+
+PassTimer::~PassTimer() {
+    if (!profiler_) {
+        return;
+    }
+    profile_.duration = std::chrono::steady_clock::now() - start_;
+    profile_.instructions_after = CountInstructions(module_);
+    profiler_->OnPass(profile_);
+}
+
+}  // namespace tint::core::ir
@@ -0,0 +1,110 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_PASS_PROFILER_H_
+#define SRC_TINT_LANG_CORE_IR_PASS_PROFILER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+// Forward declarations
+namespace tint::core::ir {
+class Module;
+}  // namespace tint::core::ir
+
+namespace tint::core::ir {
+
+/// The measurements of a single pass run on an IR module.
+struct PassProfile {
+    /// The name of the pass
+    std::string_view name;
+    /// The wall time taken by the pass
+    std::chrono::nanoseconds duration{};
+    /// The number of instructions in the module before the pass ran
+    size_t instructions_before = 0;
+    /// The number of instructions in the module after the pass ran
+    size_t instructions_after = 0;
+};
+
+/// PassProfiler is the interface of the sinks that receive the profile of each IR pass.
+/// A profiler is only notified of the passes run on the thread that activated it with a
+/// ScopedPassProfiler.
+class PassProfiler {
+  public:
+    /// Destructor
+    virtual ~PassProfiler();
+
+    /// Called once a pass has finished running.
+    /// @param profile the measurements of the pass. @p profile.name is only valid for the duration
+    /// of the call.
+    virtual void OnPass(const PassProfile& profile) = 0;
+};
+
+/// ScopedPassProfiler makes a PassProfiler receive the profiles of the passes run on the current
+/// thread for its lifetime, restoring the previously active profiler when destroyed.
+class ScopedPassProfiler {
+  public:
+    /// Constructor
+    /// @param profiler the profiler to activate
+    explicit ScopedPassProfiler(PassProfiler* profiler);
+
+    /// Destructor
+    ~ScopedPassProfiler();
+
+  private:
+    ScopedPassProfiler(const ScopedPassProfiler&) = delete;
+    ScopedPassProfiler& operator=(const ScopedPassProfiler&) = delete;
+
+    PassProfiler* previous_;
+};
+
+/// PassTimer measures a pass run on @p module from its construction to its destruction, and
+/// reports it to the active PassProfiler. It does nothing when no profiler is active.
+class PassTimer {
+  public:
+    /// Constructor
+    /// @param name the name of the pass. Must outlive the timer.
+    /// @param module the module the pass runs on
+    PassTimer(std::string_view name, const Module& module);
+
+    /// Destructor
+    ~PassTimer();
+
+  private:
+    PassTimer(const PassTimer&) = delete;
+    PassTimer& operator=(const PassTimer&) = delete;
+
+    PassProfiler* profiler_;
+    const Module& module_;
+    PassProfile profile_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace tint::core::ir
+
+#endif  // SRC_TINT_LANG_CORE_IR_PASS_PROFILER_H_
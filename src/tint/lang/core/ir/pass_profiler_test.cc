@@ -0,0 +1,109 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/pass_profiler.h"
+
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "src/tint/lang/core/ir/ir_helper_test.h"
+
+namespace tint::core::ir {
+namespace {
+
+using namespace tint::core::fluent_types;     // NOLINT
+using namespace tint::core::number_suffixes;  // NOLINT
+
+class RecordingProfiler : public PassProfiler {
+  public:
+    void OnPass(const PassProfile& profile) override {
+        names.push_back(std::string(profile.name));
+        profiles.push_back(profile);
+    }
+
+    std::vector<std::string> names;
+    std::vector<PassProfile> profiles;
+};
+
+using IR_PassProfilerTest = IRTestHelper;
+
+TEST_F(IR_PassProfilerTest, NoActiveProfiler) {
+    auto* func = b.Function("f", ty.void_());
+    b.Append(func->Block(), [&] { b.Return(func); });
+    auto before = str();
+
+    RecordingProfiler profiler;
+    {
+        ScopedPassProfiler scope(&profiler);
+        PassTimer timer("with_profiler", mod);
+    }
+    // The profiler is no longer active, so this pass is not recorded.
+    { PassTimer timer("without_profiler", mod); }
+
+    EXPECT_THAT(profiler.names, testing::ElementsAre("with_profiler"));
+    EXPECT_EQ(str(), before);
+}
+
+TEST_F(IR_PassProfilerTest, CountsInstructions) {
+    auto* func = b.Function("f", ty.void_());
+    b.Append(func->Block(), [&] { b.Return(func); });
+
+    RecordingProfiler profiler;
+    ScopedPassProfiler scope(&profiler);
+    {
+        PassTimer timer("add_var", mod);
+        func->Block()->Prepend(b.Var(ty.ptr<function, i32>()));
+    }
+    {
+        PassTimer timer("remove_var", mod);
+        func->Block()->Front()->Destroy();
+    }
+
+    EXPECT_THAT(profiler.names, testing::ElementsAre("add_var", "remove_var"));
+    EXPECT_EQ(profiler.profiles[0].instructions_before, 1u);
+    EXPECT_EQ(profiler.profiles[0].instructions_after, 2u);
+    EXPECT_EQ(profiler.profiles[1].instructions_before, 2u);
+    EXPECT_EQ(profiler.profiles[1].instructions_after, 1u);
+}
+
+TEST_F(IR_PassProfilerTest, NestedScopesRestorePrevious) {
+    RecordingProfiler outer;
+    RecordingProfiler inner;
+    ScopedPassProfiler outer_scope(&outer);
+    {
+        ScopedPassProfiler inner_scope(&inner);
+        PassTimer timer("inner", mod);
+    }
+    { PassTimer timer("outer", mod); }
+
+    EXPECT_THAT(inner.names, testing::ElementsAre("inner"));
+    EXPECT_THAT(outer.names, testing::ElementsAre("outer"));
+}
+
+}  // namespace
+}  // namespace tint::core::ir
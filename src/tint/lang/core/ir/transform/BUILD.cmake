@@ -73,6 +73,8 @@ tint_add_target(tint_lang_core_ir_transform lib
   lang/core/ir/transform/remove_terminator_args.h
   lang/core/ir/transform/rename_conflicts.cc
   lang/core/ir/transform/rename_conflicts.h
+  lang/core/ir/transform/rename_symbols.cc
+  lang/core/ir/transform/rename_symbols.h
   lang/core/ir/transform/robustness.cc
   lang/core/ir/transform/robustness.h
   lang/core/ir/transform/shader_io.cc
@@ -139,6 +141,7 @@ tint_add_target(tint_lang_core_ir_transform_test test
   lang/core/ir/transform/remove_continue_in_switch_test.cc
   lang/core/ir/transform/remove_terminator_args_test.cc
   lang/core/ir/transform/rename_conflicts_test.cc
+  lang/core/ir/transform/rename_symbols_test.cc
   lang/core/ir/transform/robustness_test.cc
   lang/core/ir/transform/single_entry_point_test.cc
   lang/core/ir/transform/std140_test.cc
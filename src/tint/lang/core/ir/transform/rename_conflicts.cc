@@ -40,6 +40,8 @@
 #include "src/tint/lang/core/ir/transform/rename_conflicts.h"
 #include "src/tint/lang/core/ir/validator.h"
 #include "src/tint/lang/core/ir/var.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/atomic.h"
 #include "src/tint/lang/core/type/matrix.h"
 #include "src/tint/lang/core/type/pointer.h"
 #include "src/tint/lang/core/type/scalar.h"
@@ -73,6 +75,13 @@ struct State {
         // Process the types
         for (auto* ty : ir.Types()) {
             EnsureResolvable(ty);
+            // Types held by the shared type pool are not listed by ir.Types(), so also visit the
+            // member types of the structures.
+            if (auto* str = ty->As<core::type::Struct>()) {
+                for (auto* member : str->Members()) {
+                    EnsureResolvable(member->Type());
+                }
+            }
         }
 
         // Process the module-scope variable declarations
@@ -225,6 +234,8 @@ struct State {
                                             tint::ToString(m->Rows()));
                     return m->Type();
                 },
+                [&](const core::type::Array* a) { return a->ElemType(); },
+                [&](const core::type::Atomic* a) { return a->Type(); },
                 [&](const core::type::Pointer* p) {
                     EnsureResolvesToBuiltin(tint::ToString(p->Access()));
                     EnsureResolvesToBuiltin(tint::ToString(p->AddressSpace()));
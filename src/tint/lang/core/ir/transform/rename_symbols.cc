@@ -0,0 +1,219 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/rename_symbols.h"
+
+#include <string>
+
+#include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/splat.h"
+#include "src/tint/lang/core/ir/builder.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/validator.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/pointer.h"
+#include "src/tint/lang/core/type/struct.h"
+#include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/text/string.h"
+
+namespace tint::core::ir::transform {
+
+namespace {
+
+/// PIMPL state for the transform.
+struct State {
+    /// The IR module.
+    Module& ir;
+
+    /// The IR builder.
+    Builder b{ir};
+
+    /// The type manager.
+    core::type::Manager& ty{ir.Types()};
+
+    /// Map of original symbol to the generated symbol.
+    Hashmap<Symbol, Symbol, 32> renamed{};
+
+    /// Map of original type to the type that uses the renamed structures.
+    Hashmap<const core::type::Type*, const core::type::Type*, 16> rewritten_types{};
+
+    /// Process the module.
+    SymbolRemappings Process() {
+        // Rename the user-declared structures and their members. Types are immutable, so the
+        // renamed structures are created as new types which then replace the original ones.
+        Vector<const core::type::Struct*, 8> user_structs;
+        for (auto* type : ty) {
+            if (auto* str = type->As<core::type::Struct>(); str && IsUserStruct(str)) {
+                Rename(str->Name());
+                for (auto* member : str->Members()) {
+                    Rename(member->Name());
+                }
+                user_structs.Push(str);
+            }
+        }
+        if (!user_structs.IsEmpty()) {
+            ReplaceStructTypes(user_structs);
+        }
+
+        // Rename the functions and every named value. Functions are values, so they are covered
+        // by the walk over all of the module's values.
+        for (auto* value : ir.Values()) {
+            if (auto name = ir.NameOf(value); name.IsValid()) {
+                ir.SetName(value, Rename(name));
+            }
+        }
+
+        SymbolRemappings remappings;
+        for (auto& it : renamed) {
+            remappings.emplace(it.key.Value().Name(), it.value.Name());
+        }
+        return remappings;
+    }
+
+    /// @param str the structure
+    /// @returns true if @p str is declared by the user, as opposed to builtin structures (e.g.
+    /// the result of frexp()) which keep their names
+    bool IsUserStruct(const core::type::Struct* str) {
+        return !tint::HasPrefix(str->Name().NameView(), "__");
+    }
+
+    /// Create the renamed structures and replace the types of all the functions and values that
+    /// use the user-declared structures.
+    /// @param user_structs the user-declared structures
+    void ReplaceStructTypes(VectorRef<const core::type::Struct*> user_structs) {
+        for (auto* str : user_structs) {
+            RewriteType(str);
+        }
+
+        for (auto& func : ir.functions) {
+            func->SetReturnType(RewriteType(func->ReturnType()));
+        }
+
+        // Constants are shared and hold a constant value of the original type, so they are
+        // replaced by new constants after the walk over the values.
+        Vector<Constant*, 8> constants;
+        for (auto* value : ir.Values()) {
+            tint::Switch(
+                value,  //
+                [&](InstructionResult* res) { res->SetType(RewriteType(res->Type())); },
+                [&](FunctionParam* param) { param->SetType(RewriteType(param->Type())); },
+                [&](BlockParam* param) { param->SetType(RewriteType(param->Type())); },
+                [&](Constant* constant) {
+                    if (RewriteType(constant->Type()) != constant->Type()) {
+                        constants.Push(constant);
+                    }
+                });
+        }
+        for (auto* constant : constants) {
+            constant->ReplaceAllUsesWith(b.Constant(RewriteConstant(constant->Value())));
+        }
+    }
+
+    /// @param type the original type
+    /// @returns @p type with the user-declared structures replaced by the renamed structures
+    const core::type::Type* RewriteType(const core::type::Type* type) {
+        return rewritten_types.GetOrAdd(type, [&] {
+            return tint::Switch(
+                type,
+                [&](const core::type::Struct* str) -> const core::type::Type* {
+                    if (!IsUserStruct(str)) {
+                        return str;
+                    }
+                    Vector<const core::type::StructMember*, 8> members;
+                    for (auto* member : str->Members()) {
+                        members.Push(ty.Get<core::type::StructMember>(
+                            Rename(member->Name()), RewriteType(member->Type()), member->Index(),
+                            member->Offset(), member->Align(), member->Size(),
+                            member->Attributes()));
+                    }
+                    auto* new_str = ty.Struct(Rename(str->Name()), std::move(members));
+                    for (auto flag : str->StructFlags()) {
+                        new_str->SetStructFlag(flag);
+                    }
+                    return new_str;
+                },
+                [&](const core::type::Array* arr) -> const core::type::Type* {
+                    auto* elem = RewriteType(arr->ElemType());
+                    if (elem == arr->ElemType()) {
+                        return arr;
+                    }
+                    return ty.Get<core::type::Array>(elem, arr->Count(), arr->Align(),
+                                                     arr->Size(), arr->Stride(),
+                                                     arr->ImplicitStride());
+                },
+                [&](const core::type::Pointer* ptr) -> const core::type::Type* {
+                    auto* store_type = RewriteType(ptr->StoreType());
+                    if (store_type == ptr->StoreType()) {
+                        return ptr;
+                    }
+                    return ty.ptr(ptr->AddressSpace(), store_type, ptr->Access());
+                },
+                [&](Default) { return type; });
+        });
+    }
+
+    /// @param value the original constant value
+    /// @returns @p value with the user-declared structures replaced by the renamed structures
+    const core::constant::Value* RewriteConstant(const core::constant::Value* value) {
+        auto* type = RewriteType(value->Type());
+        if (type == value->Type()) {
+            return value;
+        }
+        return tint::Switch(
+            value,
+            [&](const core::constant::Splat* splat) -> const core::constant::Value* {
+                return ir.constant_values.Splat(type, RewriteConstant(splat->el));
+            },
+            [&](const core::constant::Composite* composite) -> const core::constant::Value* {
+                Vector<const core::constant::Value*, 8> elements;
+                for (auto* el : composite->elements) {
+                    elements.Push(RewriteConstant(el));
+                }
+                return ir.constant_values.Composite(type, std::move(elements));
+            },
+            TINT_ICE_ON_NO_MATCH);
+    }
+
+    /// @param symbol the original symbol
+    /// @returns the generated symbol for @p symbol
+    Symbol Rename(Symbol symbol) {
+        return renamed.GetOrAdd(symbol, [&] { return ir.symbols.New("tint_symbol"); });
+    }
+};
+
+}  // namespace
+
+Result<SymbolRemappings> RenameSymbols(Module& ir) {
+    auto result = ValidateAndDumpIfNeeded(ir, "RenameSymbols transform");
+    if (result != Success) {
+        return result.Failure();
+    }
+
+    return State{ir}.Process();
+}
+
+}  // namespace tint::core::ir::transform
@@ -0,0 +1,271 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/rename_symbols.h"
+
+#include <string>
+
+#include "src/tint/lang/core/ir/transform/helper_test.h"
+
+namespace tint::core::ir::transform {
+namespace {
+
+using namespace tint::core::fluent_types;     // NOLINT
+using namespace tint::core::number_suffixes;  // NOLINT
+
+using IR_RenameSymbolsTest = TransformTest;
+
+TEST_F(IR_RenameSymbolsTest, Functions) {
+    auto* foo = b.Function("foo", ty.void_());
+    b.Append(foo->Block(), [&] { b.Return(foo); });
+
+    auto* main = b.Function("main", ty.void_(), Function::PipelineStage::kFragment);
+    b.Append(main->Block(), [&] {
+        b.Call(foo);
+        b.Return(main);
+    });
+
+    auto* src = R"(
+%foo = func():void {
+  $B1: {
+    ret
+  }
+}
+%main = @fragment func():void {
+  $B2: {
+    %3:void = call %foo
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%tint_symbol = func():void {
+  $B1: {
+    ret
+  }
+}
+%tint_symbol_1 = @fragment func():void {
+  $B2: {
+    %3:void = call %tint_symbol
+    ret
+  }
+}
+)";
+
+    Run(RenameSymbols);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_RenameSymbolsTest, VarsLetsAndStructs) {
+    auto* s = ty.Struct(mod.symbols.New("S"), {{mod.symbols.New("a"), ty.i32()}});
+    auto* v = b.Var("v", ty.ptr(private_, s));
+    mod.root_block->Append(v);
+
+    auto* main = b.Function("main", ty.void_(), Function::PipelineStage::kFragment);
+    b.Append(main->Block(), [&] {
+        b.Let("x", b.Load(v));
+        b.Return(main);
+    });
+
+    auto* src = R"(
+S = struct @align(4) {
+  a:i32 @offset(0)
+}
+
+$B1: {  # root
+  %v:ptr<private, S, read_write> = var
+}
+
+%main = @fragment func():void {
+  $B2: {
+    %3:S = load %v
+    %x:S = let %3
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+S = struct @align(4) {
+  a:i32 @offset(0)
+}
+
+tint_symbol = struct @align(4) {
+  tint_symbol_1:i32 @offset(0)
+}
+
+$B1: {  # root
+  %tint_symbol_2:ptr<private, tint_symbol, read_write> = var
+}
+
+%tint_symbol_3 = @fragment func():void {
+  $B2: {
+    %3:tint_symbol = load %tint_symbol_2
+    %tint_symbol_4:tint_symbol = let %3
+    ret
+  }
+}
+)";
+
+    Run(RenameSymbols);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_RenameSymbolsTest, Remappings) {
+    auto* foo = b.Function("foo", ty.void_());
+    b.Append(foo->Block(), [&] {
+        b.Let("x", 1_i);
+        b.Return(foo);
+    });
+
+    auto* main = b.Function("main", ty.void_(), Function::PipelineStage::kFragment);
+    b.Append(main->Block(), [&] {
+        b.Let("x", 2_i);
+        b.Call(foo);
+        b.Return(main);
+    });
+
+    auto result = RenameSymbols(mod);
+    ASSERT_EQ(result, Success);
+
+    auto& remappings = result.Get();
+    EXPECT_EQ(remappings.size(), 3u);
+    EXPECT_EQ(mod.NameOf(main).Name(), remappings["main"]);
+    EXPECT_EQ(mod.NameOf(foo).Name(), remappings["foo"]);
+    EXPECT_NE(remappings["main"], "main");
+
+    // Both lets share the same original name, so they share the same new name.
+    EXPECT_NE(remappings["x"], "x");
+}
+
+TEST_F(IR_RenameSymbolsTest, StructMembers) {
+    auto* s = ty.Struct(mod.symbols.New("S"), {{mod.symbols.New("position"), ty.vec4<f32>()},
+                                               {mod.symbols.Register("color"), ty.vec4<f32>()}});
+    auto* t = ty.Struct(mod.symbols.New("T"), {{mod.symbols.Register("color"), ty.f32()}});
+
+    auto result = RenameSymbols(mod);
+    ASSERT_EQ(result, Success);
+
+    auto& remappings = result.Get();
+    auto* new_s = ty.Find<core::type::Struct>(mod.symbols.Get(remappings["S"]));
+    auto* new_t = ty.Find<core::type::Struct>(mod.symbols.Get(remappings["T"]));
+    ASSERT_NE(new_s, nullptr);
+    ASSERT_NE(new_t, nullptr);
+    EXPECT_EQ(new_s->Members()[0]->Name().Name(), remappings["position"]);
+    EXPECT_EQ(new_s->Members()[1]->Name().Name(), remappings["color"]);
+    EXPECT_NE(remappings["position"], "position");
+    EXPECT_NE(remappings["color"], "color");
+
+    // Members that share a name, even in different structures, share the same new name.
+    EXPECT_EQ(new_t->Members()[0]->Name().Name(), remappings["color"]);
+
+    // The renamed members can still be found by their new name.
+    EXPECT_EQ(new_s->FindMember(mod.symbols.Get(remappings["color"])), new_s->Members()[1]);
+
+    // The original structures are left untouched.
+    EXPECT_EQ(s->Name().Name(), "S");
+    EXPECT_EQ(s->Members()[0]->Name().Name(), "position");
+    EXPECT_EQ(t->Members()[0]->Name().Name(), "color");
+}
+
+TEST_F(IR_RenameSymbolsTest, NestedStructsAndConstants) {
+    auto* inner = ty.Struct(mod.symbols.New("Inner"), {{mod.symbols.New("a"), ty.i32()}});
+    auto* outer =
+        ty.Struct(mod.symbols.New("Outer"), {{mod.symbols.New("b"), ty.array(inner, 2)}});
+
+    auto* func = b.Function("f", outer);
+    auto* param = b.FunctionParam("p", inner);
+    func->SetParams({param});
+    b.Append(func->Block(), [&] {
+        auto* zero = b.Constant(mod.constant_values.Zero(outer));
+        b.Return(func, zero);
+    });
+
+    auto* src = R"(
+Inner = struct @align(4) {
+  a:i32 @offset(0)
+}
+
+Outer = struct @align(4) {
+  b:array<Inner, 2> @offset(0)
+}
+
+%f = func(%p:Inner):Outer {
+  $B1: {
+    ret Outer(array<Inner, 2>(Inner(0i)))
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+Inner = struct @align(4) {
+  a:i32 @offset(0)
+}
+
+Outer = struct @align(4) {
+  b:array<Inner, 2> @offset(0)
+}
+
+tint_symbol = struct @align(4) {
+  tint_symbol_1:i32 @offset(0)
+}
+
+tint_symbol_2 = struct @align(4) {
+  tint_symbol_3:array<tint_symbol, 2> @offset(0)
+}
+
+%tint_symbol_4 = func(%tint_symbol_5:tint_symbol):tint_symbol_2 {
+  $B1: {
+    ret tint_symbol_2(array<tint_symbol, 2>(tint_symbol(0i)))
+  }
+}
+)";
+
+    Run(RenameSymbols);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_RenameSymbolsTest, BuiltinStructsAreNotRenamed) {
+    auto* s = ty.Struct(mod.symbols.New("__frexp_result_f32"),
+                        {{mod.symbols.New("fract"), ty.f32()}, {mod.symbols.New("exp"), ty.i32()}});
+
+    auto result = RenameSymbols(mod);
+    ASSERT_EQ(result, Success);
+
+    EXPECT_EQ(s->Name().Name(), "__frexp_result_f32");
+    EXPECT_TRUE(result->empty());
+}
+
+}  // namespace
+}  // namespace tint::core::ir::transform
@@ -192,7 +192,7 @@ struct State {
                     }
                     break;
                 case 1: {  // Single usage
-                    auto usage = (*usages.begin())->instruction;
+                    auto usage = usages.begin()->instruction;
                     if (usage->Block() == inst->Block()) {
                         // Usage in same block. Assign to pending_resolution, as we don't
                         // know whether its safe to inline yet.
@@ -32,46 +32,197 @@
 #include "src/tint/lang/core/ir/constant.h"
 #include "src/tint/lang/core/ir/instruction.h"
 #include "src/tint/utils/ice/ice.h"
+#include "src/tint/utils/math/math.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::core::ir::Value);
 
 namespace tint::core::ir {
 
-Value::Value() = default;
+UsageArena::UsageArena() = default;
 
-Value::~Value() = default;
+UsageArena::~UsageArena() = default;
 
-void Value::Destroy() {
-    TINT_ASSERT(Alive());
-    flags_.Add(Flag::kDead);
+Usage* UsageArena::Allocate(size_t capacity) {
+    TINT_ASSERT(IsPowerOfTwo(capacity));
+    Usage* table = nullptr;
+    if (auto*& free_table = free_tables_[Log2(capacity)]) {
+        table = reinterpret_cast<Usage*>(free_table);
+        free_table = free_table->next;
+    } else {
+        table = reinterpret_cast<Usage*>(allocator_.Allocate(capacity * sizeof(Usage)));
+        TINT_ASSERT(table);
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        new (&table[i]) Usage{};
+    }
+    return table;
+}
+
+void UsageArena::Free(Usage* table, size_t capacity) {
+    auto*& free_table = free_tables_[Log2(capacity)];
+    free_table = new (table) FreeTable{free_table};
+}
+
+UsageSet::~UsageSet() {
+    // Tables drawn from the arena are freed with the module.
+    if (table_ && !arena_) {
+        FreeTable(table_, capacity_);
+    }
+}
+
+void UsageSet::SetArena(UsageArena* arena) {
+    TINT_ASSERT(!table_);
+    arena_ = arena;
+}
+
+bool UsageSet::Add(const Usage& usage) {
+    if (Contains(usage)) {
+        return false;
+    }
+    if (!table_) {
+        if (count_ < kInlineCapacity) {
+            inline_[count_++] = usage;
+            return true;
+        }
+        Grow(kMinTableCapacity);
+    } else if ((count_ + 1) * 2 > capacity_) {
+        Grow(capacity_ * 2);
+    }
+    Insert(usage);
+    count_++;
+    return true;
+}
+
+bool UsageSet::Remove(const Usage& usage) {
+    if (!table_) {
+        for (size_t i = 0; i < count_; i++) {
+            if (inline_[i] == usage) {
+                inline_[i] = inline_[--count_];
+                inline_[count_] = Usage{};
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t hole = Find(usage);
+    if (hole == capacity_) {
+        return false;
+    }
+
+    // Shift the following usages of the probe sequence back into the hole, so that no tombstones
+    // are needed to keep them reachable.
+    size_t mask = capacity_ - 1;
+    for (size_t i = (hole + 1) & mask; table_[i].instruction; i = (i + 1) & mask) {
+        size_t slot = SlotOf(table_[i]);
+        // The usage can fill the hole if its slot is not cyclically in (hole, i].
+        if (((i - slot) & mask) >= ((i - hole) & mask)) {
+            table_[hole] = table_[i];
+            hole = i;
+        }
+    }
+    table_[hole] = Usage{};
+    count_--;
+    return true;
 }
 
-void Value::ForEachUseUnsorted(std::function<void(Usage use)> func) const {
-    auto uses = uses_;
-    for (auto& use : uses) {
-        func(use);
+bool UsageSet::Contains(const Usage& usage) const {
+    if (!table_) {
+        for (size_t i = 0; i < count_; i++) {
+            if (inline_[i] == usage) {
+                return true;
+            }
+        }
+        return false;
     }
+    return Find(usage) != capacity_;
 }
 
-void Value::ForEachUseSorted(std::function<void(Usage use)> func) const {
-    auto uses = UsagesSorted();
-    for (auto& use : uses) {
-        func(use);
+void UsageSet::Release() {
+    TINT_ASSERT(IsEmpty());
+    if (table_) {
+        FreeTable(table_, capacity_);
+        table_ = nullptr;
+        capacity_ = 0;
+    }
+}
+
+size_t UsageSet::Find(const Usage& usage) const {
+    size_t mask = capacity_ - 1;
+    for (size_t i = SlotOf(usage); table_[i].instruction; i = (i + 1) & mask) {
+        if (table_[i] == usage) {
+            return i;
+        }
+    }
+    return capacity_;
+}
+
+void UsageSet::Insert(const Usage& usage) {
+    size_t mask = capacity_ - 1;
+    size_t i = SlotOf(usage);
+    while (table_[i].instruction) {
+        i = (i + 1) & mask;
+    }
+    table_[i] = usage;
+}
+
+void UsageSet::Grow(size_t capacity) {
+    Usage* old_table = table_;
+    size_t old_capacity = capacity_;
+
+    table_ = AllocateTable(capacity);
+    capacity_ = capacity;
+    if (old_table) {
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old_table[i].instruction) {
+                Insert(old_table[i]);
+            }
+        }
+        FreeTable(old_table, old_capacity);
+    } else {
+        for (size_t i = 0; i < count_; i++) {
+            Insert(inline_[i]);
+            inline_[i] = Usage{};
+        }
+    }
+}
+
+Usage* UsageSet::AllocateTable(size_t capacity) {
+    return arena_ ? arena_->Allocate(capacity) : new Usage[capacity]{};
+}
+
+void UsageSet::FreeTable(Usage* table, size_t capacity) {
+    if (arena_) {
+        arena_->Free(table, capacity);
+    } else {
+        delete[] table;
+    }
+}
+
+Value::Value() = default;
+
+Value::~Value() = default;
+
+void Value::Destroy() {
+    TINT_ASSERT(Alive());
+    flags_.Add(Flag::kDead);
+    if (uses_.IsEmpty()) {
+        uses_.Release();
     }
 }
 
 void Value::ReplaceAllUsesWith(std::function<Value*(Usage use)> replacer) {
     while (!uses_.IsEmpty()) {
-        auto& use = *uses_.begin();
+        auto use = *uses_.begin();
         auto* replacement = replacer(use);
-        use->instruction->SetOperand(use->operand_index, replacement);
+        use.instruction->SetOperand(use.operand_index, replacement);
     }
 }
 
 void Value::ReplaceAllUsesWith(Value* replacement) {
     while (!uses_.IsEmpty()) {
-        auto& use = *uses_.begin();
-        use->instruction->SetOperand(use->operand_index, replacement);
+        auto use = *uses_.begin();
+        use.instruction->SetOperand(use.operand_index, replacement);
     }
 }
 
@@ -28,14 +28,21 @@
 #ifndef SRC_TINT_LANG_CORE_IR_VALUE_H_
 #define SRC_TINT_LANG_CORE_IR_VALUE_H_
 
+#include <array>
+#include <cstddef>
+#include <iterator>
+
 #include "src/tint/lang/core/type/type.h"
-#include "src/tint/utils/containers/hashset.h"
+#include "src/tint/utils/containers/enum_set.h"
+#include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/memory/bump_allocator.h"
 #include "src/tint/utils/rtti/castable.h"
 
 // Forward declarations
 namespace tint::core::ir {
 class CloneContext;
 class Instruction;
+class Module;
 }  // namespace tint::core::ir
 
 namespace tint::core::ir {
@@ -74,6 +81,210 @@ struct Usage {
     }
 };
 
+/// UsageArena holds the hash tables of the usage sets that outgrow their inline storage, for all
+/// the values of a module. The tables are drawn from a BumpAllocator that is freed with the
+/// module, and the tables released by usage sets that grow or are destroyed are reused for later
+/// tables of the same capacity.
+class UsageArena {
+  public:
+    /// Constructor
+    UsageArena();
+    /// Destructor
+    ~UsageArena();
+
+    /// @param capacity the number of usages in the table, a power of two
+    /// @returns a table of @p capacity empty usages
+    Usage* Allocate(size_t capacity);
+
+    /// Returns a table to the arena, for reuse by a later Allocate() of the same capacity.
+    /// @param table the table returned by Allocate()
+    /// @param capacity the capacity that @p table was allocated with
+    void Free(Usage* table, size_t capacity);
+
+    /// @returns the number of tables allocated from the underlying BumpAllocator
+    size_t Count() const { return allocator_.Count(); }
+
+  private:
+    /// A table that has been freed, stored in the table's own memory.
+    struct FreeTable {
+        FreeTable* next;
+    };
+
+    /// The allocator of the tables.
+    BumpAllocator allocator_;
+
+    /// The freed tables, indexed by the log2 of their capacity.
+    std::array<FreeTable*, 64> free_tables_{};
+};
+
+/// UsageSet is the set of the usages of a value. The first few usages are stored inline. A set
+/// that outgrows them moves to an open-addressed hash table drawn from the module's UsageArena,
+/// or from the heap for values that were not created by a module.
+class UsageSet {
+  public:
+    /// An iterator over the usages of the set.
+    class Iterator {
+      public:
+        /// The iterator category
+        using iterator_category = std::forward_iterator_tag;
+        /// The type of the elements
+        using value_type = Usage;
+        /// The type of the difference between two iterators
+        using difference_type = std::ptrdiff_t;
+        /// The type of a pointer to an element
+        using pointer = const Usage*;
+        /// The type of a reference to an element
+        using reference = const Usage&;
+
+        /// @returns the usage
+        const Usage& operator*() const { return *current_; }
+        /// @returns a pointer to the usage
+        const Usage* operator->() const { return current_; }
+
+        /// Increments the iterator to the next usage
+        /// @returns this iterator
+        Iterator& operator++() {
+            ++current_;
+            SkipEmpty();
+            return *this;
+        }
+
+        /// @param other the other iterator
+        /// @returns true if this iterator is equal to @p other
+        bool operator==(const Iterator& other) const { return current_ == other.current_; }
+        /// @param other the other iterator
+        /// @returns true if this iterator is not equal to @p other
+        bool operator!=(const Iterator& other) const { return current_ != other.current_; }
+
+      private:
+        friend UsageSet;
+        Iterator(const Usage* current, const Usage* end) : current_(current), end_(end) {
+            SkipEmpty();
+        }
+        void SkipEmpty() {
+            while (current_ != end_ && current_->instruction == nullptr) {
+                ++current_;
+            }
+        }
+
+        const Usage* current_ = nullptr;
+        const Usage* end_ = nullptr;
+    };
+
+    /// The type of the elements
+    using value_type = Usage;
+    /// The iterator type
+    using iterator = Iterator;
+    /// The const iterator type
+    using const_iterator = Iterator;
+
+    /// Constructor
+    UsageSet() = default;
+    /// Destructor
+    ~UsageSet();
+
+    /// Sets the arena that the hash table is drawn from. Must be called before the set outgrows its
+    /// inline storage.
+    /// @param arena the arena
+    void SetArena(UsageArena* arena);
+
+    /// Adds a usage to the set.
+    /// @param usage the usage
+    /// @returns true if the usage was added, false if it was already in the set
+    bool Add(const Usage& usage);
+
+    /// Removes a usage from the set.
+    /// @param usage the usage
+    /// @returns true if the usage was removed, false if it was not in the set
+    bool Remove(const Usage& usage);
+
+    /// @param usage the usage
+    /// @returns true if the set contains @p usage
+    bool Contains(const Usage& usage) const;
+
+    /// Releases the hash table of an empty set, so that the arena can reuse it.
+    void Release();
+
+    /// @returns the number of usages in the set
+    size_t Count() const { return count_; }
+
+    /// @returns true if the set is empty
+    bool IsEmpty() const { return count_ == 0; }
+
+    /// @param pred the predicate
+    /// @returns true if @p pred returns true for all of the usages of the set
+    template <typename PRED>
+    bool All(PRED&& pred) const {
+        for (auto& usage : *this) {
+            if (!pred(usage)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @returns the usages of the set in a vector
+    template <size_t N = 4>
+    tint::Vector<Usage, N> Vector() const {
+        tint::Vector<Usage, N> usages;
+        usages.Reserve(count_);
+        for (auto& usage : *this) {
+            usages.Push(usage);
+        }
+        return usages;
+    }
+
+    /// @returns an iterator to the first usage of the set
+    Iterator begin() const {
+        return table_ ? Iterator{table_, table_ + capacity_}
+                      : Iterator{inline_.data(), inline_.data() + count_};
+    }
+
+    /// @returns an iterator past the last usage of the set
+    Iterator end() const {
+        return table_ ? Iterator{table_ + capacity_, table_ + capacity_}
+                      : Iterator{inline_.data() + count_, inline_.data() + count_};
+    }
+
+  private:
+    /// The number of usages stored inline, before the set moves to a hash table.
+    static constexpr size_t kInlineCapacity = 4;
+    /// The capacity of the first hash table.
+    static constexpr size_t kMinTableCapacity = 16;
+
+    UsageSet(const UsageSet&) = delete;
+    UsageSet& operator=(const UsageSet&) = delete;
+
+    /// @returns the slot that @p usage hashes to in the hash table
+    size_t SlotOf(const Usage& usage) const { return usage.HashCode() & (capacity_ - 1); }
+
+    /// @returns the slot of @p usage in the hash table, or `capacity_` if it is not in the set
+    size_t Find(const Usage& usage) const;
+
+    /// Inserts @p usage into the hash table, which must have a free slot.
+    void Insert(const Usage& usage);
+
+    /// Moves the usages to a new hash table of @p capacity slots.
+    void Grow(size_t capacity);
+
+    /// Allocates a hash table of @p capacity slots.
+    Usage* AllocateTable(size_t capacity);
+
+    /// Frees the hash table @p table of @p capacity slots.
+    void FreeTable(Usage* table, size_t capacity);
+
+    /// The usages, when the set has no hash table. Packed in [0, count_).
+    std::array<Usage, kInlineCapacity> inline_{};
+    /// The hash table, or nullptr if the usages are stored inline.
+    Usage* table_ = nullptr;
+    /// The number of slots of the hash table.
+    size_t capacity_ = 0;
+    /// The number of usages in the set.
+    size_t count_ = 0;
+    /// The arena that the hash table is drawn from, or nullptr to use the heap.
+    UsageArena* arena_ = nullptr;
+};
+
 /// Value in the IR.
 class Value : public Castable<Value> {
   public:
@@ -104,7 +315,7 @@ class Value : public Castable<Value> {
 
     /// @returns the set of usages of this value. An instruction may appear multiple times if it
     /// uses the value for multiple different operands.
-    const Hashset<Usage, 4>& UsagesUnsorted() { return uses_; }
+    const UsageSet& UsagesUnsorted() { return uses_; }
 
     /// @returns a sorted list of usages of this value. The usages are in the order of
     /// <instruction, operand index> where the instructions are ordered earliest instruction to
@@ -127,12 +338,27 @@ class Value : public Castable<Value> {
     /// Apply a function to all uses of the value that exist prior to calling this method. The uses
     /// are in unsorted ordered.
     /// @param func the function will be applied to each use
-    void ForEachUseUnsorted(std::function<void(Usage use)> func) const;
+    template <typename FUNC>
+    void ForEachUseUnsorted(FUNC&& func) const {
+        // Snapshot the uses, as `func` may add or remove uses of this value. The snapshot is a
+        // vector rather than a copy of the set, so that it only needs a heap allocation for
+        // values with many uses.
+        auto uses = uses_.Vector<kUsagesSnapshotSize>();
+        for (auto& use : uses) {
+            func(use);
+        }
+    }
 
     /// Apply a function to all uses of the value that exist prior to calling this method. The uses
     /// are sorted in (instruction,operand) order
     /// @param func the function will be applied to each use
-    void ForEachUseSorted(std::function<void(Usage use)> func) const;
+    template <typename FUNC>
+    void ForEachUseSorted(FUNC&& func) const {
+        auto uses = UsagesSorted();
+        for (auto& use : uses) {
+            func(use);
+        }
+    }
 
     /// Replace all uses of the value.
     /// @param replacer a function which returns a replacement for a given use
@@ -147,13 +373,19 @@ class Value : public Castable<Value> {
     Value();
 
   private:
+    /// Module sets the usage arena of the values it creates.
+    friend Module;
+
+    /// The number of uses that ForEachUseUnsorted() can snapshot without a heap allocation.
+    static constexpr size_t kUsagesSnapshotSize = 16;
+
     /// Flags applied to an Value
     enum class Flag {
         /// The value has been destroyed
         kDead,
     };
 
-    Hashset<Usage, 4> uses_;
+    UsageSet uses_;
 
     /// Bitset of value flags
     tint::EnumSet<Flag> flags_;
@@ -90,6 +90,86 @@ TEST_F(IR_ValueTest, Usages) {
     EXPECT_EQ(usages[3].operand_index, 1u);
 }
 
+TEST_F(IR_ValueTest, ManyUsages) {
+    // More usages than fit inline, so that the usages move to a table from the module's arena.
+    auto* target = b.Let(ty.i32())->Result(0);
+    Vector<Instruction*, 64> insts;
+    for (uint32_t i = 0; i < 64; i++) {
+        insts.Push(b.Construct(ty.i32(), 1_i));
+        target->AddUsage(Usage{insts.Back(), 0});
+        target->AddUsage(Usage{insts.Back(), 1});
+    }
+    EXPECT_EQ(target->NumUsages(), 128u);
+
+    for (uint32_t i = 0; i < 64; i += 2) {
+        target->RemoveUsage(Usage{insts[i], 0});
+    }
+    EXPECT_EQ(target->NumUsages(), 96u);
+    for (uint32_t i = 0; i < 64; i++) {
+        EXPECT_EQ(target->HasUsage(insts[i], 0), i % 2 == 1);
+        EXPECT_TRUE(target->HasUsage(insts[i], 1));
+    }
+
+    size_t count = 0;
+    for (auto& usage : target->UsagesUnsorted()) {
+        EXPECT_TRUE(target->HasUsage(usage.instruction, usage.operand_index));
+        count++;
+    }
+    EXPECT_EQ(count, 96u);
+
+    auto sorted = target->UsagesSorted();
+    ASSERT_EQ(sorted.Length(), 96u);
+    for (size_t i = 1; i < sorted.Length(); i++) {
+        EXPECT_LT(sorted[i - 1], sorted[i]);
+    }
+}
+
+TEST_F(IR_ValueTest, UsageSetWithoutArena) {
+    auto* i1 = b.Construct(ty.i32(), 1_i);
+    auto* i2 = b.Construct(ty.i32(), 2_i);
+
+    UsageSet usages;
+    for (size_t i = 0; i < 32; i++) {
+        EXPECT_TRUE(usages.Add(Usage{i1, i}));
+    }
+    EXPECT_FALSE(usages.Add(Usage{i1, 0}));
+    EXPECT_TRUE(usages.Add(Usage{i2, 0}));
+    EXPECT_EQ(usages.Count(), 33u);
+
+    for (size_t i = 0; i < 32; i++) {
+        EXPECT_TRUE(usages.Remove(Usage{i1, i}));
+    }
+    EXPECT_FALSE(usages.Remove(Usage{i1, 0}));
+    EXPECT_THAT(usages, testing::UnorderedElementsAre(Usage{i2, 0}));
+}
+
+TEST_F(IR_ValueTest, UsageArenaReusesTables) {
+    UsageArena arena;
+    auto* i1 = b.Construct(ty.i32(), 1_i);
+
+    {
+        UsageSet usages;
+        usages.SetArena(&arena);
+        for (size_t i = 0; i < 8; i++) {
+            usages.Add(Usage{i1, i});
+        }
+        for (size_t i = 0; i < 8; i++) {
+            usages.Remove(Usage{i1, i});
+        }
+        usages.Release();
+    }
+    EXPECT_EQ(arena.Count(), 1u);
+
+    // The released table is reused by the next set that outgrows its inline storage.
+    UsageSet usages;
+    usages.SetArena(&arena);
+    for (size_t i = 0; i < 8; i++) {
+        usages.Add(Usage{i1, i});
+    }
+    EXPECT_EQ(arena.Count(), 1u);
+    EXPECT_EQ(usages.Count(), 8u);
+}
+
 TEST_F(IR_ValueDeathTest, Destroy_HasSource) {
     EXPECT_DEATH_IF_SUPPORTED(
         {
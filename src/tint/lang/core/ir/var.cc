@@ -78,8 +78,8 @@ void Var::DestroyIfOnlyAssigned() {
     if (result->UsagesUnsorted().All(
             [](const Usage& u) { return u.instruction->Is<ir::Store>(); })) {
         while (result->IsUsed()) {
-            auto& usage = *result->UsagesUnsorted().begin();
-            usage->instruction->Destroy();
+            auto usage = *result->UsagesUnsorted().begin();
+            usage.instruction->Destroy();
         }
         Destroy();
     }
@@ -33,14 +33,18 @@
 #include "src/tint/lang/core/type/abstract_int.h"
 #include "src/tint/lang/core/type/array.h"
 #include "src/tint/lang/core/type/bool.h"
+#include "src/tint/lang/core/type/depth_multisampled_texture.h"
+#include "src/tint/lang/core/type/depth_texture.h"
 #include "src/tint/lang/core/type/f16.h"
 #include "src/tint/lang/core/type/f32.h"
 #include "src/tint/lang/core/type/i32.h"
 #include "src/tint/lang/core/type/i8.h"
 #include "src/tint/lang/core/type/invalid.h"
 #include "src/tint/lang/core/type/matrix.h"
+#include "src/tint/lang/core/type/multisampled_texture.h"
 #include "src/tint/lang/core/type/pointer.h"
 #include "src/tint/lang/core/type/reference.h"
+#include "src/tint/lang/core/type/sampled_texture.h"
 #include "src/tint/lang/core/type/type.h"
 #include "src/tint/lang/core/type/u32.h"
 #include "src/tint/lang/core/type/u8.h"
@@ -58,6 +62,62 @@ Manager& Manager::operator=(Manager&& rhs) = default;
 
 Manager::~Manager() = default;
 
+const Manager& Manager::Shared() {
+    // Built once on first use, and intentionally leaked so that the shared types outlive every
+    // Program and IR module that refers to them. After construction the Manager is never
+    // modified, so lookups from multiple threads need no synchronization.
+    static const Manager* shared = [] {
+        auto* mgr = new Manager();
+        auto add = [&](auto* ty) {
+            ty->shared_ = true;
+            return ty;
+        };
+
+        add(mgr->Get<Invalid>());
+        add(mgr->Get<Void>());
+        const Type* scalars[] = {
+            add(mgr->Get<Bool>()), add(mgr->Get<I32>()),          add(mgr->Get<U32>()),
+            add(mgr->Get<F32>()),  add(mgr->Get<F16>()),          add(mgr->Get<AbstractInt>()),
+            add(mgr->Get<AbstractFloat>()),
+        };
+        add(mgr->Get<I8>());
+        add(mgr->Get<U8>());
+
+        for (auto* el : scalars) {
+            for (uint32_t width = 2; width <= 4; width++) {
+                add(mgr->Get<Vector>(el, width));
+            }
+        }
+        for (auto* el : {scalars[3], scalars[4], scalars[6]}) {
+            for (uint32_t rows = 2; rows <= 4; rows++) {
+                auto* column = mgr->Get<Vector>(el, rows);
+                for (uint32_t columns = 2; columns <= 4; columns++) {
+                    add(mgr->Get<Matrix>(column, columns));
+                }
+            }
+        }
+
+        add(mgr->Get<Sampler>(SamplerKind::kSampler));
+        add(mgr->Get<Sampler>(SamplerKind::kComparisonSampler));
+        add(mgr->Get<ExternalTexture>());
+        for (auto* el : {scalars[1], scalars[2], scalars[3]}) {
+            for (auto dim : {TextureDimension::k1d, TextureDimension::k2d,
+                             TextureDimension::k2dArray, TextureDimension::k3d,
+                             TextureDimension::kCube, TextureDimension::kCubeArray}) {
+                add(mgr->Get<SampledTexture>(dim, el));
+            }
+            add(mgr->Get<MultisampledTexture>(TextureDimension::k2d, el));
+        }
+        for (auto dim : {TextureDimension::k2d, TextureDimension::k2dArray, TextureDimension::kCube,
+                         TextureDimension::kCubeArray}) {
+            add(mgr->Get<DepthTexture>(dim));
+        }
+        add(mgr->Get<DepthMultisampledTexture>(TextureDimension::k2d));
+        return mgr;
+    }();
+    return *shared;
+}
+
 const core::type::Invalid* Manager::invalid() {
     return Get<core::type::Invalid>();
 }
@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_CORE_TYPE_MANAGER_H_
 #define SRC_TINT_LANG_CORE_TYPE_MANAGER_H_
 
+#include <type_traits>
 #include <utility>
 
 #include "src/tint/lang/core/access.h"
@@ -50,14 +51,18 @@ class AbstractFloat;
 class AbstractInt;
 class Array;
 class Bool;
+class DepthMultisampledTexture;
+class DepthTexture;
 class F16;
 class F32;
 class I8;
 class I32;
 class Invalid;
 class Matrix;
+class MultisampledTexture;
 class Pointer;
 class Reference;
+class SampledTexture;
 class U8;
 class U32;
 class Vector;
@@ -122,9 +127,37 @@ class Manager final {
         Manager out;
         out.types_.Wrap(inner.types_);
         out.unique_nodes_.Wrap(inner.unique_nodes_);
+        out.shared_ = inner.shared_;
         return out;
     }
 
+    /// @returns the process-wide Manager holding the pre-built common types (scalars, vectors,
+    /// matrices, samplers and the common texture types). The returned Manager is immutable and
+    /// lives for the duration of the process, so it can be read from multiple threads without
+    /// locking.
+    static const Manager& Shared();
+
+    /// UseSharedTypes makes this Manager resolve the common types from Shared() instead of
+    /// constructing its own copies. Types obtained from two Managers that both use the shared
+    /// types compare pointer-equal, and cloning them between the two Managers is free.
+    /// @note must be called before any type is constructed with this Manager.
+    void UseSharedTypes() { shared_ = &Shared(); }
+
+    /// @returns true if this Manager resolves the common types from Shared()
+    bool UsesSharedTypes() const { return shared_ != nullptr; }
+
+    /// @param ty the type to look up
+    /// @returns @p ty if it is owned by Shared() and this Manager uses the shared types, otherwise
+    /// nullptr.
+    template <typename T>
+    T* FindShared(const T* ty) const {
+        if (shared_ != nullptr && ty->IsShared()) {
+            // Shared types are immutable once Shared() has been constructed.
+            return const_cast<T*>(ty);
+        }
+        return nullptr;
+    }
+
     /// Constructs or returns an existing type, unique node or node
     /// @param args the arguments used to construct the type, unique node or node.
     /// @tparam T a class deriving from core::type::Node, or a C-like type that's automatically
@@ -166,6 +199,13 @@ class Manager final {
         } else if constexpr (core::fluent_types::IsAtomic<T>) {
             return atomic<typename T::type>(std::forward<ARGS>(args)...);
         } else if constexpr (tint::traits::IsTypeOrDerived<T, Type>) {
+            if constexpr (kIsShareable<T>) {
+                if (shared_ != nullptr) {
+                    if (auto* ty = shared_->types_.Find<T>(args...)) {
+                        return ty;
+                    }
+                }
+            }
             return types_.Get<T>(std::forward<ARGS>(args)...);
         } else if constexpr (tint::traits::IsTypeOrDerived<T, UniqueNode>) {
             return unique_nodes_.Get<T>(std::forward<ARGS>(args)...);
@@ -181,6 +221,13 @@ class Manager final {
               typename _ = std::enable_if<tint::traits::IsTypeOrDerived<TYPE, Type>>,
               typename... ARGS>
     auto* Find(ARGS&&... args) const {
+        if constexpr (kIsShareable<TYPE>) {
+            if (shared_ != nullptr) {
+                if (auto* ty = shared_->types_.Find<TYPE>(args...)) {
+                    return ty;
+                }
+            }
+        }
         return types_.Find<TYPE>(std::forward<ARGS>(args)...);
     }
 
@@ -608,17 +655,36 @@ class Manager final {
     core::type::ExternalTexture* external_texture() { return Get<core::type::ExternalTexture>(); }
 
     /// @returns an iterator to the beginning of the types
+    /// @note types resolved from Shared() are not owned by this Manager, and are not iterated.
     TypeIterator begin() const { return types_.begin(); }
     /// @returns an iterator to the end of the types
     TypeIterator end() const { return types_.end(); }
 
   private:
+    /// True if `T` is one of the types that Shared() may hold.
+    template <typename T>
+    static constexpr bool kIsShareable =
+        std::is_same_v<T, core::type::Invalid> || std::is_same_v<T, core::type::Void> ||
+        std::is_same_v<T, core::type::Bool> || std::is_same_v<T, core::type::I8> ||
+        std::is_same_v<T, core::type::I32> || std::is_same_v<T, core::type::U8> ||
+        std::is_same_v<T, core::type::U32> || std::is_same_v<T, core::type::F32> ||
+        std::is_same_v<T, core::type::F16> || std::is_same_v<T, core::type::AbstractInt> ||
+        std::is_same_v<T, core::type::AbstractFloat> || std::is_same_v<T, core::type::Vector> ||
+        std::is_same_v<T, core::type::Matrix> || std::is_same_v<T, core::type::Sampler> ||
+        std::is_same_v<T, core::type::SampledTexture> ||
+        std::is_same_v<T, core::type::DepthTexture> ||
+        std::is_same_v<T, core::type::MultisampledTexture> ||
+        std::is_same_v<T, core::type::DepthMultisampledTexture> ||
+        std::is_same_v<T, core::type::ExternalTexture>;
+
     /// Unique types owned by the manager
     UniqueAllocator<Type> types_;
     /// Unique nodes (excluding types) owned by the manager
     UniqueAllocator<UniqueNode> unique_nodes_;
     /// Non-unique nodes owned by the manager
     BlockAllocator<Node> nodes_;
+    /// The shared type pool consulted before `types_`, or nullptr
+    const Manager* shared_ = nullptr;
 };
 
 }  // namespace tint::core::type
@@ -30,6 +30,7 @@
 #include "gtest/gtest.h"
 #include "src/tint/lang/core/type/array.h"
 #include "src/tint/lang/core/type/bool.h"
+#include "src/tint/lang/core/type/clone_context.h"
 #include "src/tint/lang/core/type/f16.h"
 #include "src/tint/lang/core/type/f32.h"
 #include "src/tint/lang/core/type/i32.h"
@@ -138,6 +139,77 @@ TEST_F(ManagerTest, WrapDoesntAffectInner) {
     EXPECT_EQ(count(outer), 1u);
 }
 
+TEST_F(ManagerTest, SharedTypes) {
+    Manager a;
+    Manager b;
+    a.UseSharedTypes();
+    b.UseSharedTypes();
+    EXPECT_TRUE(a.UsesSharedTypes());
+
+    auto* vec_a = a.vec4<f32>();
+    auto* vec_b = b.vec4<f32>();
+    EXPECT_EQ(vec_a, vec_b);
+    EXPECT_TRUE(vec_a->IsShared());
+    EXPECT_EQ(a.mat3x3<f16>(), b.mat3x3<f16>());
+    EXPECT_EQ(a.Find<Vector>(a.f32(), 4u), vec_a);
+
+    // Shared types are not owned by either manager.
+    EXPECT_EQ(count(a), 0u);
+    EXPECT_EQ(count(b), 0u);
+}
+
+TEST_F(ManagerTest, SharedTypesNotUsed) {
+    Manager shared;
+    Manager local;
+    shared.UseSharedTypes();
+    EXPECT_FALSE(local.UsesSharedTypes());
+
+    auto* vec = local.vec4<f32>();
+    EXPECT_NE(vec, shared.vec4<f32>());
+    EXPECT_FALSE(vec->IsShared());
+    EXPECT_EQ(count(local), 2u);
+}
+
+TEST_F(ManagerTest, SharedTypesUncommonType) {
+    Manager a;
+    Manager b;
+    a.UseSharedTypes();
+    b.UseSharedTypes();
+
+    auto* arr = a.array<f32, 4>();
+    EXPECT_NE(arr, b.array<f32, 4>());
+    EXPECT_FALSE(arr->IsShared());
+    EXPECT_EQ(arr->ElemType(), b.f32());
+    EXPECT_EQ(count(a), 1u);
+}
+
+TEST_F(ManagerTest, SharedTypesWrap) {
+    Manager inner;
+    inner.UseSharedTypes();
+    Manager outer = Manager::Wrap(inner);
+
+    EXPECT_TRUE(outer.UsesSharedTypes());
+    EXPECT_EQ(inner.vec2<i32>(), outer.vec2<i32>());
+}
+
+TEST_F(ManagerTest, SharedTypesClone) {
+    Manager src;
+    Manager dst;
+    src.UseSharedTypes();
+    dst.UseSharedTypes();
+
+    CloneContext ctx{{nullptr}, {nullptr, &dst}};
+    auto* mat = src.mat4x4<f32>();
+    EXPECT_EQ(mat->Clone(ctx), mat);
+    EXPECT_EQ(count(dst), 0u);
+
+    Manager local;
+    CloneContext local_ctx{{nullptr}, {nullptr, &local}};
+    auto* cloned = mat->Clone(local_ctx);
+    EXPECT_NE(cloned, mat);
+    EXPECT_EQ(cloned, local.mat4x4<f32>());
+}
+
 TEST_F(ManagerTest, ArrayImplicitStride) {
     Manager tm;
     auto* arr = tm.array<mat4x4<f32>, 4>();
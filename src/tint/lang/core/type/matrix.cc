@@ -92,6 +92,9 @@ const Vector* Matrix::Element(uint32_t index) const {
 }
 
 Matrix* Matrix::Clone(CloneContext& ctx) const {
+    if (auto* shared = ctx.dst.mgr->FindShared(this)) {
+        return shared;
+    }
     auto* col_ty = column_type_->Clone(ctx);
     return ctx.dst.mgr->Get<Matrix>(col_ty, columns_);
 }
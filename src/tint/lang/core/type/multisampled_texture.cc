@@ -59,6 +59,9 @@ std::string MultisampledTexture::FriendlyName() const {
 }
 
 MultisampledTexture* MultisampledTexture::Clone(CloneContext& ctx) const {
+    if (auto* shared = ctx.dst.mgr->FindShared(this)) {
+        return shared;
+    }
     auto* ty = type_->Clone(ctx);
     return ctx.dst.mgr->Get<MultisampledTexture>(Dim(), ty);
 }
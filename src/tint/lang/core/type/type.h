@@ -42,6 +42,7 @@ class ProgramBuilder;
 class SymbolTable;
 }  // namespace tint
 namespace tint::core::type {
+class Manager;
 class Type;
 }  // namespace tint::core::type
 
@@ -129,6 +130,9 @@ class Type : public Castable<Type, UniqueNode> {
     /// @see https://www.w3.org/TR/WGSL/#fixed-footprint-types
     inline bool HasFixedFootprint() const { return flags_.Contains(Flag::kFixedFootprint); }
 
+    /// @returns true if this type is owned by the process-wide Manager::Shared() type pool
+    inline bool IsShared() const { return shared_; }
+
     /// @returns true if this type is a float scalar
     bool IsFloatScalar() const;
     /// @returns true if this type is a float matrix
@@ -235,6 +239,12 @@ class Type : public Castable<Type, UniqueNode> {
 
     /// The flags of this type.
     const core::type::Flags flags_;
+
+  private:
+    friend class Manager;
+
+    /// True if this type is owned by Manager::Shared()
+    bool shared_ = false;
 };
 
 }  // namespace tint::core::type
@@ -86,6 +86,9 @@ uint32_t Vector::Align() const {
 }
 
 Vector* Vector::Clone(CloneContext& ctx) const {
+    if (auto* shared = ctx.dst.mgr->FindShared(this)) {
+        return shared;
+    }
     auto* subtype = subtype_->Clone(ctx);
     return ctx.dst.mgr->Get<Vector>(subtype, width_, packed_);
 }
@@ -28,6 +28,7 @@
 #include "src/tint/lang/glsl/writer/raise/raise.h"
 
 #include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/pass_profiler.h"
 #include "src/tint/lang/core/ir/transform/add_empty_entry_point.h"
 #include "src/tint/lang/core/ir/transform/array_length_from_uniform.h"
 #include "src/tint/lang/core/ir/transform/bgra8unorm_polyfill.h"
@@ -63,12 +64,13 @@
 namespace tint::glsl::writer {
 
 Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
-#define RUN_TRANSFORM(name, ...)         \
-    do {                                 \
-        auto result = name(__VA_ARGS__); \
-        if (result != Success) {         \
-            return result.Failure();     \
-        }                                \
+#define RUN_TRANSFORM(name, ...)                       \
+    do {                                               \
+        core::ir::PassTimer pass_timer(#name, module); \
+        auto result = name(__VA_ARGS__);               \
+        if (result != Success) {                       \
+            return result.Failure();                   \
+        }                                              \
     } while (false)
 
     // Must come before TextureBuiltinsFromUniform as it may add `textureNumLevels` calls.
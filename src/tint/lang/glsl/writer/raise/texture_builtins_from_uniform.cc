@@ -173,7 +173,7 @@ struct State {
 
     void AddUniformArgToCallSites(core::ir::Function* func, uint32_t tex_idx) {
         for (auto usage : func->UsagesUnsorted()) {
-            auto* call = usage->instruction->As<core::ir::UserCall>();
+            auto* call = usage.instruction->As<core::ir::UserCall>();
             if (!call) {
                 continue;
             }
@@ -361,7 +361,7 @@ struct State {
         // For each 1d texture usage we have to make sure return values and arguments are modified
         // to fit the 2d texture.
         for (auto usage : value->UsagesUnsorted()) {
-            if (auto* call = usage->instruction->As<core::ir::CoreBuiltinCall>()) {
+            if (auto* call = usage.instruction->As<core::ir::CoreBuiltinCall>()) {
                 switch (call->Func()) {
                     case core::BuiltinFn::kTextureDimensions: {
                         // Upgrade result to a vec2 and swizzle out the `x` component.
@@ -418,7 +418,7 @@ struct State {
             // All of the usages of the textures should involve loading them as the `var`
             // declarations will be pointers and the function usages require non-pointer textures.
             for (auto usage : var->Result(0)->UsagesUnsorted()) {
-                UpgradeLoadOf1DTexture(usage->instruction);
+                UpgradeLoadOf1DTexture(usage.instruction);
             }
         }
     }
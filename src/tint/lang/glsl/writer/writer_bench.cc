@@ -26,8 +26,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/cmd/bench/corpus.h"
 #include "src/tint/lang/glsl/writer/helpers/generate_bindings.h"
 #include "src/tint/lang/glsl/writer/writer.h"
 #include "src/tint/lang/wgsl/ast/identifier.h"
@@ -40,21 +43,23 @@
 namespace tint::glsl::writer {
 namespace {
 
-void GenerateGLSL(benchmark::State& state, std::string input_name) {
-    auto res = bench::GetWgslProgram(input_name);
-    if (res != Success) {
-        state.SkipWithError(res.Failure().reason.Str());
-        return;
-    }
+/// The program and generator options for a single entry point
+struct EntryPointInput {
+    /// The program, stripped down to the entry point
+    Program program;
+    /// The generator options
+    Options options;
+    /// The entry point name
+    std::string name;
+};
 
-    // Generate the input program and generator options for each entry point.
-    std::vector<Program> programs;
-    std::vector<Options> options;
-    std::vector<std::string> names;
-    tint::inspector::Inspector inspector(res->program);
+/// @returns the input program and generator options for each entry point of @p program
+std::vector<EntryPointInput> GenerateInputs(const Program& program) {
+    std::vector<EntryPointInput> inputs;
+    tint::inspector::Inspector inspector(program);
     for (auto ep : inspector.GetEntryPoints()) {
         tint::glsl::writer::Options gen_options = {};
-        gen_options.bindings = tint::glsl::writer::GenerateBindings(res->program);
+        gen_options.bindings = tint::glsl::writer::GenerateBindings(program);
         gen_options.bindings.texture_builtins_from_uniform.ubo_binding = {4u, 0u};
 
         auto textureBuiltinsFromUniformData = inspector.GetTextureQueries(ep.name);
@@ -71,28 +76,38 @@ void GenerateGLSL(benchmark::State& state, std::string input_name) {
 
         // Run single entry point to strip the program down to a single entry point.
         tint::ast::transform::Manager manager;
-        tint::ast::transform::DataMap inputs;
+        tint::ast::transform::DataMap inputs_data;
         tint::ast::transform::DataMap outputs;
-        inputs.Add<tint::ast::transform::SingleEntryPoint::Config>(ep.name);
+        inputs_data.Add<tint::ast::transform::SingleEntryPoint::Config>(ep.name);
         manager.Add<tint::ast::transform::SingleEntryPoint>();
-        auto program = manager.Run(res->program, inputs, outputs);
+        auto stripped = manager.Run(program, inputs_data, outputs);
 
-        programs.push_back(std::move(program));
-        options.push_back(gen_options);
-        names.push_back(ep.name);
+        inputs.push_back(EntryPointInput{std::move(stripped), gen_options, ep.name});
+    }
+    return inputs;
+}
+
+void GenerateGLSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
     }
 
+    // Generate the input program and generator options for each entry point.
+    auto inputs = GenerateInputs(res->program);
+
     for (auto _ : state) {
-        for (uint32_t i = 0; i < programs.size(); i++) {
+        for (auto& input : inputs) {
             // Convert the AST program to an IR module.
-            auto ir = tint::wgsl::reader::ProgramToLoweredIR(programs[i]);
+            auto ir = tint::wgsl::reader::ProgramToLoweredIR(input.program);
             if (ir != Success) {
                 state.SkipWithError(ir.Failure().reason.Str());
                 return;
             }
 
             // Generate GLSL.
-            auto gen_res = Generate(ir.Get(), options[i], names[i]);
+            auto gen_res = Generate(ir.Get(), input.options, input.name);
             if (gen_res != Success) {
                 state.SkipWithError(gen_res.Failure().reason.Str());
             }
@@ -100,7 +115,22 @@ void GenerateGLSL(benchmark::State& state, std::string input_name) {
     }
 }
 
+Result<SuccessType> CompileGLSL(const Program& program) {
+    for (auto& input : GenerateInputs(program)) {
+        auto ir = tint::wgsl::reader::ProgramToLoweredIR(input.program);
+        if (ir != Success) {
+            return ir.Failure();
+        }
+        auto gen_res = Generate(ir.Get(), input.options, input.name);
+        if (gen_res != Success) {
+            return gen_res.Failure();
+        }
+    }
+    return Success;
+}
+
 TINT_BENCHMARK_PROGRAMS(GenerateGLSL);
+TINT_BENCHMARK_CORPUS_COMPILER("GLSL", CompileGLSL);
 
 }  // namespace
 }  // namespace tint::glsl::writer
@@ -138,8 +138,8 @@ struct State {
         pixel_local_var->Result(0)->SetType(ty.ptr<private_>(pixel_local_struct));
         // As well as the usages
         for (auto& usage : pixel_local_var->Result(0)->UsagesUnsorted()) {
-            if (auto* ptr = usage->instruction->Result(0)->Type()->As<core::type::Pointer>()) {
-                usage->instruction->Result(0)->SetType(ty.ptr<private_>(ptr->StoreType()));
+            if (auto* ptr = usage.instruction->Result(0)->Type()->As<core::type::Pointer>()) {
+                usage.instruction->Result(0)->SetType(ty.ptr<private_>(ptr->StoreType()));
             }
         }
 
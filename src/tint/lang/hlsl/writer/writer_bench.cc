@@ -28,6 +28,7 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/cmd/bench/corpus.h"
 #include "src/tint/lang/hlsl/writer/writer.h"
 
 namespace tint::hlsl::writer {
@@ -47,7 +48,16 @@ void GenerateHLSL_AST(benchmark::State& state, std::string input_name) {
     }
 }
 
+Result<SuccessType> CompileHLSL_AST(const Program& program) {
+    auto gen_res = Generate(program, {});
+    if (gen_res != Success) {
+        return gen_res.Failure();
+    }
+    return Success;
+}
+
 TINT_BENCHMARK_PROGRAMS(GenerateHLSL_AST);
+TINT_BENCHMARK_CORPUS_COMPILER("HLSL", CompileHLSL_AST);
 
 }  // namespace
 }  // namespace tint::hlsl::writer
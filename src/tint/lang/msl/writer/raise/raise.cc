@@ -30,6 +30,7 @@
 #include <utility>
 
 #include "src/tint/api/common/binding_point.h"
+#include "src/tint/lang/core/ir/pass_profiler.h"
 #include "src/tint/lang/core/ir/transform/array_length_from_uniform.h"
 #include "src/tint/lang/core/ir/transform/binary_polyfill.h"
 #include "src/tint/lang/core/ir/transform/binding_remapper.h"
@@ -57,12 +58,13 @@
 namespace tint::msl::writer {
 
 Result<RaiseResult> Raise(core::ir::Module& module, const Options& options) {
-#define RUN_TRANSFORM(name, ...)         \
-    do {                                 \
-        auto result = name(__VA_ARGS__); \
-        if (result != Success) {         \
-            return result.Failure();     \
-        }                                \
+#define RUN_TRANSFORM(name, ...)                       \
+    do {                                               \
+        core::ir::PassTimer pass_timer(#name, module); \
+        auto result = name(__VA_ARGS__);               \
+        if (result != Success) {                       \
+            return result.Failure();                   \
+        }                                              \
     } while (false)
 
     RaiseResult raise_result;
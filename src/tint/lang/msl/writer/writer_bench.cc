@@ -28,6 +28,7 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/cmd/bench/corpus.h"
 #include "src/tint/lang/msl/writer/helpers/generate_bindings.h"
 #include "src/tint/lang/msl/writer/writer.h"
 #include "src/tint/lang/wgsl/ast/module.h"
@@ -38,20 +39,8 @@
 namespace tint::msl::writer {
 namespace {
 
-void GenerateMSL(benchmark::State& state, std::string input_name) {
-    auto res = bench::GetWgslProgram(input_name);
-    if (res != Success) {
-        state.SkipWithError(res.Failure().reason.Str());
-        return;
-    }
-
-    // Remap resource numbers to a flat namespace.
-    const tint::Program* program = &res->program;
-    auto flattened = tint::wgsl::FlattenBindings(res->program);
-    if (flattened) {
-        program = &*flattened;
-    }
-
+/// @returns the generator options for @p program
+Options GenerateOptions(const Program& program) {
     tint::msl::writer::Options gen_options = {};
     gen_options.array_length_from_uniform.ubo_binding = 30;
     gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 0},
@@ -70,7 +59,25 @@ void GenerateMSL(benchmark::State& state, std::string input_name) {
                                                                           6);
     gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 7},
                                                                           7);
-    gen_options.bindings = tint::msl::writer::GenerateBindings(*program);
+    gen_options.bindings = tint::msl::writer::GenerateBindings(program);
+    return gen_options;
+}
+
+void GenerateMSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+
+    // Remap resource numbers to a flat namespace.
+    const tint::Program* program = &res->program;
+    auto flattened = tint::wgsl::FlattenBindings(res->program);
+    if (flattened) {
+        program = &*flattened;
+    }
+
+    auto gen_options = GenerateOptions(*program);
 
     for (auto _ : state) {
         // Convert the AST program to an IR module.
@@ -101,25 +108,7 @@ void GenerateMSL_AST(benchmark::State& state, std::string input_name) {
         program = &*flattened;
     }
 
-    tint::msl::writer::Options gen_options = {};
-    gen_options.array_length_from_uniform.ubo_binding = 30;
-    gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 0},
-                                                                          0);
-    gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 1},
-                                                                          1);
-    gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 2},
-                                                                          2);
-    gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 3},
-                                                                          3);
-    gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 4},
-                                                                          4);
-    gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 5},
-                                                                          5);
-    gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 6},
-                                                                          6);
-    gen_options.array_length_from_uniform.bindpoint_to_size_index.emplace(tint::BindingPoint{0, 7},
-                                                                          7);
-    gen_options.bindings = tint::msl::writer::GenerateBindings(*program);
+    auto gen_options = GenerateOptions(*program);
 
     for (auto _ : state) {
         auto gen_res = Generate(*program, gen_options);
@@ -129,8 +118,28 @@ void GenerateMSL_AST(benchmark::State& state, std::string input_name) {
     }
 }
 
+Result<SuccessType> CompileMSL(const Program& input) {
+    // Remap resource numbers to a flat namespace.
+    const tint::Program* program = &input;
+    auto flattened = tint::wgsl::FlattenBindings(input);
+    if (flattened) {
+        program = &*flattened;
+    }
+
+    auto ir = tint::wgsl::reader::ProgramToLoweredIR(*program);
+    if (ir != Success) {
+        return ir.Failure();
+    }
+    auto gen_res = Generate(ir.Get(), GenerateOptions(*program));
+    if (gen_res != Success) {
+        return gen_res.Failure();
+    }
+    return Success;
+}
+
 TINT_BENCHMARK_PROGRAMS(GenerateMSL);
 TINT_BENCHMARK_PROGRAMS(GenerateMSL_AST);
+TINT_BENCHMARK_CORPUS_COMPILER("MSL", CompileMSL);
 
 }  // namespace
 }  // namespace tint::msl::writer
@@ -76,6 +76,7 @@ if(TINT_BUILD_SPV_READER OR TINT_BUILD_SPV_WRITER)
     tint_lang_spirv_validate
   )
   tint_target_add_external_dependencies(tint_lang_spirv_reader_parser lib
+    "spirv-headers"
     "spirv-opt-internal"
     "spirv-tools"
   )
@@ -90,6 +91,7 @@ if(TINT_BUILD_SPV_READER)
 ################################################################################
 tint_add_target(tint_lang_spirv_reader_parser_test test
   lang/spirv/reader/parser/binary_test.cc
+  lang/spirv/reader/parser/builtin_test.cc
   lang/spirv/reader/parser/composite_test.cc
   lang/spirv/reader/parser/constant_test.cc
   lang/spirv/reader/parser/function_test.cc
@@ -154,8 +154,374 @@ INSTANTIATE_TEST_SUITE_P(SpirvParser,
                                  "vec4u",
                                  "OpIAdd",
                                  "%5:vec4<u32> = add %3, %4",
+                             }},
+
+                             // OpFSub
+                             BinaryCase{
+                                 "f32",
+                                 "OpFSub",
+                                 "%5:f32 = sub %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4f",
+                                 "OpFSub",
+                                 "%5:vec4<f32> = sub %3, %4",
+                             },
+
+                             // OpFDiv
+                             BinaryCase{
+                                 "f32",
+                                 "OpFDiv",
+                                 "%5:f32 = div %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4f",
+                                 "OpFDiv",
+                                 "%5:vec4<f32> = div %3, %4",
+                             },
+
+                             // OpFRem
+                             BinaryCase{
+                                 "f32",
+                                 "OpFRem",
+                                 "%5:f32 = mod %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4f",
+                                 "OpFRem",
+                                 "%5:vec4<f32> = mod %3, %4",
+                             },
+
+                             // OpISub
+                             BinaryCase{
+                                 "i32",
+                                 "OpISub",
+                                 "%5:i32 = sub %3, %4",
+                             },
+                             BinaryCase{
+                                 "u32",
+                                 "OpISub",
+                                 "%5:u32 = sub %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec3i",
+                                 "OpISub",
+                                 "%5:vec3<i32> = sub %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4u",
+                                 "OpISub",
+                                 "%5:vec4<u32> = sub %3, %4",
+                             },
+
+                             // OpIMul
+                             BinaryCase{
+                                 "i32",
+                                 "OpIMul",
+                                 "%5:i32 = mul %3, %4",
+                             },
+                             BinaryCase{
+                                 "u32",
+                                 "OpIMul",
+                                 "%5:u32 = mul %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec3i",
+                                 "OpIMul",
+                                 "%5:vec3<i32> = mul %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4u",
+                                 "OpIMul",
+                                 "%5:vec4<u32> = mul %3, %4",
+                             },
+
+                             // OpSDiv
+                             BinaryCase{
+                                 "i32",
+                                 "OpSDiv",
+                                 "%5:i32 = div %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec3i",
+                                 "OpSDiv",
+                                 "%5:vec3<i32> = div %3, %4",
+                             },
+
+                             // OpUDiv
+                             BinaryCase{
+                                 "u32",
+                                 "OpUDiv",
+                                 "%5:u32 = div %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4u",
+                                 "OpUDiv",
+                                 "%5:vec4<u32> = div %3, %4",
+                             },
+
+                             // OpSRem
+                             BinaryCase{
+                                 "i32",
+                                 "OpSRem",
+                                 "%5:i32 = mod %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec3i",
+                                 "OpSRem",
+                                 "%5:vec3<i32> = mod %3, %4",
+                             },
+
+                             // OpUMod
+                             BinaryCase{
+                                 "u32",
+                                 "OpUMod",
+                                 "%5:u32 = mod %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4u",
+                                 "OpUMod",
+                                 "%5:vec4<u32> = mod %3, %4",
+                             },
+
+                             // OpBitwiseAnd
+                             BinaryCase{
+                                 "i32",
+                                 "OpBitwiseAnd",
+                                 "%5:i32 = and %3, %4",
+                             },
+                             BinaryCase{
+                                 "u32",
+                                 "OpBitwiseAnd",
+                                 "%5:u32 = and %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec3i",
+                                 "OpBitwiseAnd",
+                                 "%5:vec3<i32> = and %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4u",
+                                 "OpBitwiseAnd",
+                                 "%5:vec4<u32> = and %3, %4",
+                             },
+
+                             // OpBitwiseOr
+                             BinaryCase{
+                                 "i32",
+                                 "OpBitwiseOr",
+                                 "%5:i32 = or %3, %4",
+                             },
+                             BinaryCase{
+                                 "u32",
+                                 "OpBitwiseOr",
+                                 "%5:u32 = or %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec3i",
+                                 "OpBitwiseOr",
+                                 "%5:vec3<i32> = or %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4u",
+                                 "OpBitwiseOr",
+                                 "%5:vec4<u32> = or %3, %4",
+                             },
+
+                             // OpBitwiseXor
+                             BinaryCase{
+                                 "i32",
+                                 "OpBitwiseXor",
+                                 "%5:i32 = xor %3, %4",
+                             },
+                             BinaryCase{
+                                 "u32",
+                                 "OpBitwiseXor",
+                                 "%5:u32 = xor %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec3i",
+                                 "OpBitwiseXor",
+                                 "%5:vec3<i32> = xor %3, %4",
+                             },
+                             BinaryCase{
+                                 "vec4u",
+                                 "OpBitwiseXor",
+                                 "%5:vec4<u32> = xor %3, %4",
                              }),
                          PrintBuiltinCase);
 
+TEST_F(SpirvParserTest, SDiv_UnsignedOperands) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+        %u32 = OpTypeInt 32 0
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %u32 %u32 %u32
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+        %foo = OpFunction %u32 None %fn_type
+        %lhs = OpFunctionParameter %u32
+        %rhs = OpFunctionParameter %u32
+  %foo_start = OpLabel
+     %result = OpSDiv %u32 %lhs %rhs
+               OpReturnValue %result
+               OpFunctionEnd
+)",
+              R"(
+  $B2: {
+    %5:i32 = bitcast %3
+    %6:i32 = bitcast %4
+    %7:i32 = div %5, %6
+    %8:u32 = bitcast %7
+    ret %8
+  }
+)");
+}
+
+TEST_F(SpirvParserTest, SLessThan_UnsignedOperands) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+        %u32 = OpTypeInt 32 0
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %bool %u32 %u32
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+        %foo = OpFunction %bool None %fn_type
+        %lhs = OpFunctionParameter %u32
+        %rhs = OpFunctionParameter %u32
+  %foo_start = OpLabel
+     %result = OpSLessThan %bool %lhs %rhs
+               OpReturnValue %result
+               OpFunctionEnd
+)",
+              R"(
+  $B2: {
+    %5:i32 = bitcast %3
+    %6:i32 = bitcast %4
+    %7:bool = lt %5, %6
+    ret %7
+  }
+)");
+}
+
+TEST_F(SpirvParserTest, ULessThan) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+        %u32 = OpTypeInt 32 0
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %bool %u32 %u32
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+        %foo = OpFunction %bool None %fn_type
+        %lhs = OpFunctionParameter %u32
+        %rhs = OpFunctionParameter %u32
+  %foo_start = OpLabel
+     %result = OpULessThan %bool %lhs %rhs
+               OpReturnValue %result
+               OpFunctionEnd
+)",
+              R"(
+  $B2: {
+    %5:bool = lt %3, %4
+    ret %5
+  }
+)");
+}
+
+TEST_F(SpirvParserTest, ShiftRightArithmetic_Unsigned) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+        %u32 = OpTypeInt 32 0
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %u32 %u32 %u32
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+        %foo = OpFunction %u32 None %fn_type
+        %lhs = OpFunctionParameter %u32
+        %rhs = OpFunctionParameter %u32
+  %foo_start = OpLabel
+     %result = OpShiftRightArithmetic %u32 %lhs %rhs
+               OpReturnValue %result
+               OpFunctionEnd
+)",
+              R"(
+  $B2: {
+    %5:i32 = bitcast %3
+    %6:i32 = shr %5, %4
+    %7:u32 = bitcast %6
+    ret %7
+  }
+)");
+}
+
+TEST_F(SpirvParserTest, ShiftRightLogical) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+        %u32 = OpTypeInt 32 0
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %u32 %u32 %u32
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+        %foo = OpFunction %u32 None %fn_type
+        %lhs = OpFunctionParameter %u32
+        %rhs = OpFunctionParameter %u32
+  %foo_start = OpLabel
+     %result = OpShiftRightLogical %u32 %lhs %rhs
+               OpReturnValue %result
+               OpFunctionEnd
+)",
+              R"(
+  $B2: {
+    %5:u32 = shr %3, %4
+    ret %5
+  }
+)");
+}
+
 }  // namespace
 }  // namespace tint::spirv::reader
@@ -0,0 +1,112 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/spirv/reader/parser/helper_test.h"
+
+namespace tint::spirv::reader {
+namespace {
+
+TEST_F(SpirvParserTest, GlslStd450_FMax) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+       %glsl = OpExtInstImport "GLSL.std.450"
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %a "a"
+               OpName %b "b"
+               OpName %max "max"
+       %void = OpTypeVoid
+        %f32 = OpTypeFloat 32
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %f32 %f32 %f32
+
+        %foo = OpFunction %f32 None %fn_type
+          %a = OpFunctionParameter %f32
+          %b = OpFunctionParameter %f32
+  %foo_start = OpLabel
+        %max = OpExtInst %f32 %glsl FMax %a %b
+               OpReturnValue %max
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%a:f32, %b:f32):f32 {
+  $B1: {
+    %max:f32 = max %a, %b
+    ret %max
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, GlslStd450_SAbs_Unsigned) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+       %glsl = OpExtInstImport "GLSL.std.450"
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %a "a"
+               OpName %abs "abs"
+       %void = OpTypeVoid
+        %u32 = OpTypeInt 32 0
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %u32 %u32
+
+        %foo = OpFunction %u32 None %fn_type
+          %a = OpFunctionParameter %u32
+  %foo_start = OpLabel
+        %abs = OpExtInst %u32 %glsl SAbs %a
+               OpReturnValue %abs
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%a:u32):u32 {
+  $B1: {
+    %3:i32 = bitcast %a
+    %4:i32 = abs %3
+    %abs:u32 = bitcast %4
+    ret %abs
+  }
+}
+)");
+}
+
+}  // namespace
+}  // namespace tint::spirv::reader
@@ -460,4 +460,77 @@ tint_symbol_2 = struct @align(4) {
 }
 
 }  // namespace
+
+TEST_F(SpirvParserTest, VectorShuffle_SingleVector) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+        %u32 = OpTypeInt 32 0
+      %vec2u = OpTypeVector %u32 2
+      %vec4u = OpTypeVector %u32 4
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %vec2u %vec4u %vec4u
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+        %foo = OpFunction %vec2u None %fn_type
+       %vec1 = OpFunctionParameter %vec4u
+       %vec2 = OpFunctionParameter %vec4u
+  %foo_start = OpLabel
+    %shuffle = OpVectorShuffle %vec2u %vec1 %vec2 3 1
+               OpReturnValue %shuffle
+               OpFunctionEnd
+)",
+              R"(
+%2 = func(%3:vec4<u32>, %4:vec4<u32>):vec2<u32> {
+  $B2: {
+    %5:vec2<u32> = swizzle %3, wy
+    ret %5
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, VectorShuffle_BothVectors) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+        %u32 = OpTypeInt 32 0
+      %vec2u = OpTypeVector %u32 2
+      %vec4u = OpTypeVector %u32 4
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %vec2u %vec4u %vec4u
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+        %foo = OpFunction %vec2u None %fn_type
+       %vec1 = OpFunctionParameter %vec4u
+       %vec2 = OpFunctionParameter %vec4u
+  %foo_start = OpLabel
+    %shuffle = OpVectorShuffle %vec2u %vec1 %vec2 0 5
+               OpReturnValue %shuffle
+               OpFunctionEnd
+)",
+              R"(
+%2 = func(%3:vec4<u32>, %4:vec4<u32>):vec2<u32> {
+  $B2: {
+    %5:u32 = access %3, 0u
+    %6:u32 = access %4, 1u
+    %7:vec2<u32> = construct %5, %6
+    ret %7
+  }
+}
+)");
+}
+
 }  // namespace tint::spirv::reader
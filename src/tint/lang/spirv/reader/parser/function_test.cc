@@ -521,5 +521,681 @@ TEST_F(SpirvParserTest, FunctionCall_ParamAndReturnValue) {
 )");
 }
 
+TEST_F(SpirvParserTest, Names) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %param "param"
+               OpName %sum "sum"
+       %void = OpTypeVoid
+        %i32 = OpTypeInt 32 1
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %i32 %i32
+
+        %foo = OpFunction %i32 None %fn_type
+      %param = OpFunctionParameter %i32
+  %foo_start = OpLabel
+        %sum = OpIAdd %i32 %param %param
+               OpReturnValue %sum
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%param:i32):i32 {
+  $B1: {
+    %sum:i32 = add %param, %param
+    ret %sum
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, Branch) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+    %ep_type = OpTypeFunction %void
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpBranch %next
+       %next = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%main = @compute @workgroup_size(1, 1, 1) func():void {
+  $B1: {
+    ret
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, If_NoElse) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+      %i32_1 = OpConstant %i32 1
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %i32 %bool %i32
+
+        %foo = OpFunction %i32 None %fn_type
+       %cond = OpFunctionParameter %bool
+          %a = OpFunctionParameter %i32
+  %foo_start = OpLabel
+               OpSelectionMerge %merge None
+               OpBranchConditional %cond %then %merge
+       %then = OpLabel
+               OpBranch %merge
+      %merge = OpLabel
+        %sum = OpIAdd %i32 %a %i32_1
+               OpReturnValue %sum
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%1 = func(%2:bool, %3:i32):i32 {
+  $B1: {
+    if %2 [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        exit_if  # if_1
+      }
+      $B3: {  # false
+        exit_if  # if_1
+      }
+    }
+    %4:i32 = add %3, 1i
+    ret %4
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, IfElse_Phi) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %cond "cond"
+               OpName %a "a"
+               OpName %b "b"
+               OpName %then_value "then_value"
+               OpName %phi "phi"
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+      %i32_1 = OpConstant %i32 1
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %i32 %bool %i32 %i32
+
+        %foo = OpFunction %i32 None %fn_type
+       %cond = OpFunctionParameter %bool
+          %a = OpFunctionParameter %i32
+          %b = OpFunctionParameter %i32
+  %foo_start = OpLabel
+               OpSelectionMerge %merge None
+               OpBranchConditional %cond %then %else
+       %then = OpLabel
+ %then_value = OpIAdd %i32 %a %i32_1
+               OpBranch %merge
+       %else = OpLabel
+               OpBranch %merge
+      %merge = OpLabel
+        %phi = OpPhi %i32 %then_value %then %b %else
+               OpReturnValue %phi
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%cond:bool, %a:i32, %b:i32):i32 {
+  $B1: {
+    %phi:i32 = if %cond [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        %then_value:i32 = add %a, 1i
+        exit_if %then_value  # if_1
+      }
+      $B3: {  # false
+        exit_if %b  # if_1
+      }
+    }
+    ret %phi
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, If_Nested) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %c1 "c1"
+               OpName %c2 "c2"
+               OpName %phi "phi"
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+      %i32_1 = OpConstant %i32 1
+      %i32_2 = OpConstant %i32 2
+      %i32_3 = OpConstant %i32 3
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %i32 %bool %bool
+
+        %foo = OpFunction %i32 None %fn_type
+         %c1 = OpFunctionParameter %bool
+         %c2 = OpFunctionParameter %bool
+  %foo_start = OpLabel
+               OpSelectionMerge %outer_merge None
+               OpBranchConditional %c1 %outer_then %outer_merge
+ %outer_then = OpLabel
+               OpSelectionMerge %inner_merge None
+               OpBranchConditional %c2 %inner_then %inner_else
+ %inner_then = OpLabel
+               OpReturnValue %i32_1
+ %inner_else = OpLabel
+               OpBranch %inner_merge
+%inner_merge = OpLabel
+               OpBranch %outer_merge
+%outer_merge = OpLabel
+        %phi = OpPhi %i32 %i32_2 %inner_merge %i32_3 %foo_start
+               OpReturnValue %phi
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%c1:bool, %c2:bool):i32 {
+  $B1: {
+    %phi:i32 = if %c1 [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        if %c2 [t: $B4, f: $B5] {  # if_2
+          $B4: {  # true
+            ret 1i
+          }
+          $B5: {  # false
+            exit_if  # if_2
+          }
+        }
+        exit_if 2i  # if_1
+      }
+      $B3: {  # false
+        exit_if 3i  # if_1
+      }
+    }
+    ret %phi
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, IfElse_BothReturn) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %cond "cond"
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+      %i32_1 = OpConstant %i32 1
+      %i32_2 = OpConstant %i32 2
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %i32 %bool
+
+        %foo = OpFunction %i32 None %fn_type
+       %cond = OpFunctionParameter %bool
+  %foo_start = OpLabel
+               OpSelectionMerge %merge None
+               OpBranchConditional %cond %then %else
+       %then = OpLabel
+               OpReturnValue %i32_1
+       %else = OpLabel
+               OpReturnValue %i32_2
+      %merge = OpLabel
+               OpUnreachable
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%cond:bool):i32 {
+  $B1: {
+    if %cond [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        ret 1i
+      }
+      $B3: {  # false
+        ret 2i
+      }
+    }
+    unreachable
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, Loop_BreakIf) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+       %true = OpConstantTrue %bool
+    %ep_type = OpTypeFunction %void
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpBranch %header
+     %header = OpLabel
+               OpLoopMerge %merge %continue None
+               OpBranch %continue
+   %continue = OpLabel
+               OpBranchConditional %true %merge %header
+      %merge = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%main = @compute @workgroup_size(1, 1, 1) func():void {
+  $B1: {
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        break_if true  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    ret
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, Loop_BreakIf_ExitOnFalse) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %cond "cond"
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %void %bool
+
+        %foo = OpFunction %void None %fn_type
+       %cond = OpFunctionParameter %bool
+  %foo_start = OpLabel
+               OpBranch %header
+     %header = OpLabel
+               OpLoopMerge %merge %continue None
+               OpBranch %continue
+   %continue = OpLabel
+               OpBranchConditional %cond %header %merge
+      %merge = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%cond:bool):void {
+  $B1: {
+    loop [b: $B2, c: $B3] {  # loop_1
+      $B2: {  # body
+        continue  # -> $B3
+      }
+      $B3: {  # continuing
+        %3:bool = not %cond
+        break_if %3  # -> [t: exit_loop loop_1, f: $B2]
+      }
+    }
+    ret
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, Loop_Phi_ConditionalBreak) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %n "n"
+               OpName %i "i"
+               OpName %cond "cond"
+               OpName %next "next"
+               OpName %result "result"
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+      %i32_0 = OpConstant %i32 0
+      %i32_1 = OpConstant %i32 1
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %i32 %i32
+
+        %foo = OpFunction %i32 None %fn_type
+          %n = OpFunctionParameter %i32
+  %foo_start = OpLabel
+               OpBranch %header
+     %header = OpLabel
+          %i = OpPhi %i32 %i32_0 %foo_start %next %continue
+               OpLoopMerge %merge %continue None
+               OpBranch %body
+       %body = OpLabel
+       %cond = OpSLessThan %bool %i %n
+               OpBranchConditional %cond %continue %merge
+   %continue = OpLabel
+       %next = OpIAdd %i32 %i %i32_1
+               OpBranch %header
+      %merge = OpLabel
+     %result = OpPhi %i32 %i %body
+               OpReturnValue %result
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%n:i32):i32 {
+  $B1: {
+    %result:i32 = loop [i: $B2, b: $B3, c: $B4] {  # loop_1
+      $B2: {  # initializer
+        next_iteration 0i  # -> $B3
+      }
+      $B3 (%i:i32): {  # body
+        %cond:bool = lt %i, %n
+        if %cond [t: $B5, f: $B6] {  # if_1
+          $B5: {  # true
+            continue  # -> $B4
+          }
+          $B6: {  # false
+            exit_loop %i  # loop_1
+          }
+        }
+        unreachable
+      }
+      $B4: {  # continuing
+        %next:i32 = add %i, 1i
+        next_iteration %next  # -> $B3
+      }
+    }
+    ret %result
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, Loop_ContinueTargetIsHeader) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %i "i"
+               OpName %next "next"
+               OpName %cond "cond"
+               OpName %result "result"
+       %void = OpTypeVoid
+       %bool = OpTypeBool
+        %i32 = OpTypeInt 32 1
+      %i32_0 = OpConstant %i32 0
+      %i32_1 = OpConstant %i32 1
+     %i32_10 = OpConstant %i32 10
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %i32
+
+        %foo = OpFunction %i32 None %fn_type
+  %foo_start = OpLabel
+               OpBranch %header
+     %header = OpLabel
+          %i = OpPhi %i32 %i32_0 %foo_start %next %header
+       %next = OpIAdd %i32 %i %i32_1
+       %cond = OpSLessThan %bool %next %i32_10
+               OpLoopMerge %merge %header None
+               OpBranchConditional %cond %header %merge
+      %merge = OpLabel
+     %result = OpPhi %i32 %next %header
+               OpReturnValue %result
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func():i32 {
+  $B1: {
+    %result:i32 = loop [i: $B2, b: $B3, c: $B4] {  # loop_1
+      $B2: {  # initializer
+        next_iteration 0i  # -> $B3
+      }
+      $B3 (%i:i32): {  # body
+        %next:i32 = add %i, 1i
+        %cond:bool = lt %next, 10i
+        continue  # -> $B4
+      }
+      $B4: {  # continuing
+        %6:bool = not %cond
+        break_if %6 next_iteration: [ %next ] exit_loop: [ %next ]  # -> [t: exit_loop loop_1, f: $B3]
+      }
+    }
+    ret %result
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, Switch_Phi) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %sel "sel"
+               OpName %phi "phi"
+       %void = OpTypeVoid
+        %i32 = OpTypeInt 32 1
+     %i32_10 = OpConstant %i32 10
+     %i32_20 = OpConstant %i32 20
+     %i32_30 = OpConstant %i32 30
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %i32 %i32
+
+        %foo = OpFunction %i32 None %fn_type
+        %sel = OpFunctionParameter %i32
+  %foo_start = OpLabel
+               OpSelectionMerge %merge None
+               OpSwitch %sel %default 1 %case_a 2 %case_a 3 %case_b
+     %case_a = OpLabel
+               OpBranch %merge
+     %case_b = OpLabel
+               OpBranch %merge
+    %default = OpLabel
+               OpBranch %merge
+      %merge = OpLabel
+        %phi = OpPhi %i32 %i32_10 %case_a %i32_20 %case_b %i32_30 %default
+               OpReturnValue %phi
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%sel:i32):i32 {
+  $B1: {
+    %phi:i32 = switch %sel [c: (1i 2i, $B2), c: (3i, $B3), c: (default, $B4)] {  # switch_1
+      $B2: {  # case
+        exit_switch 10i  # switch_1
+      }
+      $B3: {  # case
+        exit_switch 20i  # switch_1
+      }
+      $B4: {  # case
+        exit_switch 30i  # switch_1
+      }
+    }
+    ret %phi
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, Switch_DefaultSharesCase) {
+    EXPECT_IR(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpName %foo "foo"
+               OpName %sel "sel"
+       %void = OpTypeVoid
+        %u32 = OpTypeInt 32 0
+    %ep_type = OpTypeFunction %void
+    %fn_type = OpTypeFunction %void %u32
+
+        %foo = OpFunction %void None %fn_type
+        %sel = OpFunctionParameter %u32
+  %foo_start = OpLabel
+               OpSelectionMerge %merge None
+               OpSwitch %sel %case_a 1 %case_a 2 %case_b
+     %case_a = OpLabel
+               OpBranch %merge
+     %case_b = OpLabel
+               OpReturn
+      %merge = OpLabel
+               OpReturn
+               OpFunctionEnd
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpReturn
+               OpFunctionEnd
+)",
+              R"(
+%foo = func(%sel:u32):void {
+  $B1: {
+    switch %sel [c: (1u default, $B2), c: (2u, $B3)] {  # switch_1
+      $B2: {  # case
+        exit_switch  # switch_1
+      }
+      $B3: {  # case
+        ret
+      }
+    }
+    ret
+  }
+}
+)");
+}
+
+TEST_F(SpirvParserTest, Switch_Fallthrough_Unsupported) {
+    auto assembly = Assemble(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+        %i32 = OpTypeInt 32 1
+      %i32_0 = OpConstant %i32 0
+    %ep_type = OpTypeFunction %void
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpSelectionMerge %merge None
+               OpSwitch %i32_0 %default 1 %case_a
+     %case_a = OpLabel
+               OpBranch %default
+    %default = OpLabel
+               OpBranch %merge
+      %merge = OpLabel
+               OpReturn
+               OpFunctionEnd
+)");
+    ASSERT_EQ(assembly, Success);
+    auto parsed = Parse(Slice(assembly.Get().data(), assembly.Get().size()));
+    ASSERT_NE(parsed, Success);
+    EXPECT_THAT(parsed.Failure().reason.Str(),
+                testing::HasSubstr("switch case fallthrough is not supported"));
+}
+
+TEST_F(SpirvParserTest, Phi_Unhandled) {
+    auto assembly = Assemble(R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+        %i32 = OpTypeInt 32 1
+      %i32_1 = OpConstant %i32 1
+    %ep_type = OpTypeFunction %void
+
+       %main = OpFunction %void None %ep_type
+ %main_start = OpLabel
+               OpBranch %next
+       %next = OpLabel
+        %phi = OpPhi %i32 %i32_1 %main_start
+               OpReturn
+               OpFunctionEnd
+)");
+    ASSERT_EQ(assembly, Success);
+    auto parsed = Parse(Slice(assembly.Get().data(), assembly.Get().size()));
+    ASSERT_NE(parsed, Success);
+    EXPECT_THAT(parsed.Failure().reason.Str(), testing::HasSubstr("unhandled OpPhi"));
+}
+
 }  // namespace
+
 }  // namespace tint::spirv::reader
@@ -29,6 +29,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -42,9 +44,13 @@ TINT_END_DISABLE_WARNING(SIGN_CONVERSION);
 TINT_END_DISABLE_WARNING(OLD_STYLE_CAST);
 TINT_END_DISABLE_WARNING(NEWLINE_EOF);
 
+#include "spirv/unified1/GLSL.std.450.h"
+
 #include "src/tint/lang/core/ir/builder.h"
 #include "src/tint/lang/core/ir/module.h"
 #include "src/tint/lang/spirv/validate/validate.h"
+#include "src/tint/utils/containers/reverse.h"
+#include "src/tint/utils/macros/defer.h"
 
 using namespace tint::core::fluent_types;  // NOLINT
 
@@ -84,17 +90,28 @@ class Parser {
             }
         }
 
+        // Check for unsupported extended instruction sets.
+        for (const auto& import : spirv_context_->module()->ext_inst_imports()) {
+            auto name = import.GetInOperand(0).AsString();
+            if (name != "GLSL.std.450") {
+                return Failure("SPIR-V extended instruction set '" + name + "' is not supported");
+            }
+        }
+
+        RegisterNames();
+
         {
             TINT_SCOPED_ASSIGNMENT(current_block_, ir_.root_block);
             EmitModuleScopeVariables();
         }
 
-        EmitFunctions();
+        if (auto res = EmitFunctions(); res != Success) {
+            return res.Failure();
+        }
 
         EmitEntryPoints();
 
         // TODO(crbug.com/tint/1907): Handle annotation instructions.
-        // TODO(crbug.com/tint/1907): Handle names.
 
         return std::move(ir_);
     }
@@ -252,6 +269,8 @@ class Parser {
             TINT_ICE() << "empty structures are not supported";
         }
 
+        const uint32_t struct_id = spirv_context_->get_type_mgr()->GetId(struct_ty);
+
         // Build a list of struct members.
         uint32_t current_size = 0u;
         Vector<core::type::StructMember*, 4> members;
@@ -305,23 +324,27 @@ class Parser {
                 }
             }
 
-            // TODO(crbug.com/tint/1907): Use OpMemberName to name it.
-            members.Push(ty_.Get<core::type::StructMember>(ir_.symbols.New(), member_ty, i, offset,
-                                                           align, member_ty->Size(),
-                                                           std::move(attributes)));
+            auto member_name = member_names_.Get(MemberKey{struct_id, i});
+            members.Push(ty_.Get<core::type::StructMember>(
+                member_name ? ir_.symbols.Register(*member_name) : ir_.symbols.New(), member_ty, i,
+                offset, align, member_ty->Size(), std::move(attributes)));
 
             current_size = offset + member_ty->Size();
         }
-        // TODO(crbug.com/tint/1907): Use OpName to name it.
-        return ty_.Struct(ir_.symbols.New(), std::move(members));
+        auto name = names_.Get(struct_id);
+        return ty_.Struct(name ? ir_.symbols.New(*name) : ir_.symbols.New(), std::move(members));
     }
 
     /// @param id a SPIR-V result ID for a function declaration instruction
     /// @returns a Tint function object
     core::ir::Function* Function(uint32_t id) {
         return functions_.GetOrAdd(id, [&] {
-            return b_.Function(ty_.void_(), core::ir::Function::PipelineStage::kUndefined,
-                               std::nullopt);
+            auto* func = b_.Function(ty_.void_(), core::ir::Function::PipelineStage::kUndefined,
+                                     std::nullopt);
+            if (auto name = names_.Get(id)) {
+                ir_.SetName(func, *name);
+            }
+            return func;
         });
     }
 
@@ -410,6 +433,35 @@ class Parser {
         if (result_id != 0) {
             TINT_ASSERT(inst->Results().Length() == 1u);
             AddValue(result_id, inst->Result(0));
+            if (auto name = names_.Get(result_id)) {
+                ir_.SetName(inst->Result(0), *name);
+            }
+        }
+    }
+
+    /// Record the names declared with OpName and OpMemberName.
+    void RegisterNames() {
+        for (auto& inst : spirv_context_->module()->debugs2()) {
+            switch (inst.opcode()) {
+                case spv::Op::OpName: {
+                    auto name = inst.GetInOperand(1).AsString();
+                    if (!name.empty()) {
+                        names_.Add(inst.GetSingleWordInOperand(0), name);
+                    }
+                    break;
+                }
+                case spv::Op::OpMemberName: {
+                    auto name = inst.GetInOperand(2).AsString();
+                    if (!name.empty()) {
+                        member_names_.Add(MemberKey{inst.GetSingleWordInOperand(0),
+                                                    inst.GetSingleWordInOperand(1)},
+                                          name);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
         }
     }
 
@@ -423,12 +475,21 @@ class Parser {
     }
 
     /// Emit the functions.
-    void EmitFunctions() {
+    /// @returns success, or a failure if a function uses SPIR-V that is not supported yet
+    Result<SuccessType> EmitFunctions() {
         for (auto& func : *spirv_context_->module()) {
+            blocks_.Clear();
+            for (auto& block : func) {
+                blocks_.Add(block.id(), &block);
+            }
+
             Vector<core::ir::FunctionParam*, 4> params;
             func.ForEachParam([&](spvtools::opt::Instruction* spirv_param) {
                 auto* param = b_.FunctionParam(Type(spirv_param->type_id()));
                 values_.Add(spirv_param->result_id(), param);
+                if (auto name = names_.Get(spirv_param->result_id())) {
+                    ir_.SetName(param, *name);
+                }
                 params.Push(param);
             });
 
@@ -437,8 +498,12 @@ class Parser {
             current_function_->SetReturnType(Type(func.type_id()));
 
             functions_.Add(func.result_id(), current_function_);
-            EmitBlock(current_function_->Block(), *func.entry());
+            if (auto res = EmitBlocks(current_function_->Block(), func.entry()->id());
+                res != Success) {
+                return res.Failure();
+            }
         }
+        return Success;
     }
 
     /// Emit entry point attributes.
@@ -489,10 +554,505 @@ class Parser {
         }
     }
 
+    /// The kind of a structured control flow construct.
+    enum class ConstructKind : uint8_t {
+        kIf,
+        kSwitch,
+        kLoop,
+    };
+
+    /// A structured control flow construct that encloses the SPIR-V blocks being emitted.
+    struct Construct {
+        /// Constructor
+        /// @param k the kind of the construct
+        /// @param i the Tint IR control instruction emitted for the construct
+        /// @param merge the result ID of the merge block, or 0 if the construct has no merge block
+        Construct(ConstructKind k, core::ir::ControlInstruction* i, uint32_t merge = 0)
+            : kind(k), inst(i), merge_id(merge) {}
+
+        /// The kind of the construct.
+        ConstructKind kind;
+        /// The Tint IR control instruction emitted for the construct.
+        core::ir::ControlInstruction* inst = nullptr;
+        /// The result ID of the merge block, or 0 if the construct has no merge block.
+        uint32_t merge_id = 0;
+        /// The result ID of the loop header block.
+        uint32_t header_id = 0;
+        /// The result ID of the loop continue target.
+        uint32_t continue_id = 0;
+        /// True while the continue construct of the loop is being emitted.
+        bool in_continuing = false;
+        /// True if the loop body branches to the continue target.
+        bool has_continue = false;
+        /// The result IDs of the blocks that the switch cases start at.
+        Vector<uint32_t, 8> case_ids;
+        /// The result ID of the block that the switch case being emitted starts at.
+        uint32_t current_case_id = 0;
+    };
+
+    /// Emit the SPIR-V blocks of a structured construct into Tint IR block @p dst, starting at the
+    /// SPIR-V block @p id and following its branches until the construct is left.
+    /// @param dst the Tint IR block to append to
+    /// @param id the result ID of the first SPIR-V block to emit
+    /// @param pred_id the result ID of the SPIR-V block that branches to @p id, or 0
+    /// @param loop_header true if @p id is the header of the loop whose body is being emitted
+    /// @returns success, or a failure if a block uses SPIR-V that is not supported yet
+    Result<SuccessType> EmitBlocks(core::ir::Block* dst,
+                                   uint32_t id,
+                                   uint32_t pred_id = 0,
+                                   bool loop_header = false) {
+        while (id != 0) {
+            auto* src = *blocks_.Get(id);
+            Result<uint32_t> next = 0u;
+            if (src->GetLoopMergeInst() != nullptr && !loop_header) {
+                next = EmitLoop(dst, *src, pred_id);
+            } else if (auto res = EmitBlock(dst, *src); res != Success) {
+                return res.Failure();
+            } else {
+                next = EmitTerminator(dst, *src);
+            }
+            if (next != Success) {
+                return next.Failure();
+            }
+            loop_header = false;
+            pred_id = id;
+            id = next.Get();
+        }
+        return Success;
+    }
+
+    /// Emit the terminator of SPIR-V block @p src.
+    /// @param dst the Tint IR block to append to
+    /// @param src the SPIR-V block
+    /// @returns the result ID of the SPIR-V block to continue emitting into @p dst, 0 if @p dst has
+    /// been terminated, or a failure
+    Result<uint32_t> EmitTerminator(core::ir::Block* dst, const spvtools::opt::BasicBlock& src) {
+        auto* terminator = src.terminator();
+        switch (terminator->opcode()) {
+            case spv::Op::OpBranch:
+                return FollowBranch(dst, src.id(), terminator->GetSingleWordInOperand(0));
+            case spv::Op::OpBranchConditional: {
+                auto* condition = Value(terminator->GetSingleWordInOperand(0));
+                uint32_t true_id = terminator->GetSingleWordInOperand(1);
+                uint32_t false_id = terminator->GetSingleWordInOperand(2);
+                if (!constructs_.IsEmpty()) {
+                    auto& construct = *constructs_.Back();
+                    if (construct.in_continuing &&
+                        (true_id == construct.header_id || false_id == construct.header_id)) {
+                        return EmitBreakIf(dst, construct, src.id(), condition, true_id, false_id);
+                    }
+                }
+                auto* merge = src.GetMergeInst();
+                if (merge != nullptr && merge->opcode() == spv::Op::OpSelectionMerge) {
+                    return EmitIf(dst, src.id(), condition, true_id, false_id,
+                                  merge->GetSingleWordInOperand(0));
+                }
+                return EmitConditionalExit(dst, src.id(), condition, true_id, false_id);
+            }
+            case spv::Op::OpSwitch: {
+                auto* merge = src.GetMergeInst();
+                if (merge == nullptr || merge->opcode() != spv::Op::OpSelectionMerge) {
+                    return Failure("unstructured switch in SPIR-V block " +
+                                   std::to_string(src.id()));
+                }
+                return EmitSwitch(dst, src, merge->GetSingleWordInOperand(0));
+            }
+            default:
+                // The block ended with a return or another terminator emitted by EmitBlock().
+                return 0u;
+        }
+    }
+
+    /// Emit the branch from SPIR-V block @p pred_id to @p target_id, if it leaves one of the
+    /// enclosing constructs.
+    /// @param dst the Tint IR block to append to
+    /// @param pred_id the result ID of the SPIR-V block that branches
+    /// @param target_id the result ID of the SPIR-V block that is branched to
+    /// @returns @p target_id if the branch stays inside the innermost construct, 0 if an exit was
+    /// emitted, or a failure
+    Result<uint32_t> FollowBranch(core::ir::Block* dst, uint32_t pred_id, uint32_t target_id) {
+        for (auto* construct : tint::Reverse(constructs_)) {
+            switch (construct->kind) {
+                case ConstructKind::kIf:
+                    if (target_id == construct->merge_id) {
+                        auto args = PhiArgs(target_id, pred_id);
+                        if (args != Success) {
+                            return args.Failure();
+                        }
+                        dst->Append(b_.ExitIf(construct->inst->As<core::ir::If>(),
+                                              std::move(args.Get())));
+                        return 0u;
+                    }
+                    break;
+                case ConstructKind::kSwitch: {
+                    if (target_id == construct->merge_id) {
+                        auto args = PhiArgs(target_id, pred_id);
+                        if (args != Success) {
+                            return args.Failure();
+                        }
+                        dst->Append(b_.ExitSwitch(construct->inst->As<core::ir::Switch>(),
+                                                  std::move(args.Get())));
+                        return 0u;
+                    }
+                    auto& ids = construct->case_ids;
+                    if (target_id != construct->current_case_id &&
+                        std::find(ids.begin(), ids.end(), target_id) != ids.end()) {
+                        return Failure("switch case fallthrough is not supported by the SPIR-V IR "
+                                       "parser");
+                    }
+                    break;
+                }
+                case ConstructKind::kLoop: {
+                    auto* loop = construct->inst->As<core::ir::Loop>();
+                    if (construct->in_continuing) {
+                        if (target_id == construct->header_id) {
+                            auto args = PhiArgs(target_id, pred_id);
+                            if (args != Success) {
+                                return args.Failure();
+                            }
+                            dst->Append(b_.NextIteration(loop, std::move(args.Get())));
+                            return 0u;
+                        }
+                        if (target_id == construct->merge_id) {
+                            return Failure("loop exit from a continue construct that is not the "
+                                           "back-edge in SPIR-V block " +
+                                           std::to_string(pred_id));
+                        }
+                    } else if (target_id == construct->merge_id) {
+                        auto args = PhiArgs(target_id, pred_id);
+                        if (args != Success) {
+                            return args.Failure();
+                        }
+                        dst->Append(b_.ExitLoop(loop, std::move(args.Get())));
+                        return 0u;
+                    } else if (target_id == construct->continue_id) {
+                        auto args = PhiArgs(target_id, pred_id);
+                        if (args != Success) {
+                            return args.Failure();
+                        }
+                        dst->Append(b_.Continue(loop, std::move(args.Get())));
+                        construct->has_continue = true;
+                        return 0u;
+                    }
+                    break;
+                }
+            }
+        }
+        return target_id;
+    }
+
+    /// Emit the arm of an if or the block of a switch case, starting with the branch from SPIR-V
+    /// block @p pred_id to @p target_id.
+    /// @param dst the Tint IR block of the arm or case
+    /// @param pred_id the result ID of the SPIR-V selection header block
+    /// @param target_id the result ID of the SPIR-V block that the arm or case starts at
+    /// @returns success, or a failure if a block uses SPIR-V that is not supported yet
+    Result<SuccessType> EmitArm(core::ir::Block* dst, uint32_t pred_id, uint32_t target_id) {
+        auto next = FollowBranch(dst, pred_id, target_id);
+        if (next != Success) {
+            return next.Failure();
+        }
+        return EmitBlocks(dst, next.Get(), pred_id);
+    }
+
+    /// Emit an if instruction for a selection construct, with a result for each OpPhi in the
+    /// merge block.
+    /// @param dst the Tint IR block to append to
+    /// @param header_id the result ID of the SPIR-V selection header block
+    /// @param condition the condition of the selection
+    /// @param true_id the result ID of the SPIR-V block branched to when @p condition is true
+    /// @param false_id the result ID of the SPIR-V block branched to when @p condition is false
+    /// @param merge_id the result ID of the merge block of the selection construct
+    /// @returns the result ID of the SPIR-V block to continue emitting into @p dst, 0 if @p dst has
+    /// been terminated, or a failure
+    Result<uint32_t> EmitIf(core::ir::Block* dst,
+                            uint32_t header_id,
+                            core::ir::Value* condition,
+                            uint32_t true_id,
+                            uint32_t false_id,
+                            uint32_t merge_id) {
+        auto* if_ = b_.If(condition);
+        if_->SetResults(PhiResults(merge_id));
+        dst->Append(if_);
+
+        Construct construct{ConstructKind::kIf, if_, merge_id};
+        {
+            constructs_.Push(&construct);
+            TINT_DEFER(constructs_.Pop());
+            for (auto [arm, arm_id] :
+                 {std::make_pair(if_->True(), true_id), std::make_pair(if_->False(), false_id)}) {
+                if (auto res = EmitArm(arm, header_id, arm_id); res != Success) {
+                    return res.Failure();
+                }
+            }
+        }
+        return FollowBranch(dst, header_id, merge_id);
+    }
+
+    /// Emit a conditional branch that has no merge instruction. At least one of its targets must
+    /// leave an enclosing construct, like a conditional break or continue. This is emitted as an if
+    /// whose arms exit to those targets, after which emission continues at the other target.
+    /// @param dst the Tint IR block to append to
+    /// @param id the result ID of the SPIR-V block that branches
+    /// @param condition the condition of the branch
+    /// @param true_id the result ID of the SPIR-V block branched to when @p condition is true
+    /// @param false_id the result ID of the SPIR-V block branched to when @p condition is false
+    /// @returns the result ID of the SPIR-V block to continue emitting into @p dst, 0 if @p dst has
+    /// been terminated, or a failure
+    Result<uint32_t> EmitConditionalExit(core::ir::Block* dst,
+                                         uint32_t id,
+                                         core::ir::Value* condition,
+                                         uint32_t true_id,
+                                         uint32_t false_id) {
+        auto* if_ = b_.If(condition);
+        dst->Append(if_);
+
+        Construct construct{ConstructKind::kIf, if_};
+        constructs_.Push(&construct);
+        TINT_DEFER(constructs_.Pop());
+
+        uint32_t next_id = 0;
+        for (auto [arm, arm_id] :
+             {std::make_pair(if_->True(), true_id), std::make_pair(if_->False(), false_id)}) {
+            auto next = FollowBranch(arm, id, arm_id);
+            if (next != Success) {
+                return next.Failure();
+            }
+            if (next.Get() != 0) {
+                if (next_id != 0 && next_id != next.Get()) {
+                    return Failure("unstructured conditional branch in SPIR-V block " +
+                                   std::to_string(id));
+                }
+                next_id = next.Get();
+                arm->Append(b_.ExitIf(if_));
+            }
+        }
+        if (next_id == 0) {
+            // Both targets left an enclosing construct, so control never reaches past the if.
+            dst->Append(b_.Unreachable());
+        }
+        return next_id;
+    }
+
+    /// Emit a switch instruction for a selection construct that ends with OpSwitch, with a result
+    /// for each OpPhi in the merge block. Literals that branch to the same block share a case.
+    /// @param dst the Tint IR block to append to
+    /// @param src the SPIR-V selection header block
+    /// @param merge_id the result ID of the merge block of the selection construct
+    /// @returns the result ID of the SPIR-V block to continue emitting into @p dst, 0 if @p dst has
+    /// been terminated, or a failure
+    Result<uint32_t> EmitSwitch(core::ir::Block* dst,
+                                const spvtools::opt::BasicBlock& src,
+                                uint32_t merge_id) {
+        auto* terminator = src.terminator();
+        auto* selector = Value(terminator->GetSingleWordInOperand(0));
+        auto* switch_ = b_.Switch(selector);
+        switch_->SetResults(PhiResults(merge_id));
+        dst->Append(switch_);
+
+        Construct construct{ConstructKind::kSwitch, switch_, merge_id};
+        Vector<Vector<core::ir::Constant*, 4>, 8> case_selectors;
+        auto add_selector = [&](uint32_t target_id, core::ir::Constant* value) {
+            for (size_t i = 0; i < construct.case_ids.Length(); i++) {
+                if (construct.case_ids[i] == target_id) {
+                    case_selectors[i].Push(value);
+                    return;
+                }
+            }
+            construct.case_ids.Push(target_id);
+            case_selectors.Push(Vector<core::ir::Constant*, 4>{value});
+        };
+        const bool is_signed = selector->Type()->IsSignedIntegerScalar();
+        for (uint32_t i = 2; i + 1 < terminator->NumInOperands(); i += 2) {
+            uint32_t literal = terminator->GetSingleWordInOperand(i);
+            add_selector(terminator->GetSingleWordInOperand(i + 1),
+                         is_signed ? b_.Constant(i32(static_cast<int32_t>(literal)))
+                                   : b_.Constant(u32(literal)));
+        }
+        add_selector(terminator->GetSingleWordInOperand(1), nullptr);
+
+        {
+            constructs_.Push(&construct);
+            TINT_DEFER(constructs_.Pop());
+            for (size_t i = 0; i < construct.case_ids.Length(); i++) {
+                construct.current_case_id = construct.case_ids[i];
+                auto* block = b_.Case(switch_, std::move(case_selectors[i]));
+                if (auto res = EmitArm(block, src.id(), construct.case_ids[i]); res != Success) {
+                    return res.Failure();
+                }
+            }
+        }
+        return FollowBranch(dst, src.id(), merge_id);
+    }
+
+    /// Emit a loop instruction for the loop construct with header block @p header. The OpPhis of
+    /// the header become the parameters of the loop body, the OpPhis of the continue target the
+    /// parameters of the continuing block, and the OpPhis of the merge block the loop results.
+    /// @param dst the Tint IR block to append to
+    /// @param header the SPIR-V loop header block
+    /// @param pred_id the result ID of the SPIR-V block that enters the loop
+    /// @returns the result ID of the SPIR-V block to continue emitting into @p dst, 0 if @p dst has
+    /// been terminated, or a failure
+    Result<uint32_t> EmitLoop(core::ir::Block* dst,
+                              const spvtools::opt::BasicBlock& header,
+                              uint32_t pred_id) {
+        auto* merge = header.GetLoopMergeInst();
+        uint32_t merge_id = merge->GetSingleWordInOperand(0);
+        uint32_t continue_id = merge->GetSingleWordInOperand(1);
+
+        auto* loop = b_.Loop();
+        loop->Body()->SetParams(PhiParams(header.id()));
+        loop->SetResults(PhiResults(merge_id));
+        dst->Append(loop);
+
+        // The initializer passes the values that the header OpPhis take on entry to the loop.
+        if (!loop->Body()->Params().IsEmpty()) {
+            auto args = PhiArgs(header.id(), pred_id);
+            if (args != Success) {
+                return args.Failure();
+            }
+            loop->Initializer()->Append(b_.NextIteration(loop, std::move(args.Get())));
+        }
+
+        Construct construct{ConstructKind::kLoop, loop, merge_id};
+        construct.header_id = header.id();
+        construct.continue_id = continue_id;
+        {
+            constructs_.Push(&construct);
+            TINT_DEFER(constructs_.Pop());
+            if (continue_id == header.id()) {
+                // The header is its own continue target, so its terminator is the back-edge.
+                if (auto res = EmitBlock(loop->Body(), header); res != Success) {
+                    return res.Failure();
+                }
+                loop->Body()->Append(b_.Continue(loop));
+                construct.in_continuing = true;
+                if (auto res = EmitTerminator(loop->Continuing(), header); res != Success) {
+                    return res.Failure();
+                }
+            } else {
+                if (auto res = EmitBlocks(loop->Body(), header.id(), pred_id, true);
+                    res != Success) {
+                    return res.Failure();
+                }
+                // Only emit the continue construct if the body branches to it.
+                if (construct.has_continue) {
+                    loop->Continuing()->SetParams(PhiParams(continue_id));
+                    construct.in_continuing = true;
+                    if (auto res = EmitBlocks(loop->Continuing(), continue_id); res != Success) {
+                        return res.Failure();
+                    }
+                }
+            }
+        }
+        return FollowBranch(dst, header.id(), merge_id);
+    }
+
+    /// Emit the break_if for the conditional back-edge of a loop, which branches either to the loop
+    /// header or to the loop merge block.
+    /// @param dst the Tint IR continuing block to append to
+    /// @param construct the loop construct
+    /// @param id the result ID of the SPIR-V back-edge block
+    /// @param condition the condition of the branch
+    /// @param true_id the result ID of the SPIR-V block branched to when @p condition is true
+    /// @param false_id the result ID of the SPIR-V block branched to when @p condition is false
+    /// @returns 0, as the continuing block has been terminated, or a failure
+    Result<uint32_t> EmitBreakIf(core::ir::Block* dst,
+                                 const Construct& construct,
+                                 uint32_t id,
+                                 core::ir::Value* condition,
+                                 uint32_t true_id,
+                                 uint32_t false_id) {
+        uint32_t exit_id = true_id == construct.header_id ? false_id : true_id;
+        if (exit_id != construct.merge_id) {
+            return Failure("unstructured loop back-edge in SPIR-V block " + std::to_string(id));
+        }
+        if (true_id == construct.header_id) {
+            // The loop exits when the condition is false.
+            auto* not_ = b_.Not(ty_.bool_(), condition);
+            dst->Append(not_);
+            condition = not_->Result(0);
+        }
+        auto next_iter_args = PhiArgs(construct.header_id, id);
+        if (next_iter_args != Success) {
+            return next_iter_args.Failure();
+        }
+        auto exit_args = PhiArgs(construct.merge_id, id);
+        if (exit_args != Success) {
+            return exit_args.Failure();
+        }
+        dst->Append(b_.BreakIf(construct.inst->As<core::ir::Loop>(), condition,
+                               std::move(next_iter_args.Get()), std::move(exit_args.Get())));
+        return 0u;
+    }
+
+    /// @param block_id the result ID of a SPIR-V block
+    /// @returns an instruction result for each OpPhi in the block
+    Vector<core::ir::InstructionResult*, 4> PhiResults(uint32_t block_id) {
+        Vector<core::ir::InstructionResult*, 4> results;
+        for (auto& inst : **blocks_.Get(block_id)) {
+            if (inst.opcode() != spv::Op::OpPhi) {
+                break;
+            }
+            auto* result = b_.InstructionResult(Type(inst.type_id()));
+            AddValue(inst.result_id(), result);
+            if (auto name = names_.Get(inst.result_id())) {
+                ir_.SetName(result, *name);
+            }
+            results.Push(result);
+        }
+        return results;
+    }
+
+    /// @param block_id the result ID of a SPIR-V block
+    /// @returns a block parameter for each OpPhi in the block
+    Vector<core::ir::BlockParam*, 4> PhiParams(uint32_t block_id) {
+        Vector<core::ir::BlockParam*, 4> params;
+        for (auto& inst : **blocks_.Get(block_id)) {
+            if (inst.opcode() != spv::Op::OpPhi) {
+                break;
+            }
+            auto* param = b_.BlockParam(Type(inst.type_id()));
+            AddValue(inst.result_id(), param);
+            if (auto name = names_.Get(inst.result_id())) {
+                ir_.SetName(param, *name);
+            }
+            params.Push(param);
+        }
+        return params;
+    }
+
+    /// @param target_id the result ID of a SPIR-V block
+    /// @param pred_id the result ID of a SPIR-V block that branches to @p target_id
+    /// @returns the values that the OpPhis of the block take when it is entered from @p pred_id, or
+    /// a failure if an OpPhi has no value for that block
+    Result<Vector<core::ir::Value*, 4>> PhiArgs(uint32_t target_id, uint32_t pred_id) {
+        Vector<core::ir::Value*, 4> args;
+        for (auto& inst : **blocks_.Get(target_id)) {
+            if (inst.opcode() != spv::Op::OpPhi) {
+                break;
+            }
+            core::ir::Value* arg = nullptr;
+            for (uint32_t i = 0; i < inst.NumInOperands(); i += 2) {
+                if (inst.GetSingleWordInOperand(i + 1) == pred_id) {
+                    arg = Value(inst.GetSingleWordInOperand(i));
+                    break;
+                }
+            }
+            if (arg == nullptr) {
+                return Failure("unhandled OpPhi " + std::to_string(inst.result_id()) +
+                               ": no incoming value from SPIR-V block " + std::to_string(pred_id));
+            }
+            args.Push(arg);
+        }
+        return args;
+    }
+
     /// Emit the contents of SPIR-V block @p src into Tint IR block @p dst.
     /// @param dst the Tint IR block to append to
     /// @param src the SPIR-V block to emit
-    void EmitBlock(core::ir::Block* dst, const spvtools::opt::BasicBlock& src) {
+    /// @returns success, or a failure if the block uses an instruction that is not supported yet
+    Result<SuccessType> EmitBlock(core::ir::Block* dst, const spvtools::opt::BasicBlock& src) {
         TINT_SCOPED_ASSIGNMENT(current_block_, dst);
         for (auto& inst : src) {
             switch (inst.opcode()) {
@@ -500,24 +1060,180 @@ class Parser {
                 case spv::Op::OpInBoundsAccessChain:
                     EmitAccess(inst);
                     break;
+                case spv::Op::OpBitcast:
+                    Emit(b_.Bitcast(Type(inst.type_id()), Value(inst.GetSingleWordOperand(2))),
+                         inst.result_id());
+                    break;
+                case spv::Op::OpBitwiseAnd:
+                    EmitBinary(inst, core::BinaryOp::kAnd);
+                    break;
+                case spv::Op::OpBitwiseOr:
+                    EmitBinary(inst, core::BinaryOp::kOr);
+                    break;
+                case spv::Op::OpBitwiseXor:
+                    EmitBinary(inst, core::BinaryOp::kXor);
+                    break;
                 case spv::Op::OpCompositeConstruct:
                     EmitConstruct(inst);
                     break;
                 case spv::Op::OpCompositeExtract:
                     EmitCompositeExtract(inst);
                     break;
+                case spv::Op::OpConvertFToS:
+                case spv::Op::OpConvertFToU:
+                    Emit(b_.Convert(Type(inst.type_id()), Value(inst.GetSingleWordOperand(2))),
+                         inst.result_id());
+                    break;
+                case spv::Op::OpConvertSToF:
+                    EmitIntToFloat(inst, Signedness::kSigned);
+                    break;
+                case spv::Op::OpConvertUToF:
+                    EmitIntToFloat(inst, Signedness::kUnsigned);
+                    break;
+                case spv::Op::OpCopyObject:
+                    AddValue(inst.result_id(), Value(inst.GetSingleWordOperand(2)));
+                    break;
+                case spv::Op::OpDot:
+                    Emit(b_.Call(Type(inst.type_id()), core::BuiltinFn::kDot,
+                                 Value(inst.GetSingleWordOperand(2)),
+                                 Value(inst.GetSingleWordOperand(3))),
+                         inst.result_id());
+                    break;
                 case spv::Op::OpFAdd:
                     EmitBinary(inst, core::BinaryOp::kAdd);
                     break;
+                case spv::Op::OpFDiv:
+                    EmitBinary(inst, core::BinaryOp::kDivide);
+                    break;
                 case spv::Op::OpFMul:
+                case spv::Op::OpMatrixTimesMatrix:
+                case spv::Op::OpMatrixTimesScalar:
+                case spv::Op::OpMatrixTimesVector:
+                case spv::Op::OpVectorTimesMatrix:
+                case spv::Op::OpVectorTimesScalar:
                     EmitBinary(inst, core::BinaryOp::kMultiply);
                     break;
+                case spv::Op::OpFNegate:
+                    Emit(b_.Negation(Type(inst.type_id()), Value(inst.GetSingleWordOperand(2))),
+                         inst.result_id());
+                    break;
+                case spv::Op::OpFOrdEqual:
+                    EmitCompare(inst, core::BinaryOp::kEqual);
+                    break;
+                case spv::Op::OpFOrdGreaterThan:
+                    EmitCompare(inst, core::BinaryOp::kGreaterThan);
+                    break;
+                case spv::Op::OpFOrdGreaterThanEqual:
+                    EmitCompare(inst, core::BinaryOp::kGreaterThanEqual);
+                    break;
+                case spv::Op::OpFOrdLessThan:
+                    EmitCompare(inst, core::BinaryOp::kLessThan);
+                    break;
+                case spv::Op::OpFOrdLessThanEqual:
+                    EmitCompare(inst, core::BinaryOp::kLessThanEqual);
+                    break;
+                case spv::Op::OpFOrdNotEqual:
+                    EmitCompare(inst, core::BinaryOp::kNotEqual);
+                    break;
+                case spv::Op::OpFRem:
+                    EmitBinary(inst, core::BinaryOp::kModulo);
+                    break;
+                case spv::Op::OpFSub:
+                    EmitBinary(inst, core::BinaryOp::kSubtract);
+                    break;
                 case spv::Op::OpFunctionCall:
                     EmitFunctionCall(inst);
                     break;
                 case spv::Op::OpIAdd:
                     EmitBinary(inst, core::BinaryOp::kAdd);
                     break;
+                case spv::Op::OpIEqual:
+                case spv::Op::OpLogicalEqual:
+                    EmitCompare(inst, core::BinaryOp::kEqual);
+                    break;
+                case spv::Op::OpIMul:
+                    EmitBinary(inst, core::BinaryOp::kMultiply);
+                    break;
+                case spv::Op::OpINotEqual:
+                case spv::Op::OpLogicalNotEqual:
+                    EmitCompare(inst, core::BinaryOp::kNotEqual);
+                    break;
+                case spv::Op::OpISub:
+                    EmitBinary(inst, core::BinaryOp::kSubtract);
+                    break;
+                case spv::Op::OpLogicalAnd:
+                    EmitBinary(inst, core::BinaryOp::kAnd);
+                    break;
+                case spv::Op::OpLogicalNot:
+                    Emit(b_.Not(Type(inst.type_id()), Value(inst.GetSingleWordOperand(2))),
+                         inst.result_id());
+                    break;
+                case spv::Op::OpLogicalOr:
+                    EmitBinary(inst, core::BinaryOp::kOr);
+                    break;
+                case spv::Op::OpNot:
+                    EmitNot(inst);
+                    break;
+                case spv::Op::OpSDiv:
+                    EmitIntBinary(inst, core::BinaryOp::kDivide, Signedness::kSigned);
+                    break;
+                case spv::Op::OpSelect:
+                    // Note the operand order of the `select` builtin: false value, true value,
+                    // condition.
+                    Emit(b_.Call(Type(inst.type_id()), core::BuiltinFn::kSelect,
+                                 Value(inst.GetSingleWordOperand(4)),
+                                 Value(inst.GetSingleWordOperand(3)),
+                                 Value(inst.GetSingleWordOperand(2))),
+                         inst.result_id());
+                    break;
+                case spv::Op::OpSGreaterThan:
+                    EmitIntCompare(inst, core::BinaryOp::kGreaterThan, Signedness::kSigned);
+                    break;
+                case spv::Op::OpSGreaterThanEqual:
+                    EmitIntCompare(inst, core::BinaryOp::kGreaterThanEqual, Signedness::kSigned);
+                    break;
+                case spv::Op::OpShiftLeftLogical:
+                    EmitShift(inst, core::BinaryOp::kShiftLeft, std::nullopt);
+                    break;
+                case spv::Op::OpShiftRightArithmetic:
+                    EmitShift(inst, core::BinaryOp::kShiftRight, Signedness::kSigned);
+                    break;
+                case spv::Op::OpShiftRightLogical:
+                    EmitShift(inst, core::BinaryOp::kShiftRight, Signedness::kUnsigned);
+                    break;
+                case spv::Op::OpSLessThan:
+                    EmitIntCompare(inst, core::BinaryOp::kLessThan, Signedness::kSigned);
+                    break;
+                case spv::Op::OpSLessThanEqual:
+                    EmitIntCompare(inst, core::BinaryOp::kLessThanEqual, Signedness::kSigned);
+                    break;
+                case spv::Op::OpSNegate:
+                    EmitSNegate(inst);
+                    break;
+                case spv::Op::OpSRem:
+                    EmitIntBinary(inst, core::BinaryOp::kModulo, Signedness::kSigned);
+                    break;
+                case spv::Op::OpUDiv:
+                    EmitIntBinary(inst, core::BinaryOp::kDivide, Signedness::kUnsigned);
+                    break;
+                case spv::Op::OpUGreaterThan:
+                    EmitIntCompare(inst, core::BinaryOp::kGreaterThan, Signedness::kUnsigned);
+                    break;
+                case spv::Op::OpUGreaterThanEqual:
+                    EmitIntCompare(inst, core::BinaryOp::kGreaterThanEqual, Signedness::kUnsigned);
+                    break;
+                case spv::Op::OpULessThan:
+                    EmitIntCompare(inst, core::BinaryOp::kLessThan, Signedness::kUnsigned);
+                    break;
+                case spv::Op::OpULessThanEqual:
+                    EmitIntCompare(inst, core::BinaryOp::kLessThanEqual, Signedness::kUnsigned);
+                    break;
+                case spv::Op::OpUMod:
+                    EmitIntBinary(inst, core::BinaryOp::kModulo, Signedness::kUnsigned);
+                    break;
+                case spv::Op::OpVectorShuffle:
+                    EmitVectorShuffle(inst);
+                    break;
                 case spv::Op::OpLoad:
                     Emit(b_.Load(Value(inst.GetSingleWordOperand(2))), inst.result_id());
                     break;
@@ -534,11 +1250,35 @@ class Parser {
                 case spv::Op::OpVariable:
                     EmitVar(inst);
                     break;
+                case spv::Op::OpUnreachable:
+                    Emit(b_.Unreachable());
+                    break;
+                case spv::Op::OpExtInst:
+                    if (auto res = EmitExtInst(inst); res != Success) {
+                        return res.Failure();
+                    }
+                    break;
+                case spv::Op::OpPhi:
+                    // OpPhis become the results or block parameters of the structured control flow
+                    // instructions, which are created before the block is emitted.
+                    if (!values_.Contains(inst.result_id())) {
+                        return Failure("unhandled OpPhi in SPIR-V block " +
+                                       std::to_string(src.id()));
+                    }
+                    break;
+                case spv::Op::OpBranch:
+                case spv::Op::OpBranchConditional:
+                case spv::Op::OpLoopMerge:
+                case spv::Op::OpSelectionMerge:
+                case spv::Op::OpSwitch:
+                    // Structured control flow is emitted by EmitBlocks().
+                    break;
                 default:
-                    TINT_UNIMPLEMENTED()
-                        << "unhandled SPIR-V instruction: " << static_cast<uint32_t>(inst.opcode());
+                    return Failure("unhandled SPIR-V instruction: " +
+                                   std::to_string(static_cast<uint32_t>(inst.opcode())));
             }
         }
+        return Success;
     }
 
     /// @param inst the SPIR-V instruction for OpAccessChain
@@ -565,15 +1305,175 @@ class Parser {
         Emit(access, inst.result_id());
     }
 
+    /// The signedness that a SPIR-V instruction interprets its integer operands with.
+    enum class Signedness : uint8_t {
+        kSigned,
+        kUnsigned,
+    };
+
+    /// @param type a scalar or vector integer type
+    /// @param signedness the signedness of the returned type
+    /// @returns the integer type with the same shape as @p type and the given signedness
+    const core::type::Type* IntType(const core::type::Type* type, Signedness signedness) {
+        return ty_.MatchWidth(signedness == Signedness::kSigned
+                                  ? static_cast<const core::type::Type*>(ty_.i32())
+                                  : static_cast<const core::type::Type*>(ty_.u32()),
+                              type);
+    }
+
+    /// SPIR-V integer instructions do not require their operands to have the signedness of the
+    /// result type, but the Tint IR does.
+    /// @param value the value
+    /// @param type the type the value is used as
+    /// @returns @p value, bitcast to @p type if it has a different type
+    core::ir::Value* BitcastIfNeeded(core::ir::Value* value, const core::type::Type* type) {
+        if (value->Type() == type) {
+            return value;
+        }
+        auto* bitcast = b_.Bitcast(type, value);
+        Emit(bitcast);
+        return bitcast->Result(0);
+    }
+
+    /// Emit @p inst as an instruction with result type @p type, bitcasting the result to the
+    /// result type of @p inst if it differs.
+    /// @param inst the SPIR-V instruction
+    /// @param result the Tint instruction
+    void EmitWithResultBitcast(const spvtools::opt::Instruction& inst,
+                               core::ir::Instruction* result) {
+        auto* result_ty = Type(inst.type_id());
+        if (result->Result(0)->Type() == result_ty) {
+            Emit(result, inst.result_id());
+            return;
+        }
+        Emit(result);
+        Emit(b_.Bitcast(result_ty, result->Result(0)), inst.result_id());
+    }
+
     /// @param inst the SPIR-V instruction
     /// @param op the binary operator to use
     void EmitBinary(const spvtools::opt::Instruction& inst, core::BinaryOp op) {
+        auto* type = Type(inst.type_id());
         auto* lhs = Value(inst.GetSingleWordOperand(2));
         auto* rhs = Value(inst.GetSingleWordOperand(3));
-        auto* binary = b_.Binary(op, Type(inst.type_id()), lhs, rhs);
+        if (type->IsIntegerScalarOrVector()) {
+            lhs = BitcastIfNeeded(lhs, type);
+            rhs = BitcastIfNeeded(rhs, type);
+        }
+        auto* binary = b_.Binary(op, type, lhs, rhs);
         Emit(binary, inst.result_id());
     }
 
+    /// @param inst the SPIR-V instruction
+    /// @param op the binary operator to use
+    /// @param signedness the signedness the operands are interpreted with
+    void EmitIntBinary(const spvtools::opt::Instruction& inst,
+                       core::BinaryOp op,
+                       Signedness signedness) {
+        auto* type = IntType(Type(inst.type_id()), signedness);
+        auto* lhs = BitcastIfNeeded(Value(inst.GetSingleWordOperand(2)), type);
+        auto* rhs = BitcastIfNeeded(Value(inst.GetSingleWordOperand(3)), type);
+        EmitWithResultBitcast(inst, b_.Binary(op, type, lhs, rhs));
+    }
+
+    /// @param inst the SPIR-V instruction
+    /// @param op the binary operator to use
+    /// @param signedness the signedness the operands are interpreted with, or std::nullopt if the
+    /// shift does not depend on it
+    void EmitShift(const spvtools::opt::Instruction& inst,
+                   core::BinaryOp op,
+                   std::optional<Signedness> signedness) {
+        auto* type = Type(inst.type_id());
+        if (signedness) {
+            type = IntType(type, *signedness);
+        }
+        auto* lhs = BitcastIfNeeded(Value(inst.GetSingleWordOperand(2)), type);
+        auto* rhs = Value(inst.GetSingleWordOperand(3));
+        rhs = BitcastIfNeeded(rhs, IntType(rhs->Type(), Signedness::kUnsigned));
+        EmitWithResultBitcast(inst, b_.Binary(op, type, lhs, rhs));
+    }
+
+    /// @param inst the SPIR-V instruction for a comparison whose operands have the same type
+    /// @param op the binary operator to use
+    void EmitCompare(const spvtools::opt::Instruction& inst, core::BinaryOp op) {
+        auto* lhs = Value(inst.GetSingleWordOperand(2));
+        auto* rhs = BitcastIfNeeded(Value(inst.GetSingleWordOperand(3)), lhs->Type());
+        Emit(b_.Binary(op, Type(inst.type_id()), lhs, rhs), inst.result_id());
+    }
+
+    /// @param inst the SPIR-V instruction for an integer comparison
+    /// @param op the binary operator to use
+    /// @param signedness the signedness the operands are interpreted with
+    void EmitIntCompare(const spvtools::opt::Instruction& inst,
+                        core::BinaryOp op,
+                        Signedness signedness) {
+        auto* lhs = Value(inst.GetSingleWordOperand(2));
+        auto* type = IntType(lhs->Type(), signedness);
+        lhs = BitcastIfNeeded(lhs, type);
+        auto* rhs = BitcastIfNeeded(Value(inst.GetSingleWordOperand(3)), type);
+        Emit(b_.Binary(op, Type(inst.type_id()), lhs, rhs), inst.result_id());
+    }
+
+    /// @param inst the SPIR-V instruction for OpNot
+    void EmitNot(const spvtools::opt::Instruction& inst) {
+        auto* type = Type(inst.type_id());
+        auto* value = BitcastIfNeeded(Value(inst.GetSingleWordOperand(2)), type);
+        Emit(b_.Complement(type, value), inst.result_id());
+    }
+
+    /// @param inst the SPIR-V instruction for OpSNegate
+    void EmitSNegate(const spvtools::opt::Instruction& inst) {
+        auto* type = IntType(Type(inst.type_id()), Signedness::kSigned);
+        auto* value = BitcastIfNeeded(Value(inst.GetSingleWordOperand(2)), type);
+        EmitWithResultBitcast(inst, b_.Negation(type, value));
+    }
+
+    /// @param inst the SPIR-V instruction for OpConvertSToF or OpConvertUToF
+    /// @param signedness the signedness the operand is interpreted with
+    void EmitIntToFloat(const spvtools::opt::Instruction& inst, Signedness signedness) {
+        auto* value = Value(inst.GetSingleWordOperand(2));
+        value = BitcastIfNeeded(value, IntType(value->Type(), signedness));
+        Emit(b_.Convert(Type(inst.type_id()), value), inst.result_id());
+    }
+
+    /// @param inst the SPIR-V instruction for OpVectorShuffle
+    void EmitVectorShuffle(const spvtools::opt::Instruction& inst) {
+        auto* vector1 = Value(inst.GetSingleWordOperand(2));
+        auto* vector2 = Value(inst.GetSingleWordOperand(3));
+        auto* type = Type(inst.type_id());
+        const uint32_t vector1_width = vector1->Type()->As<core::type::Vector>()->Width();
+
+        // An index of 0xFFFFFFFF selects an undefined component, so use the first one.
+        Vector<uint32_t, 4> indices;
+        bool only_vector1 = true;
+        for (uint32_t i = 4; i < inst.NumOperandWords(); i++) {
+            uint32_t index = inst.GetSingleWordOperand(i);
+            if (index == 0xFFFFFFFFu) {
+                index = 0;
+            }
+            only_vector1 = only_vector1 && index < vector1_width;
+            indices.Push(index);
+        }
+
+        if (only_vector1) {
+            Emit(b_.Swizzle(type, vector1, std::move(indices)), inst.result_id());
+            return;
+        }
+
+        // Components are selected from both vectors, so construct the result from each of them.
+        auto* el_ty = type->DeepestElement();
+        Vector<core::ir::Value*, 4> components;
+        for (auto index : indices) {
+            auto* access =
+                index < vector1_width
+                    ? b_.Access(el_ty, vector1, u32(index))
+                    : b_.Access(el_ty, vector2, u32(index - vector1_width));
+            Emit(access);
+            components.Push(access->Result(0));
+        }
+        Emit(b_.Construct(type, std::move(components)), inst.result_id());
+    }
+
     /// @param inst the SPIR-V instruction for OpCompositeExtract
     void EmitCompositeExtract(const spvtools::opt::Instruction& inst) {
         Vector<core::ir::Value*, 4> indices;
@@ -605,6 +1505,206 @@ class Parser {
         Emit(b_.Call(Function(inst.GetSingleWordInOperand(0)), std::move(args)), inst.result_id());
     }
 
+    /// @param inst the SPIR-V instruction for a GLSL.std.450 OpExtInst
+    /// @returns success, or a failure if the extended instruction is not supported yet
+    Result<SuccessType> EmitExtInst(const spvtools::opt::Instruction& inst) {
+        auto ext_opcode = static_cast<GLSLstd450>(inst.GetSingleWordInOperand(1));
+        auto* result_ty = Type(inst.type_id());
+        auto fn = GlslStd450Builtin(ext_opcode, result_ty);
+        if (!fn) {
+            return Failure("unhandled GLSL.std.450 instruction: " +
+                           std::to_string(static_cast<uint32_t>(ext_opcode)));
+        }
+
+        Vector<core::ir::Value*, 4> args;
+        for (uint32_t i = 2; i < inst.NumInOperands(); i++) {
+            args.Push(Value(inst.GetSingleWordInOperand(i)));
+        }
+
+        // Like the core integer instructions, the integer GLSL.std.450 instructions do not require
+        // their operands to have the signedness that they are interpreted with.
+        const core::type::Type* type = result_ty;
+        if (auto signedness = GlslStd450Signedness(ext_opcode)) {
+            for (auto*& arg : args) {
+                arg = BitcastIfNeeded(arg, IntType(arg->Type(), *signedness));
+            }
+            type = IntType(result_ty, *signedness);
+        } else if (ext_opcode == GLSLstd450FindILsb) {
+            type = args[0]->Type();
+        } else if (ext_opcode == GLSLstd450Ldexp) {
+            args[1] = BitcastIfNeeded(args[1], IntType(args[1]->Type(), Signedness::kSigned));
+        }
+        EmitWithResultBitcast(inst, b_.Call(type, *fn, std::move(args)));
+        return Success;
+    }
+
+    /// @param ext_opcode a GLSL.std.450 extended instruction
+    /// @returns the signedness that the instruction interprets its integer operands with, or
+    /// std::nullopt if it does not depend on it
+    std::optional<Signedness> GlslStd450Signedness(GLSLstd450 ext_opcode) {
+        switch (ext_opcode) {
+            case GLSLstd450SAbs:
+            case GLSLstd450SSign:
+            case GLSLstd450SMin:
+            case GLSLstd450SMax:
+            case GLSLstd450SClamp:
+            case GLSLstd450FindSMsb:
+                return Signedness::kSigned;
+            case GLSLstd450UMin:
+            case GLSLstd450UMax:
+            case GLSLstd450UClamp:
+            case GLSLstd450FindUMsb:
+                return Signedness::kUnsigned;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    /// @param ext_opcode a GLSL.std.450 extended instruction
+    /// @param result_ty the result type of the instruction
+    /// @returns the Tint builtin function for the instruction, or std::nullopt if it has none
+    std::optional<core::BuiltinFn> GlslStd450Builtin(GLSLstd450 ext_opcode,
+                                                     const core::type::Type* result_ty) {
+        // Some of the Tint builtins only have vector overloads.
+        auto vector_only = [&](core::BuiltinFn fn) -> std::optional<core::BuiltinFn> {
+            if (result_ty->Is<core::type::Vector>()) {
+                return fn;
+            }
+            return std::nullopt;
+        };
+        switch (ext_opcode) {
+            case GLSLstd450FAbs:
+            case GLSLstd450SAbs:
+                return core::BuiltinFn::kAbs;
+            case GLSLstd450Acos:
+                return core::BuiltinFn::kAcos;
+            case GLSLstd450Acosh:
+                return core::BuiltinFn::kAcosh;
+            case GLSLstd450Asin:
+                return core::BuiltinFn::kAsin;
+            case GLSLstd450Asinh:
+                return core::BuiltinFn::kAsinh;
+            case GLSLstd450Atan:
+                return core::BuiltinFn::kAtan;
+            case GLSLstd450Atan2:
+                return core::BuiltinFn::kAtan2;
+            case GLSLstd450Atanh:
+                return core::BuiltinFn::kAtanh;
+            case GLSLstd450Ceil:
+                return core::BuiltinFn::kCeil;
+            case GLSLstd450FClamp:
+            case GLSLstd450NClamp:
+            case GLSLstd450SClamp:
+            case GLSLstd450UClamp:
+                return core::BuiltinFn::kClamp;
+            case GLSLstd450Cos:
+                return core::BuiltinFn::kCos;
+            case GLSLstd450Cosh:
+                return core::BuiltinFn::kCosh;
+            case GLSLstd450Cross:
+                return core::BuiltinFn::kCross;
+            case GLSLstd450Degrees:
+                return core::BuiltinFn::kDegrees;
+            case GLSLstd450Determinant:
+                return core::BuiltinFn::kDeterminant;
+            case GLSLstd450Distance:
+                return core::BuiltinFn::kDistance;
+            case GLSLstd450Exp:
+                return core::BuiltinFn::kExp;
+            case GLSLstd450Exp2:
+                return core::BuiltinFn::kExp2;
+            case GLSLstd450FindILsb:
+                return core::BuiltinFn::kFirstTrailingBit;
+            case GLSLstd450FindSMsb:
+            case GLSLstd450FindUMsb:
+                return core::BuiltinFn::kFirstLeadingBit;
+            case GLSLstd450Floor:
+                return core::BuiltinFn::kFloor;
+            case GLSLstd450Fma:
+                return core::BuiltinFn::kFma;
+            case GLSLstd450Fract:
+                return core::BuiltinFn::kFract;
+            case GLSLstd450InverseSqrt:
+                return core::BuiltinFn::kInverseSqrt;
+            case GLSLstd450Ldexp:
+                return core::BuiltinFn::kLdexp;
+            case GLSLstd450Length:
+                return core::BuiltinFn::kLength;
+            case GLSLstd450Log:
+                return core::BuiltinFn::kLog;
+            case GLSLstd450Log2:
+                return core::BuiltinFn::kLog2;
+            case GLSLstd450FMax:
+            case GLSLstd450NMax:
+            case GLSLstd450SMax:
+            case GLSLstd450UMax:
+                return core::BuiltinFn::kMax;
+            case GLSLstd450FMin:
+            case GLSLstd450NMin:
+            case GLSLstd450SMin:
+            case GLSLstd450UMin:
+                return core::BuiltinFn::kMin;
+            case GLSLstd450FMix:
+                return core::BuiltinFn::kMix;
+            case GLSLstd450PackHalf2x16:
+                return core::BuiltinFn::kPack2X16Float;
+            case GLSLstd450PackSnorm2x16:
+                return core::BuiltinFn::kPack2X16Snorm;
+            case GLSLstd450PackUnorm2x16:
+                return core::BuiltinFn::kPack2X16Unorm;
+            case GLSLstd450PackSnorm4x8:
+                return core::BuiltinFn::kPack4X8Snorm;
+            case GLSLstd450PackUnorm4x8:
+                return core::BuiltinFn::kPack4X8Unorm;
+            case GLSLstd450Pow:
+                return core::BuiltinFn::kPow;
+            case GLSLstd450Radians:
+                return core::BuiltinFn::kRadians;
+            case GLSLstd450Round:
+            case GLSLstd450RoundEven:
+                return core::BuiltinFn::kRound;
+            case GLSLstd450FSign:
+            case GLSLstd450SSign:
+                return core::BuiltinFn::kSign;
+            case GLSLstd450Sin:
+                return core::BuiltinFn::kSin;
+            case GLSLstd450Sinh:
+                return core::BuiltinFn::kSinh;
+            case GLSLstd450SmoothStep:
+                return core::BuiltinFn::kSmoothstep;
+            case GLSLstd450Sqrt:
+                return core::BuiltinFn::kSqrt;
+            case GLSLstd450Step:
+                return core::BuiltinFn::kStep;
+            case GLSLstd450Tan:
+                return core::BuiltinFn::kTan;
+            case GLSLstd450Tanh:
+                return core::BuiltinFn::kTanh;
+            case GLSLstd450Trunc:
+                return core::BuiltinFn::kTrunc;
+            case GLSLstd450UnpackHalf2x16:
+                return core::BuiltinFn::kUnpack2X16Float;
+            case GLSLstd450UnpackSnorm2x16:
+                return core::BuiltinFn::kUnpack2X16Snorm;
+            case GLSLstd450UnpackUnorm2x16:
+                return core::BuiltinFn::kUnpack2X16Unorm;
+            case GLSLstd450UnpackSnorm4x8:
+                return core::BuiltinFn::kUnpack4X8Snorm;
+            case GLSLstd450UnpackUnorm4x8:
+                return core::BuiltinFn::kUnpack4X8Unorm;
+            case GLSLstd450FaceForward:
+                return vector_only(core::BuiltinFn::kFaceForward);
+            case GLSLstd450Normalize:
+                return vector_only(core::BuiltinFn::kNormalize);
+            case GLSLstd450Reflect:
+                return vector_only(core::BuiltinFn::kReflect);
+            case GLSLstd450Refract:
+                return vector_only(core::BuiltinFn::kRefract);
+            default:
+                return std::nullopt;
+        }
+    }
+
     /// @param inst the SPIR-V instruction for OpVariable
     void EmitVar(const spvtools::opt::Instruction& inst) {
         // Handle decorations.
@@ -693,6 +1793,22 @@ class Parser {
         tint::HashCode HashCode() const { return Hash(type, access_mode); }
     };
 
+    /// MemberKey describes a member of a SPIR-V struct type.
+    struct MemberKey {
+        /// The SPIR-V result ID of the struct type.
+        uint32_t struct_id;
+        /// The index of the member.
+        uint32_t index;
+
+        // Equality operator for MemberKey.
+        bool operator==(const MemberKey& other) const {
+            return struct_id == other.struct_id && index == other.index;
+        }
+
+        /// @returns the hash code of the MemberKey
+        tint::HashCode HashCode() const { return Hash(struct_id, index); }
+    };
+
     /// The generated IR module.
     core::ir::Module ir_;
     /// The Tint IR builder.
@@ -708,8 +1824,16 @@ class Parser {
     Hashmap<TypeKey, const core::type::Type*, 16> types_;
     /// A map from a SPIR-V function definition result ID to the corresponding Tint function object.
     Hashmap<uint32_t, core::ir::Function*, 8> functions_;
+    /// A map from a SPIR-V block label result ID to the block, for the function being emitted.
+    Hashmap<uint32_t, spvtools::opt::BasicBlock*, 16> blocks_;
+    /// The structured control flow constructs that enclose the SPIR-V block being emitted.
+    Vector<Construct*, 8> constructs_;
     /// A map from a SPIR-V result ID to the corresponding Tint value object.
     Hashmap<uint32_t, core::ir::Value*, 8> values_;
+    /// A map from a SPIR-V result ID to the name declared for it with OpName.
+    Hashmap<uint32_t, std::string, 8> names_;
+    /// A map from a SPIR-V struct member to the name declared for it with OpMemberName.
+    Hashmap<MemberKey, std::string, 8> member_names_;
 
     /// The SPIR-V context containing the SPIR-V tools intermediate representation.
     std::unique_ptr<spvtools::opt::IRContext> spirv_context_;
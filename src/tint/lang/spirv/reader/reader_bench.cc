@@ -0,0 +1,92 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/spirv/reader/reader.h"
+#include "src/tint/lang/spirv/writer/writer.h"
+#include "src/tint/lang/wgsl/reader/reader.h"
+
+namespace tint::spirv::reader {
+namespace {
+
+/// @returns the SPIR-V binary generated for the benchmark input shader called @p name
+Result<std::vector<uint32_t>> GetSpirv(std::string name) {
+    auto res = bench::GetWgslProgram(name);
+    if (res != Success) {
+        return res.Failure();
+    }
+    auto ir = tint::wgsl::reader::ProgramToLoweredIR(res->program);
+    if (ir != Success) {
+        return ir.Failure();
+    }
+    auto gen_res = writer::Generate(ir.Get(), {});
+    if (gen_res != Success) {
+        return gen_res.Failure();
+    }
+    return std::move(gen_res->spirv);
+}
+
+void ReadSPIRV_AST(benchmark::State& state, std::string input_name) {
+    auto spirv = GetSpirv(input_name);
+    if (spirv != Success) {
+        state.SkipWithError(spirv.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        auto program = Read(spirv.Get());
+        if (!program.IsValid()) {
+            state.SkipWithError(program.Diagnostics().Str());
+            return;
+        }
+    }
+}
+
+void ReadSPIRV_IR(benchmark::State& state, std::string input_name) {
+    auto spirv = GetSpirv(input_name);
+    if (spirv != Success) {
+        state.SkipWithError(spirv.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        auto ir = ReadIR(spirv.Get());
+        if (ir != Success) {
+            state.SkipWithError(ir.Failure().reason.Str());
+            return;
+        }
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(ReadSPIRV_AST);
+TINT_BENCHMARK_PROGRAMS(ReadSPIRV_IR);
+
+}  // namespace
+}  // namespace tint::spirv::reader
@@ -79,7 +79,7 @@ struct State {
 
         // Find all of the nested return instructions in the function.
         for (const auto& usage : fn->UsagesUnsorted()) {
-            if (auto* ret = usage->instruction->As<core::ir::Return>()) {
+            if (auto* ret = usage.instruction->As<core::ir::Return>()) {
                 TransitivelyMarkAsReturning(ret->Block()->Parent());
             }
         }
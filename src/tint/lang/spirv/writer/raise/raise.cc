@@ -29,6 +29,7 @@
 
 #include <utility>
 
+#include "src/tint/lang/core/ir/pass_profiler.h"
 #include "src/tint/lang/core/ir/transform/add_empty_entry_point.h"
 #include "src/tint/lang/core/ir/transform/bgra8unorm_polyfill.h"
 #include "src/tint/lang/core/ir/transform/binary_polyfill.h"
@@ -58,12 +59,13 @@
 namespace tint::spirv::writer {
 
 Result<SuccessType> Raise(core::ir::Module& module, const Options& options) {
-#define RUN_TRANSFORM(name, ...)         \
-    do {                                 \
-        auto result = name(__VA_ARGS__); \
-        if (result != Success) {         \
-            return result;               \
-        }                                \
+#define RUN_TRANSFORM(name, ...)                       \
+    do {                                               \
+        core::ir::PassTimer pass_timer(#name, module); \
+        auto result = name(__VA_ARGS__);               \
+        if (result != Success) {                       \
+            return result;                             \
+        }                                              \
     } while (false)
 
     tint::transform::multiplanar::BindingsMap multiplanar_map{};
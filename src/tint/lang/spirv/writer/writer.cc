@@ -30,6 +30,7 @@
 #include <memory>
 #include <utility>
 
+#include "src/tint/lang/core/ir/pass_profiler.h"
 #include "src/tint/lang/spirv/writer/common/option_helpers.h"
 #include "src/tint/lang/spirv/writer/printer/printer.h"
 #include "src/tint/lang/spirv/writer/raise/raise.h"
@@ -55,7 +56,10 @@ Result<Output> Generate(core::ir::Module& ir, const Options& options) {
     }
 
     // Generate the SPIR-V code.
-    auto spirv = Print(ir, options);
+    auto spirv = [&] {
+        core::ir::PassTimer pass_timer("spirv::writer::Print", ir);
+        return Print(ir, options);
+    }();
     if (spirv != Success) {
         return std::move(spirv.Failure());
     }
@@ -28,6 +28,7 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/cmd/bench/corpus.h"
 #include "src/tint/lang/spirv/writer/writer.h"
 #include "src/tint/lang/wgsl/reader/reader.h"
 
@@ -63,7 +64,20 @@ void GenerateSPIRV(benchmark::State& state, std::string input_name) {
     }
 }
 
+Result<SuccessType> CompileSPIRV(const Program& program) {
+    auto ir = tint::wgsl::reader::ProgramToLoweredIR(program);
+    if (ir != Success) {
+        return ir.Failure();
+    }
+    auto gen_res = Generate(ir.Get(), {});
+    if (gen_res != Success) {
+        return gen_res.Failure();
+    }
+    return Success;
+}
+
 TINT_BENCHMARK_PROGRAMS(GenerateSPIRV);
+TINT_BENCHMARK_CORPUS_COMPILER("SPIR-V", CompileSPIRV);
 
 }  // namespace
 }  // namespace tint::spirv::writer
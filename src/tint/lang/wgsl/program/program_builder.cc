@@ -41,7 +41,9 @@ using namespace tint::core::number_suffixes;  // NOLINT
 
 namespace tint {
 
-ProgramBuilder::ProgramBuilder() = default;
+ProgramBuilder::ProgramBuilder() {
+    constants.types.UseSharedTypes();
+}
 
 ProgramBuilder::ProgramBuilder(ProgramBuilder&& rhs)
     : Builder(std::move(rhs)),
@@ -108,7 +108,10 @@ uint32_t hex_value(char c) {
 
 }  // namespace
 
-Lexer::Lexer(const Source::File* file) : file_(file), location_{1, 1} {}
+Lexer::Lexer(const Source::File* file)
+    : file_(file), location_{1, 1}, remaining_(file->content.data) {
+    line_ = Source::FileContent::NextLine(&remaining_);
+}
 
 Lexer::~Lexer() = default;
 
@@ -135,11 +138,7 @@ std::vector<Token> Lexer::Lex() {
 }
 
 std::string_view Lexer::line() const {
-    if (file_->content.lines.size() == 0) {
-        static const char* empty_string = "";
-        return empty_string;
-    }
-    return file_->content.lines[location_.line - 1];
+    return line_;
 }
 
 uint32_t Lexer::pos() const {
@@ -176,10 +175,11 @@ void Lexer::set_pos(uint32_t pos) {
 void Lexer::advance_line() {
     location_.line++;
     location_.column = 1;
+    line_ = Source::FileContent::NextLine(&remaining_);
 }
 
 bool Lexer::is_eof() const {
-    return location_.line >= file_->content.lines.size() && pos() >= length();
+    return remaining_.empty() && pos() >= length();
 }
 
 bool Lexer::is_eol() const {
@@ -122,6 +122,11 @@ class Lexer {
     Source::File const* const file_;
     /// The current location within the input
     Source::Location location_;
+    /// The current line. Lines are split from the file content as the lexer advances, so the
+    /// file's line table is never built while lexing.
+    std::string_view line_;
+    /// The file content following the current line's line break
+    std::string_view remaining_;
 };
 
 }  // namespace tint::wgsl::reader
@@ -49,5 +49,22 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_PROGRAMS(ParseWGSL);
 
+void LowerWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslProgram(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason.Str());
+        return;
+    }
+    for (auto _ : state) {
+        // Runs the AST transforms, then clones every semantic type into the IR module.
+        auto ir = ProgramToLoweredIR(res->program);
+        if (ir != Success) {
+            state.SkipWithError(ir.Failure().reason.Str());
+        }
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(LowerWGSL);
+
 }  // namespace
 }  // namespace tint::wgsl::reader
@@ -28,6 +28,7 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/cmd/bench/corpus.h"
 #include "src/tint/lang/wgsl/writer/writer.h"
 
 namespace tint::wgsl::writer {
@@ -47,7 +48,16 @@ void GenerateWGSL(benchmark::State& state, std::string input_name) {
     }
 }
 
+Result<SuccessType> CompileWGSL(const Program& program) {
+    auto gen_res = Generate(program, {});
+    if (gen_res != Success) {
+        return gen_res.Failure();
+    }
+    return Success;
+}
+
 TINT_BENCHMARK_PROGRAMS(GenerateWGSL);
+TINT_BENCHMARK_CORPUS_COMPILER("WGSL", CompileWGSL);
 
 }  // namespace
 }  // namespace tint::wgsl::writer
@@ -142,10 +142,10 @@ void Formatter::Format(const Diagnostic& diag, StyledText& text) const {
     if (style_.print_line && src.file && rng.begin.line > 0) {
         text << style::Plain("\n");
 
+        auto& lines = src.file->content.Lines();
         for (size_t line_num = rng.begin.line;
-             (line_num <= rng.end.line) && (line_num <= src.file->content.lines.size());
-             line_num++) {
-            auto& line = src.file->content.lines[line_num - 1];
+             (line_num <= rng.end.line) && (line_num <= lines.size()); line_num++) {
+            auto& line = lines[line_num - 1];
             auto line_len = line.size();
 
             bool is_ascii = true;
@@ -28,6 +28,9 @@
 #include "src/tint/utils/diagnostic/source.h"
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <string_view>
 #include <utility>
 
@@ -88,10 +91,31 @@ bool ParseLineBreak(std::string_view str, size_t i, bool* is_line_break, size_t*
     return true;
 }
 
-std::vector<std::string_view> SplitLines(std::string_view str) {
+}  // namespace
+
+struct Source::FileContent::LineTable {
+    std::once_flag once;
     std::vector<std::string_view> lines;
+};
+
+Source::FileContent::FileContent(std::string_view body)
+    : FileContent({}, std::make_shared<const std::string>(body)) {}
+
+Source::FileContent::FileContent(std::string_view body, std::shared_ptr<const std::string> owned)
+    : data(owned ? std::string_view(*owned) : body),
+      owned_(std::move(owned)),
+      line_table_(std::make_shared<LineTable>()) {}
+
+Source::FileContent::FileContent(const FileContent& rhs) = default;
+
+Source::FileContent::~FileContent() = default;
+
+Source::FileContent Source::FileContent::Borrow(std::string_view body) {
+    return FileContent(body, nullptr);
+}
 
-    size_t lineStart = 0;
+std::string_view Source::FileContent::NextLine(std::string_view* text) {
+    std::string_view str = *text;
     for (size_t i = 0; i < str.size();) {
         bool is_line_break{};
         size_t line_break_size{};
@@ -99,44 +123,25 @@ std::vector<std::string_view> SplitLines(std::string_view str) {
         // the Lexer to do so.
         ParseLineBreak(str, i, &is_line_break, &line_break_size);
         if (is_line_break) {
-            lines.push_back(str.substr(lineStart, i - lineStart));
-            i += line_break_size;
-            lineStart = i;
-        } else {
-            ++i;
+            *text = str.substr(std::min(i + line_break_size, str.size()));
+            return str.substr(0, i);
         }
+        ++i;
     }
-    if (lineStart < str.size()) {
-        lines.push_back(str.substr(lineStart));
-    }
-
-    return lines;
+    *text = {};
+    return str;
 }
 
-std::vector<std::string_view> CopyRelativeStringViews(const std::vector<std::string_view>& src_list,
-                                                      const std::string_view& src_view,
-                                                      const std::string_view& dst_view) {
-    std::vector<std::string_view> out(src_list.size());
-    for (size_t i = 0; i < src_list.size(); i++) {
-        if (src_list[i].empty()) {
-            continue;
+const std::vector<std::string_view>& Source::FileContent::Lines() const {
+    std::call_once(line_table_->once, [&] {
+        std::string_view remaining = data;
+        while (!remaining.empty()) {
+            line_table_->lines.push_back(NextLine(&remaining));
         }
-        auto offset = static_cast<size_t>(&src_list[i].front() - &src_view.front());
-        auto count = src_list[i].length();
-        out[i] = dst_view.substr(offset, count);
-    }
-    return out;
+    });
+    return line_table_->lines;
 }
 
-}  // namespace
-
-Source::FileContent::FileContent(std::string_view body) : data(body), lines(SplitLines(data)) {}
-
-Source::FileContent::FileContent(const FileContent& rhs)
-    : data(rhs.data), lines(CopyRelativeStringViews(rhs.lines, rhs.data, data)) {}
-
-Source::FileContent::~FileContent() = default;
-
 Source::File::~File() = default;
 
 std::string ToString(const Source& source) {
@@ -162,11 +167,12 @@ std::string ToString(const Source& source) {
                 }
             };
 
+            auto& lines = source.file->content.Lines();
             for (size_t line = rng.begin.line; line <= rng.end.line; line++) {
-                if (line < source.file->content.lines.size() + 1) {
-                    auto len = source.file->content.lines[line - 1].size();
+                if (line < lines.size() + 1) {
+                    auto len = lines[line - 1].size();
 
-                    out << source.file->content.lines[line - 1] << "\n";
+                    out << lines[line - 1] << "\n";
 
                     if (line == rng.begin.line && line == rng.end.line) {
                         // Single line
@@ -196,19 +202,20 @@ size_t Source::Range::Length(const FileContent& content) const {
     TINT_ASSERT(begin <= end);
     TINT_ASSERT(begin.column > 0);
     TINT_ASSERT(begin.line > 0);
-    TINT_ASSERT(end.line <= 1 + content.lines.size());
-    TINT_ASSERT(end.column <= 1 + content.lines[end.line - 1].size());
+    auto& lines = content.Lines();
+    TINT_ASSERT(end.line <= 1 + lines.size());
+    TINT_ASSERT(end.column <= 1 + lines[end.line - 1].size());
 
     if (end.line == begin.line) {
         return end.column - begin.column;
     }
 
-    size_t len = (content.lines[begin.line - 1].size() + 1 - begin.column) +  // first line
-                 (end.column - 1) +                                           // last line
-                 end.line - begin.line;                                       // newlines
+    size_t len = (lines[begin.line - 1].size() + 1 - begin.column) +  // first line
+                 (end.column - 1) +                                   // last line
+                 end.line - begin.line;                               // newlines
 
     for (size_t line = begin.line + 1; line < end.line; line++) {
-        len += content.lines[line - 1].size();  // whole-lines
+        len += lines[line - 1].size();  // whole-lines
     }
     return len;
 }
@@ -29,6 +29,7 @@
 #ifndef SRC_TINT_UTILS_DIAGNOSTIC_SOURCE_H_
 #define SRC_TINT_UTILS_DIAGNOSTIC_SOURCE_H_
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -43,9 +44,12 @@ namespace tint {
 class Source {
   public:
     /// FileContent describes the content of a source file encoded using UTF-8.
+    /// The content is either owned by the FileContent, or borrowed from memory that outlives it
+    /// (see Borrow()). Copies of a FileContent share the same underlying content.
+    /// The table of lines is only built the first time Lines() is called.
     class FileContent {
       public:
-        /// Constructs the FileContent with the given file content.
+        /// Constructs the FileContent with a copy of the given file content.
         /// @param data the file contents
         explicit FileContent(std::string_view data);
 
@@ -56,20 +60,49 @@ class Source {
         /// Destructor
         ~FileContent();
 
+        /// Constructs a FileContent that references @p data without copying it.
+        /// @param data the file contents, which must outlive the returned FileContent and all of
+        /// its copies.
+        /// @returns the FileContent
+        static FileContent Borrow(std::string_view data);
+
+        /// Splits the first line from @p text.
+        /// @param text the text to split. On return, holds the remaining text following the first
+        /// line break, or is empty if there was no line break.
+        /// @returns the first line of @p text, excluding the line break
+        static std::string_view NextLine(std::string_view* text);
+
+        /// @returns #data split by lines. The lines are computed on the first call.
+        /// This method is thread-safe.
+        const std::vector<std::string_view>& Lines() const;
+
         /// The original un-split file content
-        const std::string data;
-        /// #data split by lines
-        const std::vector<std::string_view> lines;
+        const std::string_view data;
+
+      private:
+        struct LineTable;
+
+        FileContent(std::string_view data, std::shared_ptr<const std::string> owned);
+
+        /// The storage for #data, if the content is owned. Null if the content is borrowed.
+        std::shared_ptr<const std::string> owned_;
+        /// The lazily built lines of #data, shared between copies.
+        std::shared_ptr<LineTable> line_table_;
     };
 
     /// File describes a source file, including path and content.
     class File {
       public:
-        /// Constructs the File with the given file path and content.
+        /// Constructs the File with the given file path and a copy of the content.
         /// @param p the path for this file
         /// @param c the file contents
         inline File(const std::string& p, std::string_view c) : path(p), content(c) {}
 
+        /// Constructs the File with the given file path and content.
+        /// @param p the path for this file
+        /// @param c the file contents, which may be borrowed
+        inline File(const std::string& p, const FileContent& c) : path(p), content(c) {}
+
         /// Copy constructor
         File(const File&) = default;
 
@@ -29,6 +29,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <utility>
 
@@ -48,11 +49,11 @@ using SourceFileContentTest = testing::Test;
 TEST_F(SourceFileContentTest, Init) {
     Source::FileContent fc(kSource);
     EXPECT_EQ(fc.data, kSource);
-    ASSERT_EQ(fc.lines.size(), 4u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "line two");
-    EXPECT_EQ(fc.lines[2], "");
-    EXPECT_EQ(fc.lines[3], "line three");
+    ASSERT_EQ(fc.Lines().size(), 4u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
+    EXPECT_EQ(fc.Lines()[2], "");
+    EXPECT_EQ(fc.Lines()[3], "line three");
 }
 
 TEST_F(SourceFileContentTest, CopyInit) {
@@ -60,11 +61,11 @@ TEST_F(SourceFileContentTest, CopyInit) {
     Source::FileContent fc{*src};
     src.reset();
     EXPECT_EQ(fc.data, kSource);
-    ASSERT_EQ(fc.lines.size(), 4u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "line two");
-    EXPECT_EQ(fc.lines[2], "");
-    EXPECT_EQ(fc.lines[3], "line three");
+    ASSERT_EQ(fc.Lines().size(), 4u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
+    EXPECT_EQ(fc.Lines()[2], "");
+    EXPECT_EQ(fc.Lines()[3], "line three");
 }
 
 TEST_F(SourceFileContentTest, MoveInit) {
@@ -72,11 +73,48 @@ TEST_F(SourceFileContentTest, MoveInit) {
     Source::FileContent fc{std::move(*src)};
     src.reset();
     EXPECT_EQ(fc.data, kSource);
-    ASSERT_EQ(fc.lines.size(), 4u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "line two");
-    EXPECT_EQ(fc.lines[2], "");
-    EXPECT_EQ(fc.lines[3], "line three");
+    ASSERT_EQ(fc.Lines().size(), 4u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
+    EXPECT_EQ(fc.Lines()[2], "");
+    EXPECT_EQ(fc.Lines()[3], "line three");
+}
+
+TEST_F(SourceFileContentTest, Borrow) {
+    std::string src(kSource);
+    auto fc = Source::FileContent::Borrow(src);
+    EXPECT_EQ(fc.data.data(), src.data());
+    ASSERT_EQ(fc.Lines().size(), 4u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
+    EXPECT_EQ(fc.Lines()[2], "");
+    EXPECT_EQ(fc.Lines()[3], "line three");
+    EXPECT_EQ(fc.Lines()[0].data(), src.data());
+}
+
+TEST_F(SourceFileContentTest, CopySharesContent) {
+    Source::FileContent a(kSource);
+    Source::FileContent b{a};
+    EXPECT_NE(a.data.data(), kSource.data());
+    EXPECT_EQ(a.data.data(), b.data.data());
+    EXPECT_EQ(&a.Lines(), &b.Lines());
+}
+
+TEST_F(SourceFileContentTest, NextLine) {
+    std::string_view text = kSource;
+    EXPECT_EQ(Source::FileContent::NextLine(&text), "line one");
+    EXPECT_EQ(Source::FileContent::NextLine(&text), "line two");
+    EXPECT_EQ(Source::FileContent::NextLine(&text), "");
+    EXPECT_EQ(text, "line three");
+    EXPECT_EQ(Source::FileContent::NextLine(&text), "line three");
+    EXPECT_TRUE(text.empty());
+}
+
+TEST_F(SourceFileContentTest, FileBorrow) {
+    std::string src(kSource);
+    Source::File file("path", Source::FileContent::Borrow(src));
+    EXPECT_EQ(file.path, "path");
+    EXPECT_EQ(file.content.data.data(), src.data());
 }
 
 // Line break code points
@@ -95,9 +133,9 @@ TEST_P(LineBreakTest, Single) {
     src += "line two";
 
     Source::FileContent fc(src);
-    EXPECT_EQ(fc.lines.size(), 2u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "line two");
+    EXPECT_EQ(fc.Lines().size(), 2u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "line two");
 }
 TEST_P(LineBreakTest, Double) {
     std::string src = "line one";
@@ -106,10 +144,10 @@ TEST_P(LineBreakTest, Double) {
     src += "line two";
 
     Source::FileContent fc(src);
-    EXPECT_EQ(fc.lines.size(), 3u);
-    EXPECT_EQ(fc.lines[0], "line one");
-    EXPECT_EQ(fc.lines[1], "");
-    EXPECT_EQ(fc.lines[2], "line two");
+    EXPECT_EQ(fc.Lines().size(), 3u);
+    EXPECT_EQ(fc.Lines()[0], "line one");
+    EXPECT_EQ(fc.Lines()[1], "");
+    EXPECT_EQ(fc.Lines()[2], "line two");
 }
 INSTANTIATE_TEST_SUITE_P(SourceFileContentTest,
                          LineBreakTest,